@@ -72,6 +72,8 @@ set supportBSC=%ERRORLEVEL%
 set ebcdic=%ERRORLEVEL%
 %pcre2test% -C ebcdic-nl25 >NUL
 set ebcdic_nl25=%ERRORLEVEL%
+%pcre2test% -C profile >NUL
+set profile=%ERRORLEVEL%
 
 if %support8% EQU 1 (
 if not exist testout8 md testout8
@@ -117,18 +119,19 @@ set do26=no
 set do27=no
 set do28=no
 set do29=no
+set do30=no
 set all=yes
 
 for %%a in (%*) do (
   set valid=no
-  for %%v in (1 2 3 4 5 6 7 8 9 10 11 12 13 14 15 16 17 18 19 20 21 22 23 24 25 26 27 28 29) do if %%v == %%a set valid=yes
+  for %%v in (1 2 3 4 5 6 7 8 9 10 11 12 13 14 15 16 17 18 19 20 21 22 23 24 25 26 27 28 29 30) do if %%v == %%a set valid=yes
   if "!valid!" == "yes" (
     set do%%a=yes
     set all=no
   ) else (
     echo Invalid test number - %%a!
     echo Usage %0 [ test_number ] ...
-    echo Where test_number is one or more optional test numbers 1 through 29, default is all tests.
+    echo Where test_number is one or more optional test numbers 1 through 30, default is all tests.
     exit /b 1
   )
 )
@@ -164,6 +167,7 @@ if "%all%" == "yes" (
   set do27=yes
   set do28=yes
   set do29=yes
+  set do30=yes
 )
 
 @echo RunTest.bat's pcre2test output is written to newly created subfolders
@@ -221,6 +225,7 @@ if "%do26%" == "yes" call :do26
 if "%do27%" == "yes" call :do27
 if "%do28%" == "yes" call :do28
 if "%do29%" == "yes" call :do29
+if "%do30%" == "yes" call :do30
 :modeSkip
 if "%mode%" == "" (
   set mode=-16
@@ -337,6 +342,16 @@ goto :eof
   copy /y %srcdir%\testdata\testbtables testbtables
   call :runsub 2 testout "API, errors, internals, and non-Perl stuff" -q
   if %jit% EQU 1 call :runsub 2 testoutjit "Test with JIT Override" -q -jit
+  @rem pcre2test reports a compiled replacement that differs from pcre2_substitute()
+  echo Test 2: Compiled replacements
+  %pcre2test% %mode% -q -subject substitute_compiled %srcdir%\testdata\testinput2 >testout%bits%\testoutput2c
+  findstr /b /c:"** pcre2_substitute() gave a different result" testout%bits%\testoutput2c >NUL
+  if not errorlevel 1 (
+    echo.          failed: compiled replacements differ, see testout%bits%\testoutput2c
+    set failed="yes"
+  ) else (
+    echo.          Passed.
+  )
 goto :eof
 
 :do3
@@ -579,6 +594,14 @@ if %ebcdic_nl25% EQU 0 (
   if %jit% EQU 1 call :runsub 29 testoutjit "Test with JIT Override" -q -jit
 goto :eof
 
+:do30
+if %profile% EQU 0 (
+  echo Test 30 Skipped because match profiling is not supported.
+  goto :eof
+)
+  call :runsub 30 testout "Match profiling tests" -q
+goto :eof
+
 :conferror
 @echo.
 @echo Either your build is incomplete or you have a configuration error.
@@ -78,6 +78,7 @@ pub fn build(b: *std.Build) !void {
         .{
             .HAVE_ASSERT_H = true,
             .HAVE_DIRENT_H = is_unix or is_mingw,
+            .HAVE_LINUX_PERF_EVENT_H = rt.os.tag == .linux,
             .HAVE_SYS_STAT_H = true,
             .HAVE_SYS_TYPES_H = true,
             .HAVE_UNISTD_H = is_unix or is_mingw,
@@ -148,6 +149,7 @@ pub fn build(b: *std.Build) !void {
             "src/pcre2_compile.c",
             "src/pcre2_compile_cgroup.c",
             "src/pcre2_compile_class.c",
+            "src/pcre2_compile_many.c",
             "src/pcre2_config.c",
             "src/pcre2_context.c",
             "src/pcre2_convert.c",
@@ -163,6 +165,7 @@ pub fn build(b: *std.Build) !void {
             "src/pcre2_newline.c",
             "src/pcre2_ord2utf.c",
             "src/pcre2_pattern_info.c",
+            "src/pcre2_scan.c",
             "src/pcre2_script_run.c",
             "src/pcre2_serialize.c",
             "src/pcre2_string_utils.c",
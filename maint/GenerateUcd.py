@@ -111,6 +111,7 @@
 # 14-January-2022:   Enlarge Boolean property offset to 12 bits
 # 28-January-2023:   Remove ASCII "other case" from non-ASCII character that
 #                      are present in caseless sets.
+# 19-October-2026:   Add bitsets for some frequently used properties.
 #
 # ----------------------------------------------------------------------------
 #
@@ -131,7 +132,7 @@
 # the same set of records as other blocks. This leads to a 2-stage lookup
 # process.
 #
-# This script constructs seven tables. The ucd_caseless_sets table contains
+# This script constructs eight tables. The ucd_caseless_sets table contains
 # lists of characters that all match each other caselessly. Each list is
 # in order, and is terminated by NOTACHAR (0xffffffff), which is larger than
 # any valid character. The first list is empty; this is used for characters
@@ -170,6 +171,11 @@
 # the offset of a character within its own block, and the result is the index
 # number of the required record in the ucd_records vector.
 #
+# The ucd_propbits table is also indexed by the "virtual" block number from
+# ucd_stage1. For each block it contains a bitset for each of a few frequently
+# used properties (for example, letters and \w under PCRE2_UCP), so that these
+# can be tested without fetching the character's record.
+#
 # The following examples are correct for the Unicode 14.0.0 database. Future
 # updates may make change the actual lookup values.
 #
@@ -765,6 +771,52 @@ for block_size in [2 ** i for i in range(5,10)]:
     min_stage1, min_stage2 = stage1, stage2
     min_block_size = block_size
 
+# Create bitsets for a few frequently used properties, so that they can be
+# tested without fetching a character's record. There is one group of bitsets
+# for each block in the stage2 table, so the same stage1 lookup is used. Most
+# of the properties depend only on the general category, and so are the same
+# for every character that shares a record, but white space also includes some
+# control characters. Check that this does not give different bits for two
+# blocks that share a stage2 block. The order of the bitsets must match the
+# UCD_PROPBITS_xxx values in pcre2_internal.h. The white space characters are
+# those in HSPACE_LIST and VSPACE_LIST in pcre2_internal.h.
+
+propbits_names = ['L', 'Nd', 'Alnum', 'Space', 'Word']
+white_space = [0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x20, 0x85, 0xa0, 0x1680, 0x180e,
+  0x2000, 0x2001, 0x2002, 0x2003, 0x2004, 0x2005, 0x2006, 0x2007, 0x2008,
+  0x2009, 0x200a, 0x2028, 0x2029, 0x202f, 0x205f, 0x3000]
+
+def get_propbits(c):
+  chartype = category_names[category[c]]
+  gentype = chartype[0]
+  return [gentype == 'L',
+          chartype == 'Nd',
+          gentype == 'L' or gentype == 'N',
+          gentype == 'Z' or c in white_space,
+          gentype == 'L' or gentype == 'N' or chartype == 'Mn' or
+            chartype == 'Pc']
+
+propbits_words = min_block_size // 32
+propbits = [None] * (len(min_stage2) // min_block_size)
+
+for block, vblock in enumerate(min_stage1):
+  vblock = int(vblock)
+  bits = [0] * (len(propbits_names) * propbits_words)
+  for i in range(min_block_size):
+    c = block * min_block_size + i
+    for n, isprop in enumerate(get_propbits(c)):
+      if isprop:
+        bits[n * propbits_words + i // 32] |= 1 << (i % 32)
+  if propbits[vblock] is None:
+    propbits[vblock] = bits
+  elif propbits[vblock] != bits:
+    print("** Property bitsets differ in blocks that share stage2 block %d" %
+      vblock, file=sys.stderr)
+    sys.exit(1)
+
+min_size += len(propbits) * len(propbits_names) * propbits_words * 4
+
+
 
 # ---------------------------------------------------------------------------
 #                   MAIN CODE FOR WRITING THE OUTPUT FILE
@@ -807,6 +859,8 @@ compilers barf at that. Instead, just supply some small dummy tables. */
 const ucd_record PRIV(ucd_records)[] = {{0,0,0,0,0,0,0}};
 const uint16_t PRIV(ucd_stage1)[] = {0};
 const uint16_t PRIV(ucd_stage2)[] = {0};
+const uint32_t PRIV(ucd_propbits)[] = {0};
+const uint8_t PRIV(ucd_propbits_ascii)[] = {0};
 const uint32_t PRIV(ucd_caseless_sets)[] = {0};
 const uint32_t PRIV(ucd_nocase_ranges)[] = {0};
 const uint32_t PRIV(ucd_nocase_ranges_size) = 0;
@@ -985,6 +1039,49 @@ write_records(records, record_size)
 write_table(min_stage1, 'PRIV(ucd_stage1)')
 write_table(min_stage2, 'PRIV(ucd_stage2)', min_block_size)
 
+# Output the property bitsets.
+
+f.write("""\
+/* This table contains bitsets for some frequently used properties, so that
+they can be tested without looking at a character's record. It is indexed by
+the same block number as ucd_stage2, that is, by the value from ucd_stage1.
+For each block there are UCD_PROPBITS_COUNT bitsets of UCD_BLOCK_SIZE bits,
+in the order of the UCD_PROPBITS_xxx values in pcre2_internal.h. */
+\n""")
+
+f.write("const uint32_t PRIV(ucd_propbits)[] = { /* %d bytes */\n" %
+  (len(propbits) * len(propbits_names) * propbits_words * 4))
+for vblock, bits in enumerate(propbits):
+  f.write("\n/* block %d */\n" % vblock)
+  for n, name in enumerate(propbits_names):
+    words = bits[n * propbits_words:(n + 1) * propbits_words]
+    f.write("  " + "".join("0x%08xu, " % x for x in words) + "/* %s */\n" % name)
+f.write("};\n\n")
+
+# The bitsets for ASCII characters are also output as bytes, in the same form
+# as a class bitmap, for use by the vector scan in pcre2_scan.c.
+
+f.write("""\
+/* This table contains the same bitsets for the ASCII characters, as 16-byte
+maps in which byte n holds the bits for characters 8n to 8n+7, in the same
+order. It is used to skip quickly over runs of ASCII characters. */
+
+const uint8_t PRIV(ucd_propbits_ascii)[] = {
+""")
+ascii_block = int(min_stage1[0])
+for n, name in enumerate(propbits_names):
+  words = propbits[ascii_block][n * propbits_words:n * propbits_words + 4]
+  f.write("  " + "".join("0x%02x," % ((words[i // 4] >> (8 * (i % 4))) & 0xff)
+    for i in range(16)) + " /* %s */\n" % name)
+f.write("};\n\n")
+
+f.write("#if UCD_PROPBITS_COUNT != %d\n" % len(propbits_names))
+f.write("""\
+#error Please correct UCD_PROPBITS_COUNT in pcre2_internal.h
+#endif
+
+""")
+
 f.write("#if UCD_BLOCK_SIZE != %d\n" % min_block_size)
 f.write("""\
 #error Please correct UCD_BLOCK_SIZE in pcre2_internal.h
@@ -162,6 +162,12 @@ memory is used for longer patterns. */
 
 #define PARSED_PATTERN_DEFAULT_SIZE 1024
 
+/* Memory carved from a compile arena is rounded up to a multiple of this
+value, which must be a power of two that is enough to align any of the
+structures that the compiler obtains as temporary memory. */
+
+#define ARENA_ALIGNMENT 16
+
 /* Maximum length value to check against when making sure that the variable
 that holds the compiled pattern length does not overflow. We make it a bit less
 than INT_MAX to allow for adding in group terminating code units, so that we
@@ -710,7 +716,8 @@ are allowed. */
     PCRE2_EXTRA_ALLOW_LOOKAROUND_BSK|PCRE2_EXTRA_ASCII_BSD| \
     PCRE2_EXTRA_ASCII_BSS|PCRE2_EXTRA_ASCII_BSW|PCRE2_EXTRA_ASCII_POSIX| \
     PCRE2_EXTRA_ASCII_DIGIT|PCRE2_EXTRA_PYTHON_OCTAL|PCRE2_EXTRA_NO_BS0| \
-    PCRE2_EXTRA_NEVER_CALLOUT)
+    PCRE2_EXTRA_NEVER_CALLOUT|PCRE2_EXTRA_DFA_BITPARALLEL| \
+    PCRE2_EXTRA_ONEPASS)
 
 /* This is a table of start-of-pattern options such as (*UTF) and settings such
 as (*LIMIT_MATCH=nnnn) and (*CRLF). For completeness and backward
@@ -1126,16 +1133,24 @@ return;
 *************************************************/
 
 /* Compiled JIT code cannot be copied, so the new compiled block has no
-associated JIT data. */
+associated JIT data. A copy of a code in a read-only region is an ordinary
+code that uses the default memory functions. It must not refer to the region,
+which may be unmapped while the copy is in use, so it is given its own copy of
+the tables, as by pcre2_code_copy_with_tables(). */
 
 PCRE2_EXP_DEFN pcre2_code * PCRE2_CALL_CONVENTION
 pcre2_code_copy(const pcre2_code *code)
 {
 PCRE2_SIZE *ref_count;
 pcre2_code *newcode;
+const pcre2_memctl *memctl;
 
 if (code == NULL) return NULL;
-newcode = code->memctl.malloc(code->blocksize, code->memctl.memory_data);
+if ((code->flags & PCRE2_MAPPED) != 0)
+  return pcre2_code_copy_with_tables(code);
+
+memctl = CODE_MEMCTL(code);
+newcode = memctl->malloc(code->blocksize, memctl->memory_data);
 if (newcode == NULL) return NULL;
 memcpy(newcode, code, code->blocksize);
 newcode->executable_jit = NULL;
@@ -1168,26 +1183,29 @@ pcre2_code_copy_with_tables(const pcre2_code *code)
 PCRE2_SIZE* ref_count;
 pcre2_code *newcode;
 uint8_t *newtables;
+const pcre2_memctl *memctl;
 
 if (code == NULL) return NULL;
-newcode = code->memctl.malloc(code->blocksize, code->memctl.memory_data);
+memctl = CODE_MEMCTL(code);
+newcode = memctl->malloc(code->blocksize, memctl->memory_data);
 if (newcode == NULL) return NULL;
 memcpy(newcode, code, code->blocksize);
 newcode->executable_jit = NULL;
 
-newtables = code->memctl.malloc(TABLES_LENGTH + sizeof(PCRE2_SIZE),
-  code->memctl.memory_data);
+newtables = memctl->malloc(TABLES_LENGTH + sizeof(PCRE2_SIZE),
+  memctl->memory_data);
 if (newtables == NULL)
   {
-  code->memctl.free((void *)newcode, code->memctl.memory_data);
+  memctl->free((void *)newcode, memctl->memory_data);
   return NULL;
   }
-memcpy(newtables, code->tables, TABLES_LENGTH);
+memcpy(newtables, CODE_TABLES(code), TABLES_LENGTH);
 ref_count = (PCRE2_SIZE *)(newtables + TABLES_LENGTH);
 *ref_count = 1;
 
+newcode->memctl = *memctl;
 newcode->tables = newtables;
-newcode->flags |= PCRE2_DEREF_TABLES;
+newcode->flags = (newcode->flags | PCRE2_DEREF_TABLES) & ~PCRE2_MAPPED;
 return newcode;
 }
 
@@ -1202,7 +1220,10 @@ pcre2_code_free(pcre2_code *code)
 {
 PCRE2_SIZE* ref_count;
 
-if (code != NULL)
+/* A code in a region made by pcre2_serialize_encode_region() belongs to the
+region, so there is nothing to free. */
+
+if (code != NULL && (code->flags & PCRE2_MAPPED) == 0)
   {
 #ifdef SUPPORT_JIT
   if (code->executable_jit != NULL)
@@ -1230,6 +1251,182 @@ if (code != NULL)
 
 
 
+/*************************************************
+*            Create a compile arena              *
+*************************************************/
+
+/* The initial size may be zero, in which case no memory is obtained until the
+arena is first used. The arena grows to fit the largest compilation it has
+seen, so that subsequent compilations of similar patterns need no temporary
+allocations at all. */
+
+PCRE2_EXP_DEFN pcre2_compile_arena * PCRE2_CALL_CONVENTION
+pcre2_compile_arena_create(PCRE2_SIZE size, pcre2_general_context *gcontext)
+{
+pcre2_compile_arena *arena = PRIV(memctl_malloc)(
+  sizeof(pcre2_real_compile_arena), (pcre2_memctl *)gcontext);
+if (arena == NULL) return NULL;
+
+size = (size + ARENA_ALIGNMENT - 1) & ~(PCRE2_SIZE)(ARENA_ALIGNMENT - 1);
+arena->block = NULL;
+arena->size = 0;
+arena->used = 0;
+arena->last = 0;
+arena->needed = 0;
+arena->in_use = FALSE;
+
+if (size > 0)
+  {
+  arena->block = arena->memctl.malloc(size, arena->memctl.memory_data);
+  if (arena->block == NULL)
+    {
+    arena->memctl.free(arena, arena->memctl.memory_data);
+    return NULL;
+    }
+  arena->size = size;
+  }
+
+return arena;
+}
+
+
+
+/*************************************************
+*             Free a compile arena               *
+*************************************************/
+
+PCRE2_EXP_DEFN void PCRE2_CALL_CONVENTION
+pcre2_compile_arena_free(pcre2_compile_arena *arena)
+{
+if (arena != NULL)
+  {
+  if (arena->block != NULL)
+    arena->memctl.free(arena->block, arena->memctl.memory_data);
+  arena->memctl.free(arena, arena->memctl.memory_data);
+  }
+}
+
+
+
+/*************************************************
+*        Get the size of a compile arena         *
+*************************************************/
+
+PCRE2_EXP_DEFN PCRE2_SIZE PCRE2_CALL_CONVENTION
+pcre2_get_compile_arena_size(pcre2_compile_arena *arena)
+{
+return arena->size;
+}
+
+
+
+/*************************************************
+*       Temporary memory from a compile arena    *
+*************************************************/
+
+/* These two functions are installed as a memory control block for the
+duration of a compilation that uses an arena, so that all of the temporary
+vectors obtained by the compiler come from the arena's block. Requests are
+carved off the block in order; a request that does not fit is passed on to
+the arena's own allocator, but its size is remembered so that the block can be
+enlarged before the next compilation. Freeing memory in the block does nothing,
+except that the most recent allocation can be given back, which suits the
+allocate-use-free pattern of the class compiler. The block is reset at the
+start of each compilation.
+
+Arguments:
+  size         the number of bytes required
+  data         the arena
+
+Returns:       pointer to the memory or NULL if out of memory
+*/
+
+static void *
+arena_malloc(size_t size, void *data)
+{
+pcre2_real_compile_arena *arena = data;
+PCRE2_SIZE aligned = (size + ARENA_ALIGNMENT - 1) &
+  ~(PCRE2_SIZE)(ARENA_ALIGNMENT - 1);
+
+arena->needed += aligned;
+
+if (arena->block != NULL && aligned <= arena->size - arena->used)
+  {
+  void *yield = arena->block + arena->used;
+  arena->last = arena->used;
+  arena->used += aligned;
+  return yield;
+  }
+
+return arena->memctl.malloc(size, arena->memctl.memory_data);
+}
+
+static void
+arena_free(void *block, void *data)
+{
+pcre2_real_compile_arena *arena = data;
+uint8_t *p = block;
+
+if (arena->block != NULL && p >= arena->block &&
+    p < arena->block + arena->size)
+  {
+  if (p == arena->block + arena->last)
+    {
+    arena->needed -= arena->used - arena->last;
+    arena->used = arena->last;
+    }
+  return;
+  }
+
+arena->memctl.free(block, arena->memctl.memory_data);
+}
+
+
+
+/*************************************************
+*     Prepare a compile arena for a compilation  *
+*************************************************/
+
+/* If the previous compilation overflowed the block, it is enlarged to the
+largest total seen so far. Failure to get a bigger block is not an error; the
+old block is kept and overflowing requests go to the arena's allocator as
+before.
+
+Arguments:
+  arena        the arena
+  memctl       the memory control block to set up
+
+Returns:       nothing
+*/
+
+static void
+arena_reset(pcre2_real_compile_arena *arena, pcre2_memctl *memctl)
+{
+if (arena->needed > arena->size)
+  {
+  uint8_t *newblock = arena->memctl.malloc(arena->needed,
+    arena->memctl.memory_data);
+  if (newblock != NULL)
+    {
+    if (arena->block != NULL)
+      arena->memctl.free(arena->block, arena->memctl.memory_data);
+    arena->block = newblock;
+    arena->size = arena->needed;
+    }
+  }
+
+arena->used = 0;
+arena->last = 0;
+arena->needed = 0;
+arena->in_use = TRUE;
+
+memctl->malloc = arena_malloc;
+memctl->free = arena_free;
+memctl->memory_data = arena;
+}
+
+
+
 /*************************************************
 *         Read a number, possibly signed         *
 *************************************************/
@@ -5770,8 +5967,8 @@ while (ptr < ptrend)
         {
         uint32_t newsize = cb->named_group_list_size * 2;
         named_group *newspace =
-          cb->cx->memctl.malloc(newsize * sizeof(named_group),
-          cb->cx->memctl.memory_data);
+          cb->memctl->malloc(newsize * sizeof(named_group),
+          cb->memctl->memory_data);
         if (newspace == NULL)
           {
           errorcode = ERR21;
@@ -5781,8 +5978,8 @@ while (ptr < ptrend)
         memcpy(newspace, cb->named_groups,
           cb->named_group_list_size * sizeof(named_group));
         if (cb->named_group_list_size > NAMED_GROUP_LIST_SIZE)
-          cb->cx->memctl.free((void *)cb->named_groups,
-          cb->cx->memctl.memory_data);
+          cb->memctl->free((void *)cb->named_groups,
+          cb->memctl->memory_data);
         cb->named_groups = newspace;
         cb->named_group_list_size = newsize;
         }
@@ -6640,6 +6837,7 @@ for (;; pptr++)
     case META_SCS:
     bravalue = OP_ASSERT_SCS;
     cb->assert_depth += 1;
+    cb->captures_visible = TRUE;
     goto GROUP_PROCESS;
 
 
@@ -7199,6 +7397,7 @@ for (;; pptr++)
     /* Handle a numerical callout. */
 
     case META_CALLOUT_NUMBER:
+    cb->captures_visible = TRUE;
     code[0] = OP_CALLOUT;
     PUT(code, 1, pptr[1]);               /* Offset to next pattern item */
     PUT(code, 1 + LINK_SIZE, pptr[2]);   /* Length of next pattern item */
@@ -7216,6 +7415,7 @@ for (;; pptr++)
     this an overestimate, but it is not worth bothering about. */
 
     case META_CALLOUT_STRING:
+    cb->captures_visible = TRUE;
     if (lengthptr != NULL)
       {
       *lengthptr += pptr[3] + (1 + 4*LINK_SIZE);
@@ -8233,7 +8433,7 @@ for (;; pptr++)
         length_prevgroup += (args->size * (1 + IMM2_SIZE));
         pptr += args->skip_size;
         cb->first_data = args->header.next;
-        cb->cx->memctl.free(args, cb->cx->memctl.memory_data);
+        cb->memctl->free(args, cb->memctl->memory_data);
         }
       }
 
@@ -9106,6 +9306,45 @@ return TRUE;
 
 
 
+/*************************************************
+*     Check for a plain literal string pattern   *
+*************************************************/
+
+/* This is called to find out if a compiled pattern is nothing but a literal
+string, that is, a single bracket with one alternative, which contains only
+OP_CHAR items. Such a pattern matches exactly the same code units wherever it
+is tried.
+
+Arguments:
+  code        points to start of the compiled pattern
+  utf         TRUE in UTF mode
+
+Returns:      TRUE or FALSE
+*/
+
+static BOOL
+is_literal_string(PCRE2_SPTR code, BOOL utf)
+{
+PCRE2_SPTR cc = code + 1 + LINK_SIZE;
+
+if (*code != OP_BRA || *cc != OP_CHAR) return FALSE;
+
+while (*cc == OP_CHAR)
+  {
+  cc += 2;
+#ifdef SUPPORT_UNICODE
+  if (utf && HAS_EXTRALEN(cc[-1])) cc += GET_EXTRALEN(cc[-1]);
+#else
+  (void)utf;
+#endif
+  }
+
+return *cc == OP_KET && cc == code + GET(code, 1) &&
+  cc[1 + LINK_SIZE] == OP_END;
+}
+
+
+
 /*************************************************
 *   Scan compiled regex for recursion reference  *
 *************************************************/
@@ -10286,6 +10525,7 @@ BOOL has_lookbehind = FALSE;          /* Set TRUE if a lookbehind is found */
 BOOL zero_terminated;                 /* Set TRUE for zero-terminated pattern */
 pcre2_real_code *re = NULL;           /* What we will return */
 compile_block cb;                     /* "Static" compile-time data */
+pcre2_memctl arena_memctl;            /* For temporary memory from an arena */
 const uint8_t *tables;                /* Char tables base pointer */
 
 PCRE2_UCHAR null_str[1] = { 0xcd };   /* Dummy for handling null inputs */
@@ -10418,6 +10658,20 @@ if ((options & PCRE2_NO_START_OPTIMIZE) != 0)
 EXIT label. */
 
 
+/* ------------ Set up memory for temporary vectors -------------- */
+
+/* If there is a compile arena that is not already in use (by a compile in a
+recursion guard callback, for example), all the temporary memory comes from
+it. Otherwise the compile context's memory functions are used. */
+
+if (ccontext->arena != NULL && !ccontext->arena->in_use)
+  {
+  arena_reset(ccontext->arena, &arena_memctl);
+  cb.memctl = &arena_memctl;
+  }
+else cb.memctl = &ccontext->memctl;
+
+
 /* ------------ Initialize the "static" compile data -------------- */
 
 tables = (ccontext->tables != NULL)? ccontext->tables : PRIV(default_tables);
@@ -10436,6 +10690,7 @@ cb.erroroffset = 0;
 cb.external_flags = 0;
 cb.external_options = options;
 cb.groupinfo = stack_groupinfo;
+cb.captures_visible = FALSE;
 cb.had_recurse = FALSE;
 cb.lastcapture = 0;
 cb.max_lookbehind = 0;                               /* Max encountered */
@@ -10745,8 +11000,8 @@ parsed_size_needed += 1;  /* For the final META_END */
 
 if (parsed_size_needed > PARSED_PATTERN_DEFAULT_SIZE)
   {
-  uint32_t *heap_parsed_pattern = ccontext->memctl.malloc(
-    parsed_size_needed * sizeof(uint32_t), ccontext->memctl.memory_data);
+  uint32_t *heap_parsed_pattern = cb.memctl->malloc(
+    parsed_size_needed * sizeof(uint32_t), cb.memctl->memory_data);
   if (heap_parsed_pattern == NULL)
     {
     *errorptr = ERR21;
@@ -10776,8 +11031,8 @@ if (has_lookbehind)
   int loopcount = 0;
   if (cb.bracount >= GROUPINFO_DEFAULT_SIZE/2)
     {
-    cb.groupinfo = ccontext->memctl.malloc(
-      (2 * (cb.bracount + 1))*sizeof(uint32_t), ccontext->memctl.memory_data);
+    cb.groupinfo = cb.memctl->malloc(
+      (2 * (cb.bracount + 1))*sizeof(uint32_t), cb.memctl->memory_data);
     if (cb.groupinfo == NULL)
       {
       errorcode = ERR21;
@@ -10856,6 +11111,13 @@ cb.names_found and cb.name_entry_size. */
 re_blocksize =
   CU2BYTES((PCRE2_SIZE)cb.names_found * (PCRE2_SIZE)cb.name_entry_size);
 
+/* Reserve space for the bit-parallel DFA tables if they are requested. They
+follow the name table, aligned for 64-bit access; see BITPARALLEL_OFFSET. */
+
+if ((xoptions & PCRE2_EXTRA_DFA_BITPARALLEL) != 0)
+  re_blocksize = ((sizeof(pcre2_real_code) + re_blocksize + 7) & ~(size_t)7) -
+    sizeof(pcre2_real_code) + sizeof(dfa_bitparallel);
+
 #if defined SUPPORT_WIDE_CHARS
 if (cb.char_lists_size != 0)
   {
@@ -10898,6 +11160,7 @@ re->memctl = ccontext->memctl;
 re->tables = tables;
 re->executable_jit = NULL;
 memset(re->start_bitmap, 0, 32 * sizeof(uint8_t));
+memset(re->start_nibbles, 0, 32 * sizeof(uint8_t));
 re->blocksize = re_blocksize;
 re->code_start = re_blocksize - CU2BYTES(length);
 re->magic_number = MAGIC_NUMBER;
@@ -10914,6 +11177,7 @@ re->bsr_convention = bsr;
 re->newline_convention = newline;
 re->max_lookbehind = 0;
 re->minlength = 0;
+re->maxlength = UINT16_MAX;
 re->top_bracket = 0;
 re->top_backref = 0;
 re->name_entry_size = cb.name_entry_size;
@@ -11070,7 +11334,7 @@ if (errorcode == 0 && cb.had_recurse)
 at this stage. */
 
 #ifdef DEBUG_CALL_PRINTINT
-pcre2_printint(re, stderr, TRUE);
+pcre2_printint(re, stderr, TRUE, NULL);
 fprintf(stderr, "Length=%lu Used=%lu\n", length, usedlength);
 #endif
 
@@ -11269,6 +11533,41 @@ if ((optim_flags & PCRE2_OPTIM_START_OPTIMIZE) != 0)
   if (re->minlength < minminlength) re->minlength = minminlength;
   }   /* End of start-of-match optimizations. */
 
+/* If bit-parallel DFA matching was requested, set up its tables. This fails,
+leaving the flag unset, if the pattern is not simple enough. */
+
+if ((xoptions & PCRE2_EXTRA_DFA_BITPARALLEL) != 0 &&
+    PRIV(study_bitparallel)(re))
+  re->flags |= PCRE2_BITPARALLEL;
+
+/* Likewise, if one-pass matching was requested, check that the pattern is
+suitable. The check does not depend on the pattern being anchored, because
+pcre2_match() can be called with PCRE2_ANCHORED. */
+
+if ((xoptions & PCRE2_EXTRA_ONEPASS) != 0 &&
+    (re->overall_options & PCRE2_MATCH_INVALID_UTF) == 0 &&
+    PRIV(study_onepass)(re))
+  re->flags |= PCRE2_ONEPASS;
+
+/* Record whether the pattern is a plain literal string that may match
+anywhere. For such a pattern, pcre2_substitute() finds the second and
+subsequent matches of a global substitution by a simple search instead of
+calling pcre2_match(). */
+
+if ((re->overall_options & (PCRE2_ANCHORED|PCRE2_ENDANCHORED|PCRE2_FIRSTLINE|
+     PCRE2_MATCH_INVALID_UTF|PCRE2_USE_OFFSET_LIMIT)) == 0 &&
+    is_literal_string(codestart, utf))
+  re->flags |= PCRE2_LITERALPAT;
+
+/* Record whether the values of capture groups are never consulted while
+matching, that is, there are no back references, conditions that test a group,
+recursions (which save and restore the captures), scan substring assertions, or
+callouts (which can see them). In this case, pcre2_match() need not keep the
+captures when PCRE2_NO_CAPTURES is set. */
+
+if (cb.top_backref == 0 && !cb.had_recurse && !cb.captures_visible)
+  re->flags |= PCRE2_NOCAPREF;
+
 /* Control ends up here in all cases. When running under valgrind, make a
 pattern's terminating zero defined again. If memory was obtained for the parsed
 version of the pattern, free it before returning. Also free the list of named
@@ -11285,11 +11584,12 @@ EXIT:
 if (zero_terminated) VALGRIND_MAKE_MEM_DEFINED(pattern + patlen, CU2BYTES(1));
 #endif
 if (cb.parsed_pattern != stack_parsed_pattern)
-  ccontext->memctl.free(cb.parsed_pattern, ccontext->memctl.memory_data);
+  cb.memctl->free(cb.parsed_pattern, cb.memctl->memory_data);
 if (cb.named_group_list_size > NAMED_GROUP_LIST_SIZE)
-  ccontext->memctl.free((void *)cb.named_groups, ccontext->memctl.memory_data);
+  cb.memctl->free((void *)cb.named_groups, cb.memctl->memory_data);
 if (cb.groupinfo != stack_groupinfo)
-  ccontext->memctl.free((void *)cb.groupinfo, ccontext->memctl.memory_data);
+  cb.memctl->free((void *)cb.groupinfo, cb.memctl->memory_data);
+if (cb.memctl == &arena_memctl) ccontext->arena->in_use = FALSE;
 
 return re;    /* Will be NULL after an error */
 
@@ -11332,7 +11632,7 @@ if (cb.first_data != NULL)
   do
     {
     compile_data* next_data = current_data->next;
-    cb.cx->memctl.free(current_data, cb.cx->memctl.memory_data);
+    cb.memctl->free(current_data, cb.memctl->memory_data);
     current_data = next_data;
     }
   while (current_data != NULL);
@@ -11341,6 +11641,7 @@ if (cb.first_data != NULL)
 goto EXIT;
 }
 
+
 /* These #undefs are here to enable unity builds with CMake. */
 
 #undef NLBLOCK /* Block containing newline information */
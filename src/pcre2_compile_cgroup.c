@@ -378,7 +378,7 @@ if (PRIV(compile_process_capture_list)(pptr - 1, 0, errorcodeptr, cb) == 0)
 /* Align to bytes. Since the highest capture can
 be equal to bracount, +1 is added before the aligning. */
 size = (cb->bracount + 1 + 7) >> 3;
-captures = (uint8_t*)cb->cx->memctl.malloc(size, cb->cx->memctl.memory_data);
+captures = (uint8_t*)cb->memctl->malloc(size, cb->memctl->memory_data);
 if (captures == NULL)
   {
   *errorcodeptr = ERR21;
@@ -454,7 +454,7 @@ while (TRUE)
   break;
   }
 
-cb->cx->memctl.free(captures, cb->cx->memctl.memory_data);
+cb->memctl->free(captures, cb->memctl->memory_data);
 return pptr - 1;
 }
 
@@ -523,8 +523,8 @@ uint16_t tmp;
 size = PRIV(compile_process_capture_list)(pptr, offset, errorcodeptr, cb);
 if (size == 0) return FALSE;
 
-args = cb->cx->memctl.malloc(
-  sizeof(recurse_arguments) + size * sizeof(uint16_t), cb->cx->memctl.memory_data);
+args = cb->memctl->malloc(
+  sizeof(recurse_arguments) + size * sizeof(uint16_t), cb->memctl->memory_data);
 
 if (args == NULL)
   {
@@ -496,6 +496,85 @@ static const uint32_t char_list_starts[] = {
   XCL_CHAR_LIST_LOW_16_START,
 };
 
+/* Limits for adding an XCL_BMPMAP bitmap to the character lists. The binary
+search of a short list is fast enough, and a class whose characters are spread
+over many 256-character blocks would need too much memory. */
+
+#define BMPMAP_MIN_RANGES 12
+#define BMPMAP_MAX_LEAVES 32
+#define BMPMAP_MAX_SIZE \
+  (XCL_BMPMAP_INDEX_SIZE + BMPMAP_MAX_LEAVES * XCL_BMPMAP_LEAF_SIZE)
+
+/* Build the two-level bitmap of the characters from 0x100 to 0xffff for a
+sorted, merged list of ranges. The bitmap is built at the end of the map
+buffer, as it is laid out in front of the character lists. See the description
+of XCL_BMPMAP in pcre2_internal.h.
+
+Arguments:
+  ranges       start of the ranges
+  ranges_end   end of the ranges
+  map          buffer of BMPMAP_MAX_SIZE bytes
+
+Returns:       the size of the bitmap, or 0 if too many leaves are needed
+*/
+
+static size_t
+build_bmp_map(const uint32_t *ranges, const uint32_t *ranges_end, uint8_t *map)
+{
+uint8_t leaves[BMPMAP_MAX_LEAVES][XCL_BMPMAP_LEAF_SIZE];
+uint8_t *index;
+uint32_t leaf_count = 2;
+uint32_t block, i;
+size_t map_size;
+
+memset(leaves[0], 0, XCL_BMPMAP_LEAF_SIZE);
+memset(leaves[1], 0xff, XCL_BMPMAP_LEAF_SIZE);
+index = map + BMPMAP_MAX_SIZE - XCL_BMPMAP_INDEX_SIZE;
+index[0] = 0;    /* Characters < 0x100 never use the bitmap */
+
+while (ranges < ranges_end && ranges[1] < 0x100) ranges += 2;
+
+for (block = 1; block < XCL_BMPMAP_INDEX_SIZE; block++)
+  {
+  uint8_t leaf[XCL_BMPMAP_LEAF_SIZE];
+  uint32_t first = block << 8;
+  uint32_t last = first + 0xff;
+
+  memset(leaf, 0, XCL_BMPMAP_LEAF_SIZE);
+
+  while (ranges < ranges_end && ranges[0] <= last)
+    {
+    uint32_t c = (ranges[0] < first)? first : ranges[0];
+    uint32_t end = (ranges[1] > last)? last : ranges[1];
+
+    for (; c <= end; c++) leaf[(c >> 3) & 0x1f] |= (uint8_t)(1u << (c & 7));
+
+    /* A range that continues into the next block is processed again. */
+    if (ranges[1] > last) break;
+    ranges += 2;
+    }
+
+  for (i = 0; i < leaf_count; i++)
+    if (memcmp(leaf, leaves[i], XCL_BMPMAP_LEAF_SIZE) == 0) break;
+
+  if (i == leaf_count)
+    {
+    if (leaf_count >= BMPMAP_MAX_LEAVES) return 0;
+    memcpy(leaves[leaf_count++], leaf, XCL_BMPMAP_LEAF_SIZE);
+    }
+
+  index[block] = (uint8_t)i;
+  }
+
+for (i = 0; i < leaf_count; i++)
+  memcpy(index - (i + 1) * XCL_BMPMAP_LEAF_SIZE, leaves[i],
+    XCL_BMPMAP_LEAF_SIZE);
+
+map_size = XCL_BMPMAP_INDEX_SIZE + leaf_count * XCL_BMPMAP_LEAF_SIZE;
+PCRE2_ASSERT((map_size & 0x3) == 0);
+return map_size;
+}
+
 static class_ranges *
 compile_optimize_class(uint32_t *start_ptr, uint32_t options,
   uint32_t xoptions, compile_block *cb)
@@ -504,6 +583,7 @@ class_ranges* cranges;
 uint32_t *ptr;
 uint32_t *buffer;
 uint32_t *dst;
+uint32_t *bmp_end;
 uint32_t class_options = 0;
 size_t range_list_size = 0, total_size, i;
 uint32_t tmp1, tmp2;
@@ -511,6 +591,8 @@ const uint32_t *char_list_next;
 uint16_t *next_char;
 uint32_t char_list_start, char_list_end;
 uint32_t range_start, range_end;
+uint8_t bmp_map[BMPMAP_MAX_SIZE];
+size_t bmp_map_size = 0;
 
 #ifdef SUPPORT_UNICODE
 if (options & PCRE2_UTF)
@@ -534,14 +616,17 @@ if (xoptions & PCRE2_EXTRA_TURKISH_CASING)
 range_list_size = parse_class(start_ptr, class_options, NULL);
 PCRE2_ASSERT((range_list_size & 0x1) == 0);
 
-/* Allocate buffer. The total_size also represents the end of the buffer. */
+/* Allocate buffer. The total_size also represents the end of the buffer.
+Room for a bitmap is reserved when the class has enough ranges to get one. */
 
 total_size = range_list_size +
    ((range_list_size >= 2) ? CHAR_LIST_EXTRA_SIZE : 0);
+if (range_list_size >= 2 * BMPMAP_MIN_RANGES)
+  total_size += BMPMAP_MAX_SIZE / sizeof(uint32_t);
 
-cranges = cb->cx->memctl.malloc(
+cranges = cb->memctl->malloc(
   sizeof(class_ranges) + total_size * sizeof(uint32_t),
-  cb->cx->memctl.memory_data);
+  cb->memctl->memory_data);
 
 if (cranges == NULL) return NULL;
 
@@ -553,6 +638,7 @@ cranges->range_list_size = (uint16_t)range_list_size;
 cranges->char_lists_types = 0;
 cranges->char_lists_size = 0;
 cranges->char_lists_start = 0;
+cranges->char_lists_map_size = 0;
 
 if (range_list_size == 0) return cranges;
 
@@ -622,6 +708,16 @@ if (dst - ptr < (2 * (6 - 1)))
   return cranges;
   }
 
+/* Build a bitmap that replaces the search of the 16 bit lists when there are
+many ranges in them. It is built now, because the ranges are overwritten by
+the character lists. The ptr variable points to the first range that ends
+above 0xff. */
+
+bmp_end = ptr;
+while (bmp_end <= dst && bmp_end[0] <= 0xffff) bmp_end += 2;
+if (bmp_end - ptr >= 2 * BMPMAP_MIN_RANGES)
+  bmp_map_size = build_bmp_map(ptr, bmp_end, bmp_map);
+
 /* Compute character lists structures. */
 
 char_list_next = char_list_starts;
@@ -737,6 +833,17 @@ while (TRUE)
 if (dst[0] < XCL_CHAR_LIST_LOW_16_START) dst += 2;
 PCRE2_ASSERT((uint16_t*)dst <= next_char);
 
+/* The bitmap is stored in front of the lists. */
+
+if (bmp_map_size > 0)
+  {
+  PCRE2_ASSERT((uint8_t*)dst <= (uint8_t*)next_char - bmp_map_size);
+  next_char = (uint16_t*)((uint8_t*)next_char - bmp_map_size);
+  memcpy(next_char, bmp_map + BMPMAP_MAX_SIZE - bmp_map_size, bmp_map_size);
+  cranges->char_lists_types |= XCL_BMPMAP;
+  cranges->char_lists_map_size = (uint16_t)bmp_map_size;
+  }
+
 cranges->char_lists_size =
   (size_t)((uint8_t*)(buffer + total_size) - (uint8_t*)next_char);
 cranges->char_lists_start = (size_t)((uint8_t*)next_char - (uint8_t*)buffer);
@@ -1673,7 +1780,7 @@ if (cranges != NULL)
       }
 
     if (lengthptr == NULL)
-      cb->cx->memctl.free(cranges, cb->cx->memctl.memory_data);
+      cb->memctl->free(cranges, cb->memctl->memory_data);
     }
   }
 #endif /* SUPPORT_WIDE_CHARS */
@@ -1776,7 +1883,8 @@ if ((xclass_props & XCLASS_REQUIRED) != 0)
       {
       uint8_t *data;
 
-      PCRE2_ASSERT(cranges->char_lists_types <= XCL_TYPE_MASK);
+      PCRE2_ASSERT((cranges->char_lists_types & ~XCL_BMPMAP) <=
+        XCL_TYPE_MASK);
 #if PCRE2_CODE_UNIT_WIDTH == 8
       /* Encode as high / low bytes. */
       code[0] = (uint8_t)(XCL_LIST |
@@ -1800,10 +1908,12 @@ if ((xclass_props & XCLASS_REQUIRED) != 0)
         char_lists_size);
 
       /* Since character lists total size is less than MAX_PATTERN_SIZE,
-      their starting offset fits into a value which size is LINK_SIZE. */
+      their starting offset fits into a value which size is LINK_SIZE. The
+      offset is that of the lists, after any bitmap. */
 
       char_lists_size = cb->char_lists_size;
-      PUT(code, 0, (uint32_t)(char_lists_size >> 1));
+      PUT(code, 0,
+        (uint32_t)((char_lists_size - cranges->char_lists_map_size) >> 1));
       code += LINK_SIZE;
 
       /* If we added padding to align the list, initialize the bytes to
@@ -1818,7 +1928,7 @@ if ((xclass_props & XCLASS_REQUIRED) != 0)
       cb->char_lists_size =
         CLIST_ALIGN_TO(char_lists_size, sizeof(uint32_t));
 
-      cb->cx->memctl.free(cranges, cb->cx->memctl.memory_data);
+      cb->memctl->free(cranges, cb->memctl->memory_data);
       }
     }
 
@@ -0,0 +1,297 @@
+/*************************************************
+*      Perl-Compatible Regular Expressions       *
+*************************************************/
+
+/* PCRE is a library of functions to support regular expressions whose syntax
+and semantics are as close as possible to those of the Perl 5 language.
+
+                       Written by Philip Hazel
+     Original API code Copyright (c) 1997-2012 University of Cambridge
+          New API code Copyright (c) 2016-2024 University of Cambridge
+
+-----------------------------------------------------------------------------
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice,
+      this list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+
+    * Neither the name of the University of Cambridge nor the names of its
+      contributors may be used to endorse or promote products derived from
+      this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+POSSIBILITY OF SUCH DAMAGE.
+-----------------------------------------------------------------------------
+*/
+
+
+/* This module contains pcre2_compile_many(), which compiles a set of patterns,
+spreading the work over several threads when the platform supports them. It is
+kept apart from pcre2_compile.c so that the system's thread header is included
+only here. Threads are used on Windows, and elsewhere when POSIX threads were
+found when PCRE2 was configured (they are always required for JIT support on
+such systems). Otherwise all the patterns are compiled in the calling thread. */
+
+
+#include "pcre2_internal.h"
+
+#if defined _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#define COMPILE_MANY_THREADS
+#elif defined HAVE_PTHREAD
+#include <pthread.h>
+#define COMPILE_MANY_THREADS
+#endif
+
+
+/* The arguments that are common to all the workers. */
+
+typedef struct compile_many_job {
+  pcre2_code **codes;
+  PCRE2_SPTR *patterns;
+  const PCRE2_SIZE *lengths;
+  const uint32_t *options;
+  int *errorcodes;
+  PCRE2_SIZE *erroroffsets;
+  uint32_t number_of_codes;
+  uint32_t jit_options;
+} compile_many_job;
+
+/* Each worker compiles every step'th pattern, starting at first, using its own
+copy of the compile context and its own compile arena. */
+
+typedef struct compile_many_worker {
+  compile_many_job *job;
+  pcre2_real_compile_context context;
+  uint32_t first;
+  uint32_t step;
+  int32_t compiled;
+#if defined _WIN32
+  HANDLE thread;
+#elif defined HAVE_PTHREAD
+  pthread_t thread;
+#endif
+  BOOL started;
+} compile_many_worker;
+
+
+
+/*************************************************
+*      Compile one worker's share of patterns    *
+*************************************************/
+
+/* A failure to JIT-compile a pattern is not reported, because the pattern can
+still be matched by the interpreter.
+
+Argument:   points to the worker's data block
+Returns:    nothing; the count of compiled patterns is left in the block
+*/
+
+static void
+compile_many_run(compile_many_worker *worker)
+{
+compile_many_job *job = worker->job;
+uint32_t i;
+
+for (i = worker->first; i < job->number_of_codes; i += worker->step)
+  {
+  int errorcode;
+  PCRE2_SIZE erroroffset;
+
+  job->codes[i] = pcre2_compile(job->patterns[i],
+    (job->lengths == NULL)? PCRE2_ZERO_TERMINATED : job->lengths[i],
+    (job->options == NULL)? 0 : job->options[i], &errorcode, &erroroffset,
+    &worker->context);
+
+  if (job->codes[i] != NULL)
+    {
+    worker->compiled++;
+    if (job->jit_options != 0)
+      (void)pcre2_jit_compile(job->codes[i], job->jit_options);
+    }
+
+  if (job->errorcodes != NULL) job->errorcodes[i] = errorcode;
+  if (job->erroroffsets != NULL) job->erroroffsets[i] = erroroffset;
+  }
+}
+
+
+#ifdef COMPILE_MANY_THREADS
+/*************************************************
+*       Thread start and wait functions          *
+*************************************************/
+
+#if defined _WIN32
+static DWORD WINAPI
+compile_many_thread(LPVOID arg)
+{
+compile_many_run((compile_many_worker *)arg);
+return 0;
+}
+
+static BOOL
+compile_many_start(compile_many_worker *worker)
+{
+worker->thread = CreateThread(NULL, 0, compile_many_thread, worker, 0, NULL);
+return worker->thread != NULL;
+}
+
+static void
+compile_many_wait(compile_many_worker *worker)
+{
+(void)WaitForSingleObject(worker->thread, INFINITE);
+(void)CloseHandle(worker->thread);
+}
+
+#else  /* POSIX threads */
+static void *
+compile_many_thread(void *arg)
+{
+compile_many_run((compile_many_worker *)arg);
+return NULL;
+}
+
+static BOOL
+compile_many_start(compile_many_worker *worker)
+{
+return pthread_create(&worker->thread, NULL, compile_many_thread, worker) == 0;
+}
+
+static void
+compile_many_wait(compile_many_worker *worker)
+{
+(void)pthread_join(worker->thread, NULL);
+}
+#endif  /* _WIN32 */
+#endif  /* COMPILE_MANY_THREADS */
+
+
+
+/*************************************************
+*   External function to compile many patterns   *
+*************************************************/
+
+/* This function compiles a set of patterns with the same compile context, and
+optionally JIT-compiles each one that compiles successfully. The patterns are
+shared out between the calling thread and up to number_of_threads - 1 others.
+The caller's compile context and its character tables are only read; each
+worker has a private copy of the context with its own compile arena, so the
+context's own arena is not used. If a thread cannot be created, its share of
+the patterns is compiled in the calling thread.
+
+Arguments:
+  codes             vector in which to return the compiled patterns
+  number_of_codes   the number of patterns
+  patterns          vector of patterns
+  lengths           vector of pattern lengths, or NULL if all are
+                      zero-terminated
+  options           vector of option bits, or NULL for no options
+  errorcodes        vector in which to return error codes, or NULL
+  erroroffsets      vector in which to return error offsets, or NULL
+  jit_options       options for pcre2_jit_compile(), or zero for no JIT
+  number_of_threads maximum number of threads to use; 0 is treated as 1
+  ccontext          points to a compile context or is NULL
+
+Returns:            the number of patterns that compiled successfully, or
+                    PCRE2_ERROR_NULL if codes or patterns is NULL
+*/
+
+PCRE2_EXP_DEFN int32_t PCRE2_CALL_CONVENTION
+pcre2_compile_many(pcre2_code **codes, uint32_t number_of_codes,
+  PCRE2_SPTR *patterns, const PCRE2_SIZE *lengths, const uint32_t *options,
+  int *errorcodes, PCRE2_SIZE *erroroffsets, uint32_t jit_options,
+  uint32_t number_of_threads, pcre2_compile_context *ccontext)
+{
+int32_t yield = 0;
+uint32_t i;
+compile_many_job job;
+compile_many_worker one_worker;
+compile_many_worker *workers = &one_worker;
+
+if (codes == NULL || patterns == NULL) return PCRE2_ERROR_NULL;
+if (number_of_codes == 0) return 0;
+
+if (ccontext == NULL)
+  ccontext = (pcre2_compile_context *)(&PRIV(default_compile_context));
+
+job.codes = codes;
+job.patterns = patterns;
+job.lengths = lengths;
+job.options = options;
+job.errorcodes = errorcodes;
+job.erroroffsets = erroroffsets;
+job.number_of_codes = number_of_codes;
+job.jit_options = jit_options;
+
+#ifdef COMPILE_MANY_THREADS
+if (number_of_threads > number_of_codes) number_of_threads = number_of_codes;
+if (number_of_threads > 1)
+  {
+  workers = ccontext->memctl.malloc(
+    number_of_threads * sizeof(compile_many_worker),
+    ccontext->memctl.memory_data);
+  if (workers == NULL) workers = &one_worker;
+  }
+#endif
+if (workers == &one_worker) number_of_threads = 1;
+
+/* Failure to get an arena is not an error; that worker's compilations just
+get their memory separately. */
+
+for (i = 0; i < number_of_threads; i++)
+  {
+  compile_many_worker *worker = workers + i;
+  worker->job = &job;
+  worker->context = *ccontext;
+  worker->context.arena = pcre2_compile_arena_create(0,
+    (pcre2_general_context *)(&ccontext->memctl));
+  worker->first = i;
+  worker->step = number_of_threads;
+  worker->compiled = 0;
+  worker->started = FALSE;
+  }
+
+#ifdef COMPILE_MANY_THREADS
+for (i = 1; i < number_of_threads; i++)
+  workers[i].started = compile_many_start(workers + i);
+#endif
+
+compile_many_run(workers);
+
+for (i = 1; i < number_of_threads; i++)
+  {
+#ifdef COMPILE_MANY_THREADS
+  if (workers[i].started) compile_many_wait(workers + i); else
+#endif
+  compile_many_run(workers + i);
+  }
+
+for (i = 0; i < number_of_threads; i++)
+  {
+  yield += workers[i].compiled;
+  pcre2_compile_arena_free(workers[i].context.arena);
+  }
+
+if (workers != &one_worker)
+  ccontext->memctl.free(workers, ccontext->memctl.memory_data);
+return yield;
+}
+
+/* End of pcre2_compile_many.c */
@@ -88,6 +88,7 @@ if (where == NULL)  /* Requests a length */
     case PCRE2_CONFIG_NEVER_BACKSLASH_C:
     case PCRE2_CONFIG_NEWLINE:
     case PCRE2_CONFIG_PARENSLIMIT:
+    case PCRE2_CONFIG_PROFILE:
     case PCRE2_CONFIG_STACKRECURSE:    /* Obsolete */
     case PCRE2_CONFIG_TABLES_LENGTH:
     case PCRE2_CONFIG_UNICODE:
@@ -184,6 +185,14 @@ switch (what)
   *((uint32_t *)where) = PARENS_NEST_LIMIT;
   break;
 
+  case PCRE2_CONFIG_PROFILE:
+#ifdef SUPPORT_PROFILE
+  *((uint32_t *)where) = 1;
+#else
+  *((uint32_t *)where) = 0;
+#endif
+  break;
+
   /* This is now obsolete. The stack is no longer used via recursion for
   handling backtracking in pcre2_match(). */
 
@@ -131,6 +131,7 @@ pcre2_compile_context PRIV(default_compile_context) = {
   NULL,                                      /* Stack guard */
   NULL,                                      /* Stack guard data */
   PRIV(default_tables),                      /* Character tables */
+  NULL,                                      /* Compile arena */
   PCRE2_UNSET,                               /* Max pattern length */
   PCRE2_UNSET,                               /* Max pattern compiled length */
   BSR_DEFAULT,                               /* Backslash R default */
@@ -172,6 +173,14 @@ pcre2_match_context PRIV(default_match_context) = {
   NULL,          /* Substitute callout data */
   NULL,          /* Substitute case callout function */
   NULL,          /* Substitute case callout data */
+  NULL,          /* Substitute output function */
+  NULL,          /* Substitute output data */
+  NULL,          /* Frame pool */
+  NULL,          /* DFA workspace */
+#ifdef SUPPORT_PROFILE
+  NULL,          /* Profile counts */
+  0,             /* Profile size */
+#endif
   PCRE2_UNSET,   /* Offset limit */
   HEAP_LIMIT,
   MATCH_LIMIT,
@@ -322,6 +331,14 @@ data. */
 
 /* ------------ Compile context ------------ */
 
+PCRE2_EXP_DEFN int PCRE2_CALL_CONVENTION
+pcre2_set_compile_arena(pcre2_compile_context *ccontext,
+  pcre2_compile_arena *arena)
+{
+ccontext->arena = arena;
+return 0;
+}
+
 PCRE2_EXP_DEFN int PCRE2_CALL_CONVENTION
 pcre2_set_character_tables(pcre2_compile_context *ccontext,
   const uint8_t *tables)
@@ -473,6 +490,51 @@ mcontext->substitute_case_callout_data = substitute_case_callout_data;
 return 0;
 }
 
+PCRE2_EXP_DEFN int PCRE2_CALL_CONVENTION
+pcre2_set_substitute_output(pcre2_match_context *mcontext,
+  int (*substitute_output)(PCRE2_SPTR, PCRE2_SIZE, void *),
+  void *substitute_output_data)
+{
+mcontext->substitute_output = substitute_output;
+mcontext->substitute_output_data = substitute_output_data;
+return 0;
+}
+
+PCRE2_EXP_DEFN int PCRE2_CALL_CONVENTION
+pcre2_set_dfa_workspace(pcre2_match_context *mcontext,
+  pcre2_dfa_workspace *dfa_workspace)
+{
+mcontext->dfa_workspace = dfa_workspace;
+return 0;
+}
+
+PCRE2_EXP_DEFN int PCRE2_CALL_CONVENTION
+pcre2_set_frame_pool(pcre2_match_context *mcontext,
+  pcre2_frame_pool *frame_pool)
+{
+mcontext->frame_pool = frame_pool;
+return 0;
+}
+
+/* Profiling is available only if it was enabled when PCRE2 was built. The
+vector is not cleared here, so counts accumulate over a sequence of matches. */
+
+PCRE2_EXP_DEFN int PCRE2_CALL_CONVENTION
+pcre2_set_profile(pcre2_match_context *mcontext, PCRE2_SIZE *counts,
+  PCRE2_SIZE size)
+{
+#ifdef SUPPORT_PROFILE
+mcontext->profile_counts = counts;
+mcontext->profile_size = size;
+return 0;
+#else
+(void)mcontext;
+(void)counts;
+(void)size;
+return PCRE2_ERROR_BADOPTION;
+#endif
+}
+
 PCRE2_EXP_DEFN int PCRE2_CALL_CONVENTION
 pcre2_set_heap_limit(pcre2_match_context *mcontext, uint32_t limit)
 {
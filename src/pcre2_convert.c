@@ -620,6 +620,207 @@ switch (class_index)
 return ((cbits + cbit)[c/8] & (1u << (c&7))) != 0;
 }
 
+
+/* When a glob is compiled for pcre2_glob_match(), the converter is also given
+a builder, into which it puts a simple program alongside the regular
+expression text. The program is a vector of uint32_t items, each starting with
+one of the GLOB_xxx opcodes below. A first pass just counts the length. */
+
+enum { GLOB_END,            /* End of subject required */
+       GLOB_END_ANY,        /* Any remainder of the subject is accepted */
+       GLOB_CHAR,           /* A code unit; followed by its value */
+       GLOB_ANY,            /* Any character */
+       GLOB_ANY_NOSEP,      /* Any character except the separator */
+       GLOB_CLASS,          /* A character class; see below */
+       GLOB_STAR,           /* Any characters */
+       GLOB_STAR_NOSEP,     /* Any characters except the separator */
+       GLOB_STARSTAR,       /* Any characters, returned to after later stars */
+       GLOB_STARSTAR_DIRS   /* Empty, or any characters ending in a separator */
+     };
+
+/* A GLOB_CLASS item is followed by the length of the whole item, a flags
+word, an 8-word bitmap for characters less than 256, and pairs of values
+giving ranges of characters greater than 255. The bitmap takes account of
+negation; the ranges do not. */
+
+#define GLOB_CLASS_LENGTH   1
+#define GLOB_CLASS_FLAGS    2
+#define GLOB_CLASS_MAP      3
+#define GLOB_CLASS_RANGES   11
+
+#define GLOB_CLASS_NEGATED  0x0001u
+
+/* Values for the flags and last_unit fields of a compiled glob. */
+
+#define GLOB_FLAG_UTF       0x0001u
+#define GLOB_NO_LAST_UNIT   0xffffffffu
+
+/* Because a glob has no alternatives, every literal in it must be present in
+a matching subject. The builder remembers the longest run of literals, and the
+end of the subject must be the last literal if nothing follows it. */
+
+typedef struct glob_builder {
+  uint32_t *code;                       /* program, or NULL if sizing */
+  uint32_t length;                      /* length used so far */
+  uint32_t class_start;                 /* offset of the current class */
+  uint32_t last_unit;                   /* required last code unit */
+  uint32_t run_start;                   /* offset of the current literal run */
+  uint32_t run_length;                  /* length of the current run */
+  uint32_t literal_offset;              /* offset of the longest run */
+  uint32_t literal_length;              /* length of the longest run */
+} glob_builder;
+
+
+/* Add an item to a glob program.
+
+Arguments:
+  gb             the builder, or NULL
+  op             the opcode
+  value          its value, for GLOB_CHAR only
+*/
+
+static void
+glob_add_op(glob_builder *gb, uint32_t op, uint32_t value)
+{
+if (gb == NULL) return;
+
+if (op != GLOB_CHAR)
+  {
+  if (op == GLOB_END && gb->run_length > 0 && gb->code != NULL)
+    gb->last_unit = gb->code[gb->length - 1];
+  gb->run_length = 0;
+  }
+else
+  {
+  if (gb->run_length++ == 0) gb->run_start = gb->length;
+  if (gb->run_length > gb->literal_length)
+    {
+    gb->literal_offset = gb->run_start;
+    gb->literal_length = gb->run_length;
+    }
+  }
+
+if (gb->code != NULL) gb->code[gb->length] = op;
+gb->length++;
+
+if (op == GLOB_CHAR)
+  {
+  if (gb->code != NULL) gb->code[gb->length] = value;
+  gb->length++;
+  }
+}
+
+
+/* Start a character class in a glob program.
+
+Arguments:
+  gb             the builder, or NULL
+*/
+
+static void
+glob_class_start(glob_builder *gb)
+{
+if (gb == NULL) return;
+
+gb->class_start = gb->length;
+gb->run_length = 0;
+if (gb->code != NULL)
+  {
+  uint32_t *item = gb->code + gb->length;
+  item[0] = GLOB_CLASS;
+  item[GLOB_CLASS_FLAGS] = 0;
+  memset(item + GLOB_CLASS_MAP, 0, 8 * sizeof(uint32_t));
+  }
+gb->length += GLOB_CLASS_RANGES;
+}
+
+
+/* Add a range of characters to the current class.
+
+Arguments:
+  gb             the builder, or NULL
+  from           the first character
+  to             the last character
+*/
+
+static void
+glob_class_add_range(glob_builder *gb, uint32_t from, uint32_t to)
+{
+if (gb == NULL) return;
+
+if (gb->code != NULL)
+  {
+  uint32_t *map = gb->code + gb->class_start + GLOB_CLASS_MAP;
+  for (uint32_t c = from; c <= to && c < 256; c++)
+    map[c/32] |= 1u << (c%32);
+  }
+
+if (to < 256) return;
+if (from < 256) from = 256;
+
+if (gb->code != NULL)
+  {
+  gb->code[gb->length] = from;
+  gb->code[gb->length + 1] = to;
+  }
+gb->length += 2;
+}
+
+
+/* Add the characters of a POSIX class to the current class. Only characters
+less than 256 can be in a class.
+
+Arguments:
+  gb             the builder, or NULL
+  class_index    the class index
+*/
+
+static void
+glob_class_add_posix(glob_builder *gb, int class_index)
+{
+uint32_t *map;
+
+if (gb == NULL || gb->code == NULL) return;
+
+map = gb->code + gb->class_start + GLOB_CLASS_MAP;
+for (uint32_t c = 0; c < 256; c++)
+  if (convert_glob_char_in_class(class_index, (PCRE2_UCHAR)c))
+    map[c/32] |= 1u << (c%32);
+}
+
+
+/* Finish the current class. Unless the separator may be matched by
+wildcards, a class never matches it.
+
+Arguments:
+  gb             the builder, or NULL
+  is_negative    TRUE for a negated class
+  separator      glob separator
+  no_wildsep     TRUE if wildcards may match the separator
+*/
+
+static void
+glob_class_end(glob_builder *gb, BOOL is_negative, PCRE2_UCHAR separator,
+  BOOL no_wildsep)
+{
+uint32_t *item;
+
+if (gb == NULL || gb->code == NULL) return;
+
+item = gb->code + gb->class_start;
+item[GLOB_CLASS_LENGTH] = gb->length - gb->class_start;
+
+if (is_negative)
+  {
+  item[GLOB_CLASS_FLAGS] |= GLOB_CLASS_NEGATED;
+  for (int i = 0; i < 8; i++)
+    item[GLOB_CLASS_MAP + i] = ~item[GLOB_CLASS_MAP + i];
+  }
+
+if (!no_wildsep)
+  item[GLOB_CLASS_MAP + separator/32] &= ~(1u << (separator%32));
+}
+
 /* Parse a range of characters.
 
 Arguments:
@@ -636,7 +837,7 @@ Returns:         0 => success
 static int
 convert_glob_parse_range(PCRE2_SPTR *from, PCRE2_SPTR pattern_end,
   pcre2_output_context *out, BOOL utf, PCRE2_UCHAR separator,
-  BOOL with_escape, PCRE2_UCHAR escape, BOOL no_wildsep)
+  BOOL with_escape, PCRE2_UCHAR escape, BOOL no_wildsep, glob_builder *gb)
 {
 BOOL is_negative = FALSE;
 BOOL separator_seen = FALSE;
@@ -654,6 +855,8 @@ if (pattern >= pattern_end)
   return PCRE2_ERROR_MISSING_SQUARE_BRACKET;
   }
 
+glob_class_start(gb);
+
 if (*pattern == CHAR_EXCLAMATION_MARK
     || *pattern == CHAR_CIRCUMFLEX_ACCENT)
   {
@@ -679,9 +882,10 @@ if (*pattern == CHAR_EXCLAMATION_MARK
       len++;
       }
     out->out_str[len] = (uint8_t) separator;
+    len++;
     }
 
-  convert_glob_write_str(out, len + 1);
+  convert_glob_write_str(out, len);
   }
 else
   convert_glob_write(out, CHAR_LEFT_SQUARE_BRACKET);
@@ -694,6 +898,8 @@ if (*pattern == CHAR_RIGHT_SQUARE_BRACKET)
   out->out_str[0] = CHAR_BACKSLASH;
   out->out_str[1] = CHAR_RIGHT_SQUARE_BRACKET;
   convert_glob_write_str(out, 2);
+  glob_class_add_range(gb, CHAR_RIGHT_SQUARE_BRACKET,
+    CHAR_RIGHT_SQUARE_BRACKET);
   has_prev_c = TRUE;
   prev_c = CHAR_RIGHT_SQUARE_BRACKET;
   pattern++;
@@ -720,6 +926,7 @@ while (pattern < pattern_end)
       convert_glob_write(out, CHAR_RIGHT_PARENTHESIS);
       }
 
+    glob_class_end(gb, is_negative, separator, no_wildsep);
     *from = pattern;
     return 0;
     }
@@ -734,6 +941,7 @@ while (pattern < pattern_end)
     if (class_index != 0)
       {
       pattern = *from;
+      glob_class_add_posix(gb, class_index);
 
       has_prev_c = FALSE;
       prev_c = 0;
@@ -772,6 +980,7 @@ while (pattern < pattern_end)
       }
 
     if (prev_c < separator && separator < c) separator_seen = TRUE;
+    glob_class_add_range(gb, prev_c, c);
 
     has_prev_c = FALSE;
     prev_c = 0;
@@ -791,10 +1000,11 @@ while (pattern < pattern_end)
     }
 
   if (c == CHAR_LEFT_SQUARE_BRACKET || c == CHAR_RIGHT_SQUARE_BRACKET ||
-      c == CHAR_BACKSLASH || c == CHAR_MINUS)
+      c == CHAR_BACKSLASH || c == CHAR_MINUS || c == CHAR_CIRCUMFLEX_ACCENT)
     convert_glob_write(out, CHAR_BACKSLASH);
 
   if (c == separator) separator_seen = TRUE;
+  glob_class_add_range(gb, c, c);
 
   do convert_glob_write(out, *char_start++); while (char_start < pattern);
   }
@@ -838,6 +1048,7 @@ Arguments:
   bufflenptr     where to put the used length
   dummyrun       TRUE if a dummy run
   ccontext       the convert context
+  gb             builder for a glob program, or NULL
 
 Returns:         0 => success
                 !0 => error code
@@ -846,7 +1057,8 @@ Returns:         0 => success
 static int
 convert_glob(uint32_t options, PCRE2_SPTR pattern, PCRE2_SIZE plength,
   BOOL utf, PCRE2_UCHAR *use_buffer, PCRE2_SIZE use_length,
-  PCRE2_SIZE *bufflenptr, BOOL dummyrun, pcre2_convert_context *ccontext)
+  PCRE2_SIZE *bufflenptr, BOOL dummyrun, pcre2_convert_context *ccontext,
+  glob_builder *gb)
 {
 pcre2_output_context out;
 PCRE2_SPTR pattern_start = pattern;
@@ -939,7 +1151,13 @@ while (pattern < pattern_end)
 
       if (is_start)
         {
-        if (*pattern != separator) continue;
+        if (*pattern != separator)
+          {
+          glob_add_op(gb, GLOB_STARSTAR, 0);
+          continue;
+          }
+
+        glob_add_op(gb, GLOB_STARSTAR_DIRS, 0);
 
         out.out_str[0] = CHAR_LEFT_PARENTHESIS;
         out.out_str[1] = CHAR_QUESTION_MARK;
@@ -964,9 +1182,12 @@ while (pattern < pattern_end)
         out.out_str[1] = CHAR_ASTERISK;
         out.out_str[2] = CHAR_QUESTION_MARK;
         convert_glob_write_str(&out, 3);
+        glob_add_op(gb, GLOB_STARSTAR, 0);
         continue;
         }
 
+      glob_add_op(gb, GLOB_STARSTAR_DIRS, 0);
+
       out.out_str[0] = CHAR_LEFT_PARENTHESIS;
       out.out_str[1] = CHAR_QUESTION_MARK;
       out.out_str[2] = CHAR_COLON;
@@ -1002,7 +1223,11 @@ while (pattern < pattern_end)
         }
 
       /* Start check must be after the end check. */
-      if (is_start) continue;
+      if (is_start)
+        {
+        glob_add_op(gb, GLOB_STAR, 0);
+        continue;
+        }
       }
 
     if (!is_start)
@@ -1029,6 +1254,7 @@ while (pattern < pattern_end)
     if (pattern >= pattern_end)
       out.out_str[1] = CHAR_PLUS;
     convert_glob_write_str(&out, 2);
+    glob_add_op(gb, no_wildsep? GLOB_STAR : GLOB_STAR_NOSEP, 0);
     continue;
     }
 
@@ -1038,13 +1264,14 @@ while (pattern < pattern_end)
       convert_glob_write(&out, CHAR_DOT);
     else
       convert_glob_print_wildcard(&out, separator, with_escape);
+    glob_add_op(gb, no_wildsep? GLOB_ANY : GLOB_ANY_NOSEP, 0);
     continue;
     }
 
   if (c == CHAR_LEFT_SQUARE_BRACKET)
     {
     result = convert_glob_parse_range(&pattern, pattern_end,
-      &out, utf, separator, with_escape, escape, no_wildsep);
+      &out, utf, separator, with_escape, escape, no_wildsep, gb);
     if (result != 0) break;
     continue;
     }
@@ -1063,6 +1290,7 @@ while (pattern < pattern_end)
     convert_glob_write(&out, CHAR_BACKSLASH);
 
   convert_glob_write(&out, c);
+  glob_add_op(gb, GLOB_CHAR, c);
   }
 
 if (result == 0)
@@ -1074,6 +1302,8 @@ if (result == 0)
     convert_glob_write_str(&out, 2);
     }
 
+  glob_add_op(gb, no_slash_z? GLOB_END_ANY : GLOB_END, 0);
+
   if (in_atomic)
     convert_glob_write(&out, CHAR_RIGHT_PARENTHESIS);
 
@@ -1189,7 +1419,7 @@ for (int i = 0; i < 2; i++)
     {
     case PCRE2_CONVERT_GLOB:
     rc = convert_glob(options & ~PCRE2_CONVERT_GLOB, pattern, plength, utf,
-      use_buffer, use_length, bufflenptr, dummyrun, ccontext);
+      use_buffer, use_length, bufflenptr, dummyrun, ccontext, NULL);
     break;
 
     case PCRE2_CONVERT_POSIX_BASIC:
@@ -1260,4 +1490,599 @@ if (converted != NULL)
   }
 }
 
+
+/*************************************************
+*           Match a compiled glob program        *
+*************************************************/
+
+/* This is the classic wildcard matching algorithm, extended for separators
+and for "**". It matches greedily from the left, and when an item fails, it
+returns to the most recent star, which absorbs one more character. A star that
+cannot absorb the next character (because it is the separator) hands over to
+the most recent "**". A new star or "**" replaces the previous one, so there is
+no recursion and no stack. This gives the same results as the regular
+expression that pcre2_pattern_convert() generates, whose (*COMMIT) verbs and
+atomic groups likewise prevent returning to all but the latest stars.
+
+Arguments:
+  code           the program
+  subject        the subject
+  end_subject    end of the subject
+  utf            TRUE if in UTF mode
+  separator      glob separator
+
+Returns:         TRUE if matched
+*/
+
+#ifdef SUPPORT_UNICODE
+#define GLOB_SKIPCHAR(eptr) \
+  { eptr++; if (utf) { FORWARDCHARTEST(eptr, end_subject); } }
+#else
+#define GLOB_SKIPCHAR(eptr) eptr++
+#endif
+
+static BOOL
+glob_exec(const uint32_t *code, PCRE2_SPTR subject, PCRE2_SPTR end_subject,
+  BOOL utf, uint32_t separator)
+{
+const uint32_t *pc = code;
+const uint32_t *star_pc = NULL;
+const uint32_t *starstar_pc = NULL;
+PCRE2_SPTR eptr = subject;
+PCRE2_SPTR star_eptr = NULL;
+PCRE2_SPTR starstar_eptr = NULL;
+BOOL star_nosep = FALSE;
+BOOL starstar_dirs = FALSE;
+
+(void)utf; /* Avoid compiler warning. */
+
+for (;;)
+  {
+  uint32_t c;
+
+  switch (*pc)
+    {
+    case GLOB_END_ANY:
+    return TRUE;
+
+    case GLOB_END:
+    if (eptr >= end_subject) return TRUE;
+    break;
+
+    case GLOB_CHAR:
+    if (eptr < end_subject && *eptr == pc[1])
+      {
+      eptr++;
+      pc += 2;
+      continue;
+      }
+    break;
+
+    case GLOB_ANY_NOSEP:
+    if (eptr < end_subject && *eptr == separator) break;
+    /* Fall through */
+
+    case GLOB_ANY:
+    if (eptr < end_subject)
+      {
+      GLOB_SKIPCHAR(eptr);
+      pc++;
+      continue;
+      }
+    break;
+
+    case GLOB_CLASS:
+    if (eptr < end_subject)
+      {
+      PCRE2_SPTR nptr = eptr;
+      BOOL matched;
+
+      GETCHARINCTEST(c, nptr);
+      if (c < 256)
+        matched = (pc[GLOB_CLASS_MAP + c/32] & (1u << (c%32))) != 0;
+      else
+        {
+        const uint32_t *range = pc + GLOB_CLASS_RANGES;
+        const uint32_t *range_end = pc + pc[GLOB_CLASS_LENGTH];
+
+        matched = FALSE;
+        for (; range < range_end; range += 2)
+          if (c >= range[0] && c <= range[1]) { matched = TRUE; break; }
+        if ((pc[GLOB_CLASS_FLAGS] & GLOB_CLASS_NEGATED) != 0)
+          matched = !matched;
+        }
+
+      if (matched)
+        {
+        eptr = nptr;
+        pc += pc[GLOB_CLASS_LENGTH];
+        continue;
+        }
+      }
+    break;
+
+    case GLOB_STAR:
+    case GLOB_STAR_NOSEP:
+    star_nosep = *pc++ == GLOB_STAR_NOSEP;
+    star_pc = pc;
+    star_eptr = eptr;
+    continue;
+
+    case GLOB_STARSTAR:
+    case GLOB_STARSTAR_DIRS:
+    starstar_dirs = *pc++ == GLOB_STARSTAR_DIRS;
+    starstar_pc = pc;
+    starstar_eptr = eptr;
+    star_pc = NULL;
+    continue;
+
+    /* LCOV_EXCL_START */
+    default:
+    PCRE2_DEBUG_UNREACHABLE();
+    return FALSE;
+    /* LCOV_EXCL_STOP */
+    }
+
+  /* The current item has failed. Let the latest star absorb one more
+  character. When it is followed by a literal, skip straight to the next
+  occurrence of that code unit. The separator is always ASCII, so it can be
+  checked code unit by code unit, even in UTF mode. */
+
+  if (star_pc != NULL)
+    {
+    if (*star_pc == GLOB_CHAR)
+      {
+      uint32_t next = star_pc[1];
+      BOOL found = FALSE;
+
+      while (star_eptr < end_subject &&
+             (!star_nosep || *star_eptr != separator))
+        {
+        if (++star_eptr < end_subject && *star_eptr == next)
+          {
+          found = TRUE;
+          break;
+          }
+        }
+
+      if (found)
+        {
+        eptr = star_eptr;
+        pc = star_pc;
+        continue;
+        }
+      }
+    else if (star_eptr < end_subject &&
+             (!star_nosep || *star_eptr != separator))
+      {
+      GLOB_SKIPCHAR(star_eptr);
+      eptr = star_eptr;
+      pc = star_pc;
+      continue;
+      }
+
+    star_pc = NULL;
+    }
+
+  /* Otherwise let the latest "**" absorb one more character, or, if it
+  matches only whole directories, everything up to the next separator. */
+
+  if (starstar_pc == NULL || starstar_eptr >= end_subject) return FALSE;
+
+  if (starstar_dirs)
+    {
+    while (*starstar_eptr++ != separator)
+      if (starstar_eptr >= end_subject) return FALSE;
+    }
+  else GLOB_SKIPCHAR(starstar_eptr);
+
+  eptr = starstar_eptr;
+  pc = starstar_pc;
+  }
+}
+
+#undef GLOB_SKIPCHAR
+
+
+
+/*************************************************
+*        Check for a literal, then match         *
+*************************************************/
+
+/* Before running the program, check the first code unit of a glob that
+starts with a literal, and that the subject contains the longest literal of the
+glob. These quickly reject most subjects.
+
+Arguments:
+  glob           the compiled glob
+  subject        the subject
+  end_subject    end of the subject
+
+Returns:         TRUE if matched
+*/
+
+static BOOL
+glob_run(const pcre2_real_glob *glob, PCRE2_SPTR subject,
+  PCRE2_SPTR end_subject)
+{
+const uint32_t *code =
+  (const uint32_t *)((const char *)glob + sizeof(pcre2_real_glob));
+uint32_t length = glob->literal_length;
+
+if (code[0] == GLOB_CHAR &&
+    (subject >= end_subject || *subject != code[1]))
+  return FALSE;
+
+if (length > 0 && glob->literal_offset > 0)
+  {
+  const uint32_t *literal = code + glob->literal_offset;
+  uint32_t first = literal[1];
+  PCRE2_SPTR p = subject;
+  PCRE2_SPTR last;
+
+  if ((PCRE2_SIZE)(end_subject - subject) < length) return FALSE;
+  last = end_subject - length;
+
+  for (;; p++)
+    {
+    uint32_t i;
+
+#if PCRE2_CODE_UNIT_WIDTH == 8
+    p = memchr(p, (int)first, (size_t)(last - p) + 1);
+    if (p == NULL) return FALSE;
+#else
+    while (p <= last && *p != first) p++;
+    if (p > last) return FALSE;
+#endif
+
+    for (i = 1; i < length && p[i] == literal[2*i + 1]; i++) {}
+    if (i >= length) break;
+    }
+  }
+
+return glob_exec(code, subject, end_subject,
+  (glob->flags & GLOB_FLAG_UTF) != 0, glob->separator);
+}
+
+
+
+/*************************************************
+*                Compile a glob                  *
+*************************************************/
+
+/* This function compiles a glob pattern for pcre2_glob_match(), using the
+same parser as pcre2_pattern_convert(), so the syntax, error codes, and error
+offsets are the same.
+
+Arguments:
+  pattern       the glob pattern
+  plength       length of the pattern, or PCRE2_ZERO_TERMINATED
+  options       option bits, as for pcre2_pattern_convert()
+  errorptr      pointer to error code
+  erroroffset   pointer to error offset
+  ccontext      convert context or NULL
+
+Returns:        pointer to compiled glob, or NULL on error
+*/
+
+PCRE2_EXP_DEFN pcre2_glob * PCRE2_CALL_CONVENTION
+pcre2_glob_compile(PCRE2_SPTR pattern, PCRE2_SIZE plength, uint32_t options,
+  int *errorptr, PCRE2_SIZE *erroroffset, pcre2_convert_context *ccontext)
+{
+int rc;
+pcre2_glob *glob;
+glob_builder gb;
+PCRE2_UCHAR null_str[1] = { 0xcd };
+PCRE2_UCHAR dummy_buffer[DUMMY_BUFFER_SIZE];
+PCRE2_SIZE offset;
+BOOL utf = (options & PCRE2_CONVERT_UTF) != 0;
+
+if (errorptr == NULL || erroroffset == NULL) return NULL;
+*errorptr = 0;
+*erroroffset = 0;
+
+if (pattern == NULL && plength == 0)
+  pattern = null_str;
+
+if (pattern == NULL)
+  {
+  *errorptr = PCRE2_ERROR_NULL;
+  return NULL;
+  }
+
+if ((options & ~ALL_OPTIONS) != 0 ||
+    (options & TYPE_OPTIONS & ~PCRE2_CONVERT_GLOB) != 0)
+  {
+  *errorptr = PCRE2_ERROR_BADOPTION;
+  return NULL;
+  }
+
+/* As in pcre2_pattern_convert(), the type bit is not passed to the converter,
+because it is part of the other glob options. */
+
+options &= ~PCRE2_CONVERT_GLOB;
+
+if (plength == PCRE2_ZERO_TERMINATED) plength = PRIV(strlen)(pattern);
+if (ccontext == NULL) ccontext =
+  (pcre2_convert_context *)(&PRIV(default_convert_context));
+
+#ifndef SUPPORT_UNICODE
+if (utf)
+  {
+  *errorptr = PCRE2_ERROR_UNICODE_NOT_SUPPORTED;
+  return NULL;
+  }
+#else
+if (utf && (options & PCRE2_CONVERT_NO_UTF_CHECK) == 0)
+  {
+  rc = PRIV(valid_utf)(pattern, plength, erroroffset);
+  if (rc != 0)
+    {
+    *errorptr = rc;
+    return NULL;
+    }
+  }
+#endif
+
+/* The first pass finds the length of the program. The regular expression
+text is not wanted, so it is just written repeatedly into a dummy buffer. */
+
+memset(&gb, 0, sizeof(gb));
+
+rc = convert_glob(options, pattern, plength, utf, dummy_buffer,
+  DUMMY_BUFFER_SIZE, &offset, TRUE, ccontext, &gb);
+if (rc != 0)
+  {
+  *errorptr = rc;
+  *erroroffset = offset;
+  return NULL;
+  }
+
+glob = PRIV(memctl_malloc)(sizeof(pcre2_real_glob) +
+  gb.length * sizeof(uint32_t), (pcre2_memctl *)ccontext);
+if (glob == NULL)
+  {
+  *errorptr = PCRE2_ERROR_NOMEMORY;
+  return NULL;
+  }
+
+glob->blocksize = sizeof(pcre2_real_glob) + gb.length * sizeof(uint32_t);
+glob->flags = utf? GLOB_FLAG_UTF : 0;
+glob->separator = ccontext->glob_separator;
+
+memset(&gb, 0, sizeof(gb));
+gb.code = (uint32_t *)((char *)glob + sizeof(pcre2_real_glob));
+gb.last_unit = GLOB_NO_LAST_UNIT;
+
+(void)convert_glob(options, pattern, plength, utf, dummy_buffer,
+  DUMMY_BUFFER_SIZE, &offset, TRUE, ccontext, &gb);
+
+glob->last_unit = gb.last_unit;
+glob->literal_offset = gb.literal_offset;
+glob->literal_length = gb.literal_length;
+glob->code_length = gb.length;
+return glob;
+}
+
+
+
+/*************************************************
+*             Match a compiled glob              *
+*************************************************/
+
+/* The whole subject must match the glob.
+
+Arguments:
+  glob          the compiled glob
+  subject       the subject
+  length        length of the subject, or PCRE2_ZERO_TERMINATED
+  options       option bits (PCRE2_NO_UTF_CHECK only)
+
+Returns:        1 for a match, PCRE2_ERROR_NOMATCH, or another error code
+*/
+
+PCRE2_EXP_DEFN int PCRE2_CALL_CONVENTION
+pcre2_glob_match(const pcre2_glob *glob, PCRE2_SPTR subject,
+  PCRE2_SIZE length, uint32_t options)
+{
+if (subject == NULL && length == 0) subject = (PCRE2_SPTR)"";
+if (glob == NULL || subject == NULL) return PCRE2_ERROR_NULL;
+if ((options & ~PCRE2_NO_UTF_CHECK) != 0) return PCRE2_ERROR_BADOPTION;
+if (length == PCRE2_ZERO_TERMINATED) length = PRIV(strlen)(subject);
+
+#ifdef SUPPORT_UNICODE
+if ((glob->flags & GLOB_FLAG_UTF) != 0 &&
+    (options & PCRE2_NO_UTF_CHECK) == 0)
+  {
+  PCRE2_SIZE erroroffset;
+  int rc = PRIV(valid_utf)(subject, length, &erroroffset);
+  if (rc != 0) return rc;
+  }
+#endif
+
+return glob_run(glob, subject, subject + length)? 1 : PCRE2_ERROR_NOMATCH;
+}
+
+
+
+/*************************************************
+*             Free a compiled glob               *
+*************************************************/
+
+PCRE2_EXP_DEFN void PCRE2_CALL_CONVENTION
+pcre2_glob_free(pcre2_glob *glob)
+{
+if (glob != NULL)
+  glob->memctl.free(glob, glob->memctl.memory_data);
+}
+
+
+
+/*************************************************
+*              Create a glob set                 *
+*************************************************/
+
+/* A glob set holds copies of a list of compiled globs. A glob that ends with
+a literal can match only subjects that end with the same code unit, so the
+globs are put into lists according to the low 8 bits of their last code unit.
+Globs without a last code unit are kept on a separate list. The lists are in
+ascending order of glob number, so that the first matching glob can be found
+by merging just two of them.
+
+Arguments:
+  globs         vector of compiled globs
+  count         number of globs
+  gcontext      general context or NULL
+
+Returns:        pointer to the set, or NULL on error
+*/
+
+PCRE2_EXP_DEFN pcre2_glob_set * PCRE2_CALL_CONVENTION
+pcre2_glob_set_create(pcre2_glob **globs, uint32_t count,
+  pcre2_general_context *gcontext)
+{
+pcre2_glob_set *set;
+uint32_t *bucket_list;
+uint32_t bucket_count[256];
+char *copy;
+PCRE2_SIZE header, size;
+
+if (globs == NULL && count > 0) return NULL;
+
+/* Space for the glob pointers and the two lists follows the set structure,
+then the copies of the globs, each rounded up to keep them aligned. */
+
+header = (sizeof(pcre2_real_glob_set) +
+  count * (sizeof(pcre2_real_glob *) + 2 * sizeof(uint32_t)) + 7) &
+  ~(PCRE2_SIZE)7;
+size = header;
+
+for (uint32_t i = 0; i < count; i++)
+  {
+  if (globs[i] == NULL) return NULL;
+  size += (globs[i]->blocksize + 7) & ~(PCRE2_SIZE)7;
+  }
+
+set = PRIV(memctl_malloc)(size, (pcre2_memctl *)gcontext);
+if (set == NULL) return NULL;
+
+set->count = count;
+set->any_count = 0;
+set->utf = FALSE;
+set->globs = (const pcre2_real_glob **)(set + 1);
+set->any_list = (uint32_t *)(set->globs + count);
+bucket_list = set->any_list + count;
+set->bucket_list = bucket_list;
+
+memset(bucket_count, 0, sizeof(bucket_count));
+copy = (char *)set + header;
+
+for (uint32_t i = 0; i < count; i++)
+  {
+  const pcre2_real_glob *glob = globs[i];
+
+  memcpy(copy, glob, glob->blocksize);
+  set->globs[i] = (const pcre2_real_glob *)copy;
+  copy += (glob->blocksize + 7) & ~(PCRE2_SIZE)7;
+
+  if ((glob->flags & GLOB_FLAG_UTF) != 0) set->utf = TRUE;
+  if (glob->last_unit == GLOB_NO_LAST_UNIT)
+    set->any_list[set->any_count++] = i;
+  else
+    bucket_count[glob->last_unit & 0xff]++;
+  }
+
+set->bucket_start[0] = 0;
+for (int i = 0; i < 256; i++)
+  set->bucket_start[i + 1] = set->bucket_start[i] + bucket_count[i];
+
+memcpy(bucket_count, set->bucket_start, sizeof(bucket_count));
+for (uint32_t i = 0; i < count; i++)
+  {
+  uint32_t last_unit = globs[i]->last_unit;
+  if (last_unit != GLOB_NO_LAST_UNIT)
+    bucket_list[bucket_count[last_unit & 0xff]++] = i;
+  }
+
+return set;
+}
+
+
+
+/*************************************************
+*             Match a glob set                   *
+*************************************************/
+
+/* Arguments:
+  set           the glob set
+  subject       the subject
+  length        length of the subject, or PCRE2_ZERO_TERMINATED
+  options       option bits (PCRE2_NO_UTF_CHECK only)
+
+Returns:        the number of the first glob that matches,
+                PCRE2_ERROR_NOMATCH, or another error code
+*/
+
+PCRE2_EXP_DEFN int PCRE2_CALL_CONVENTION
+pcre2_glob_set_match(const pcre2_glob_set *set, PCRE2_SPTR subject,
+  PCRE2_SIZE length, uint32_t options)
+{
+const uint32_t *any_list, *any_end, *list, *list_end;
+PCRE2_SPTR end_subject;
+
+if (subject == NULL && length == 0) subject = (PCRE2_SPTR)"";
+if (set == NULL || subject == NULL) return PCRE2_ERROR_NULL;
+if ((options & ~PCRE2_NO_UTF_CHECK) != 0) return PCRE2_ERROR_BADOPTION;
+if (length == PCRE2_ZERO_TERMINATED) length = PRIV(strlen)(subject);
+
+#ifdef SUPPORT_UNICODE
+if (set->utf && (options & PCRE2_NO_UTF_CHECK) == 0)
+  {
+  PCRE2_SIZE erroroffset;
+  int rc = PRIV(valid_utf)(subject, length, &erroroffset);
+  if (rc != 0) return rc;
+  }
+#endif
+
+end_subject = subject + length;
+any_list = set->any_list;
+any_end = any_list + set->any_count;
+
+if (length == 0)
+  list = list_end = set->bucket_list;
+else
+  {
+  uint32_t b = end_subject[-1] & 0xff;
+  list = set->bucket_list + set->bucket_start[b];
+  list_end = set->bucket_list + set->bucket_start[b + 1];
+  }
+
+while (list < list_end || any_list < any_end)
+  {
+  uint32_t i;
+
+  if (any_list >= any_end || (list < list_end && *list < *any_list))
+    i = *list++;
+  else
+    i = *any_list++;
+
+  if (glob_run(set->globs[i], subject, end_subject)) return (int)i;
+  }
+
+return PCRE2_ERROR_NOMATCH;
+}
+
+
+
+/*************************************************
+*              Free a glob set                   *
+*************************************************/
+
+PCRE2_EXP_DEFN void PCRE2_CALL_CONVENTION
+pcre2_glob_set_free(pcre2_glob_set *set)
+{
+if (set != NULL)
+  set->memctl.free(set, set->memctl.memory_data);
+}
+
 /* End of pcre2_convert.c */
@@ -69,7 +69,14 @@ of internal_dfa_match(). (The supplied patch used a static vector, initialized
 only once - I suspect this was the cause of the problems with the tests.)
 
 Overall, I concluded that the gains in some cases did not outweigh the losses
-in others, so I abandoned this code. */
+in others, so I abandoned this code.
+
+Later, a small hash table was added, but it is used only for the states that
+follow the first DUP_HASH_THRESHOLD in the list for any one character. Simple
+patterns never reach the threshold, so they still use the linear search and pay
+nothing for the table, which is cleared only when it is first needed for each
+character. When there are many states, the quadratic search is replaced by one
+lookup for each state. */
 
 
 #include "pcre2_internal.h"
@@ -308,6 +315,14 @@ typedef struct stateblock {
 
 #define INTS_PER_STATEBLOCK  (int)(sizeof(stateblock)/sizeof(int))
 
+/* Parameters for the duplicate state hash table. The table is kept at most
+half full; states beyond DUP_HASH_MAX are checked by linear search. */
+
+#define DUP_HASH_THRESHOLD  16
+#define DUP_HASH_BITS       8
+#define DUP_HASH_SIZE       (1 << DUP_HASH_BITS)
+#define DUP_HASH_MAX        (DUP_HASH_SIZE / 2)
+
 
 /* Before version 10.32 the recursive calls of internal_dfa_match() were passed
 local working space and output vectors that were created on the stack. This has
@@ -337,6 +352,12 @@ typedef struct RWS_anchor {
 
 #define RWS_ANCHOR_SIZE (sizeof(RWS_anchor)/sizeof(int))
 
+/* When pcre2_dfa_match() takes its state vector from a pcre2_dfa_workspace
+object, the vector is made at least this many ints long, or large enough to
+hold a state for every code unit in the pattern, whichever is greater. */
+
+#define DFA_WS_MIN_SIZE 1000
+
 
 
 /*************************************************
@@ -405,8 +426,11 @@ return (mb->callout)(cb, mb->callout_data);
 
 /* This function is called when internal_dfa_match() is about to be called
 recursively and there is insufficient working space left in the current
-workspace block. If there's an existing next block, use it; otherwise get a new
-block unless the heap limit is reached.
+workspace block. If there's an existing next block that is large enough, use
+it; otherwise get a new block unless the heap limit is reached. Existing blocks
+may have been kept from a previous match by a pcre2_dfa_workspace object, so
+each block counts towards the heap limit the first time it is reached in the
+current match, whether or not it has to be obtained afresh.
 
 Arguments:
   rwsptr     pointer to block pointer (updated)
@@ -421,18 +445,36 @@ static int
 more_workspace(RWS_anchor **rwsptr, unsigned int ovecsize, dfa_match_block *mb)
 {
 RWS_anchor *rws = *rwsptr;
-RWS_anchor *new;
-
-if (rws->next != NULL)
-  {
-  new = rws->next;
-  }
+RWS_anchor *new = rws->next;
 
 /* Sizes in the RWS_anchor blocks are in units of sizeof(int), but
 mb->heap_limit and mb->heap_used are in kibibytes. Play carefully, to avoid
-overflow. */
+overflow. A kept block that is too small, or that would exceed the heap limit,
+is freed along with any that follow it, and a new one is obtained. */
 
-else
+if (new != NULL)
+  {
+  uint32_t newsizeK = new->size/(1024/sizeof(int));
+  BOOL counted = rws != mb->rws_last;
+
+  if (new->size < RWS_RSIZE + ovecsize + RWS_ANCHOR_SIZE ||
+      (!counted && newsizeK + mb->heap_used > mb->heap_limit))
+    {
+    rws->next = NULL;
+    while (new != NULL)
+      {
+      RWS_anchor *next = new->next;
+      if (counted) mb->heap_used -= new->size/(1024/sizeof(int));
+      if (new == mb->rws_last) counted = FALSE;
+      mb->rws_memctl->free(new, mb->rws_memctl->memory_data);
+      new = next;
+      }
+    mb->rws_last = rws;
+    }
+  else if (!counted) mb->heap_used += newsizeK;
+  }
+
+if (new == NULL)
   {
   uint32_t newsize = (rws->size >= UINT32_MAX/(sizeof(int)*2))? UINT32_MAX/sizeof(int) : rws->size * 2;
   uint32_t newsizeK = newsize/(1024/sizeof(int));
@@ -443,7 +485,8 @@ else
 
   if (newsize < RWS_RSIZE + ovecsize + RWS_ANCHOR_SIZE)
     return PCRE2_ERROR_HEAPLIMIT;
-  new = mb->memctl.malloc(newsize*sizeof(int), mb->memctl.memory_data);
+  new = mb->rws_memctl->malloc(newsize*sizeof(int),
+    mb->rws_memctl->memory_data);
   if (new == NULL) return PCRE2_ERROR_NOMEMORY;
   mb->heap_used += newsizeK;
   new->next = NULL;
@@ -452,6 +495,7 @@ else
   }
 
 new->free = new->size - RWS_ANCHOR_SIZE;
+if (rws == mb->rws_last) mb->rws_last = new;
 *rwsptr = new;
 return 0;
 }
@@ -524,6 +568,43 @@ for the current character, one for the following character). */
     } \
   else return PCRE2_ERROR_DFA_WSSIZE
 
+/*************************************************
+*     Look up a state in the duplicate table     *
+*************************************************/
+
+/* The table holds indexes (plus one) into the state list, with zero meaning
+"unused".
+
+Arguments:
+  states      the active state list
+  n           the index of the state to look up
+  table       the hash table
+  insert      TRUE to add the state if it is not found
+
+Returns:      TRUE if a state with the same offset and count was found
+*/
+
+static BOOL
+dup_state(stateblock *states, int n, uint16_t *table, BOOL insert)
+{
+int offset = states[n].offset;
+int count = states[n].count;
+uint32_t h = ((uint32_t)offset * 0x9e3779b1u + (uint32_t)count) >>
+  (32 - DUP_HASH_BITS);
+
+for (;;)
+  {
+  int k = table[h];
+  if (k == 0) break;
+  if (states[k-1].offset == offset && states[k-1].count == count) return TRUE;
+  h = (h + 1) & (DUP_HASH_SIZE - 1);
+  }
+
+if (insert) table[h] = (uint16_t)(n + 1);
+return FALSE;
+}
+
+
 /* And now, here is the code */
 
 static int
@@ -700,7 +781,9 @@ for (;;)
   {
   int i, j;
   int clen, dlen;
+  int dup_hashed = 0;
   uint32_t c, d;
+  uint16_t dup_hash[DUP_HASH_SIZE];
   BOOL partial_newline = FALSE;
   BOOL could_continue = reset_could_continue;
   reset_could_continue = FALSE;
@@ -779,14 +862,36 @@ for (;;)
       }
 
     /* Check for a duplicate state with the same count, and skip if found.
-    See the note at the head of this module about the possibility of improving
-    performance here. */
+    See the note at the head of this module about the performance of this
+    check. Once there are enough states to use the hash table, the earlier
+    states that are not yet in it are added. States that are waiting for
+    characters to be skipped have negative offsets, so can never match. */
 
-    for (j = 0; j < i; j++)
+    if (i < DUP_HASH_THRESHOLD)
       {
-      if (active_states[j].offset == state_offset &&
-          active_states[j].count == current_state->count)
+      for (j = 0; j < i; j++)
+        {
+        if (active_states[j].offset == state_offset &&
+            active_states[j].count == current_state->count)
+          goto NEXT_ACTIVE_STATE;
+        }
+      }
+    else
+      {
+      if (dup_hashed == 0) memset(dup_hash, 0, sizeof(dup_hash));
+      for (; dup_hashed < i && dup_hashed < DUP_HASH_MAX; dup_hashed++)
+        {
+        if (active_states[dup_hashed].offset >= 0)
+          (void)dup_state(active_states, dup_hashed, dup_hash, TRUE);
+        }
+      if (dup_state(active_states, i, dup_hash, FALSE))
         goto NEXT_ACTIVE_STATE;
+      for (j = dup_hashed; j < i; j++)
+        {
+        if (active_states[j].offset == state_offset &&
+            active_states[j].count == current_state->count)
+          goto NEXT_ACTIVE_STATE;
+        }
       }
 
     /* The state offset is the offset to the opcode */
@@ -1111,10 +1216,7 @@ for (;;)
           if (codevalue == OP_UCP_WORD_BOUNDARY ||
               codevalue == OP_NOT_UCP_WORD_BOUNDARY)
             {
-            int chartype = UCD_CHARTYPE(d);
-            int category = PRIV(ucp_gentype)[chartype];
-            left_word = (category == ucp_L || category == ucp_N ||
-              chartype == ucp_Mn || chartype == ucp_Pc);
+            left_word = UCD_PROPBIT(d, UCD_PROPBITS_WORD) != 0;
             }
           else
 #endif
@@ -1136,10 +1238,7 @@ for (;;)
           if (codevalue == OP_UCP_WORD_BOUNDARY ||
               codevalue == OP_NOT_UCP_WORD_BOUNDARY)
             {
-            int chartype = UCD_CHARTYPE(c);
-            int category = PRIV(ucp_gentype)[chartype];
-            right_word = (category == ucp_L || category == ucp_N ||
-              chartype == ucp_Mn || chartype == ucp_Pc);
+            right_word = UCD_PROPBIT(c, UCD_PROPBITS_WORD) != 0;
             }
           else
 #endif
@@ -1178,11 +1277,11 @@ for (;;)
           break;
 
           case PT_GC:
-          OK = PRIV(ucp_gentype)[prop->chartype] == code[2];
+          OK = UCD_CATEGORY_IS(c, code[2]);
           break;
 
           case PT_PC:
-          OK = prop->chartype == code[2];
+          OK = UCD_CHARTYPE_IS(c, code[2]);
           break;
 
           case PT_SC:
@@ -1197,9 +1296,7 @@ for (;;)
           /* These are specials for combination cases. */
 
           case PT_ALNUM:
-          chartype = prop->chartype;
-          OK = PRIV(ucp_gentype)[chartype] == ucp_L ||
-               PRIV(ucp_gentype)[chartype] == ucp_N;
+          OK = UCD_PROPBIT(c, UCD_PROPBITS_ALNUM);
           break;
 
           /* Perl space used to exclude VT, but from Perl 5.18 it is included,
@@ -1208,24 +1305,11 @@ for (;;)
 
           case PT_SPACE:    /* Perl space */
           case PT_PXSPACE:  /* POSIX space */
-          switch(c)
-            {
-            HSPACE_CASES:
-            VSPACE_CASES:
-            OK = TRUE;
-            break;
-
-            default:
-            OK = PRIV(ucp_gentype)[prop->chartype] == ucp_Z;
-            break;
-            }
+          OK = UCD_PROPBIT(c, UCD_PROPBITS_SPACE);
           break;
 
           case PT_WORD:
-          chartype = prop->chartype;
-          OK = PRIV(ucp_gentype)[chartype] == ucp_L ||
-               PRIV(ucp_gentype)[chartype] == ucp_N ||
-               chartype == ucp_Mn || chartype == ucp_Pc;
+          OK = UCD_PROPBIT(c, UCD_PROPBITS_WORD);
           break;
 
           case PT_CLIST:
@@ -1456,11 +1540,11 @@ for (;;)
           break;
 
           case PT_GC:
-          OK = PRIV(ucp_gentype)[prop->chartype] == code[3];
+          OK = UCD_CATEGORY_IS(c, code[3]);
           break;
 
           case PT_PC:
-          OK = prop->chartype == code[3];
+          OK = UCD_CHARTYPE_IS(c, code[3]);
           break;
 
           case PT_SC:
@@ -1475,9 +1559,7 @@ for (;;)
           /* These are specials for combination cases. */
 
           case PT_ALNUM:
-          chartype = prop->chartype;
-          OK = PRIV(ucp_gentype)[chartype] == ucp_L ||
-               PRIV(ucp_gentype)[chartype] == ucp_N;
+          OK = UCD_PROPBIT(c, UCD_PROPBITS_ALNUM);
           break;
 
           /* Perl space used to exclude VT, but from Perl 5.18 it is included,
@@ -1486,24 +1568,11 @@ for (;;)
 
           case PT_SPACE:    /* Perl space */
           case PT_PXSPACE:  /* POSIX space */
-          switch(c)
-            {
-            HSPACE_CASES:
-            VSPACE_CASES:
-            OK = TRUE;
-            break;
-
-            default:
-            OK = PRIV(ucp_gentype)[prop->chartype] == ucp_Z;
-            break;
-            }
+          OK = UCD_PROPBIT(c, UCD_PROPBITS_SPACE);
           break;
 
           case PT_WORD:
-          chartype = prop->chartype;
-          OK = PRIV(ucp_gentype)[chartype] == ucp_L ||
-               PRIV(ucp_gentype)[chartype] == ucp_N ||
-               chartype == ucp_Mn || chartype == ucp_Pc;
+          OK = UCD_PROPBIT(c, UCD_PROPBITS_WORD);
           break;
 
           case PT_CLIST:
@@ -1717,11 +1786,11 @@ for (;;)
           break;
 
           case PT_GC:
-          OK = PRIV(ucp_gentype)[prop->chartype] == code[3];
+          OK = UCD_CATEGORY_IS(c, code[3]);
           break;
 
           case PT_PC:
-          OK = prop->chartype == code[3];
+          OK = UCD_CHARTYPE_IS(c, code[3]);
           break;
 
           case PT_SC:
@@ -1736,9 +1805,7 @@ for (;;)
           /* These are specials for combination cases. */
 
           case PT_ALNUM:
-          chartype = prop->chartype;
-          OK = PRIV(ucp_gentype)[chartype] == ucp_L ||
-               PRIV(ucp_gentype)[chartype] == ucp_N;
+          OK = UCD_PROPBIT(c, UCD_PROPBITS_ALNUM);
           break;
 
           /* Perl space used to exclude VT, but from Perl 5.18 it is included,
@@ -1747,24 +1814,11 @@ for (;;)
 
           case PT_SPACE:    /* Perl space */
           case PT_PXSPACE:  /* POSIX space */
-          switch(c)
-            {
-            HSPACE_CASES:
-            VSPACE_CASES:
-            OK = TRUE;
-            break;
-
-            default:
-            OK = PRIV(ucp_gentype)[prop->chartype] == ucp_Z;
-            break;
-            }
+          OK = UCD_PROPBIT(c, UCD_PROPBITS_SPACE);
           break;
 
           case PT_WORD:
-          chartype = prop->chartype;
-          OK = PRIV(ucp_gentype)[chartype] == ucp_L ||
-               PRIV(ucp_gentype)[chartype] == ucp_N ||
-               chartype == ucp_Mn || chartype == ucp_Pc;
+          OK = UCD_PROPBIT(c, UCD_PROPBITS_WORD);
           break;
 
           case PT_CLIST:
@@ -2003,11 +2057,11 @@ for (;;)
           break;
 
           case PT_GC:
-          OK = PRIV(ucp_gentype)[prop->chartype] == code[1 + IMM2_SIZE + 2];
+          OK = UCD_CATEGORY_IS(c, code[1 + IMM2_SIZE + 2]);
           break;
 
           case PT_PC:
-          OK = prop->chartype == code[1 + IMM2_SIZE + 2];
+          OK = UCD_CHARTYPE_IS(c, code[1 + IMM2_SIZE + 2]);
           break;
 
           case PT_SC:
@@ -2023,9 +2077,7 @@ for (;;)
           /* These are specials for combination cases. */
 
           case PT_ALNUM:
-          chartype = prop->chartype;
-          OK = PRIV(ucp_gentype)[chartype] == ucp_L ||
-               PRIV(ucp_gentype)[chartype] == ucp_N;
+          OK = UCD_PROPBIT(c, UCD_PROPBITS_ALNUM);
           break;
 
           /* Perl space used to exclude VT, but from Perl 5.18 it is included,
@@ -2034,24 +2086,11 @@ for (;;)
 
           case PT_SPACE:    /* Perl space */
           case PT_PXSPACE:  /* POSIX space */
-          switch(c)
-            {
-            HSPACE_CASES:
-            VSPACE_CASES:
-            OK = TRUE;
-            break;
-
-            default:
-            OK = PRIV(ucp_gentype)[prop->chartype] == ucp_Z;
-            break;
-            }
+          OK = UCD_PROPBIT(c, UCD_PROPBITS_SPACE);
           break;
 
           case PT_WORD:
-          chartype = prop->chartype;
-          OK = PRIV(ucp_gentype)[chartype] == ucp_L ||
-               PRIV(ucp_gentype)[chartype] == ucp_N ||
-               chartype == ucp_Mn || chartype == ucp_Pc;
+          OK = UCD_PROPBIT(c, UCD_PROPBITS_WORD);
           break;
 
           case PT_CLIST:
@@ -3312,6 +3351,255 @@ return match_count;
 
 
 
+/*************************************************
+*     Support functions for bit-parallel DFA     *
+*************************************************/
+
+/* When a pattern was compiled with PCRE2_EXTRA_DFA_BITPARALLEL and it is
+simple enough, pcre2_compile() sets up tables that allow it to be matched by a
+bit-parallel simulation of the automaton (see the description of the
+dfa_bitparallel structure in pcre2_internal.h). The set of active states is a
+single 64-bit word, so each character costs a handful of logical operations,
+instead of a scan of the state list. These functions find the positions that a
+character matches, and add the positions that can be reached by skipping
+optional positions. */
+
+static uint64_t
+bp_char_mask(const dfa_bitparallel *bp, uint32_t c)
+{
+uint32_t i;
+if (c < 256) return bp->chars[c];
+for (i = 0; i < bp->except_count; i++)
+  if (bp->except_chars[i] == c) return bp->except_masks[i];
+return bp->high;
+}
+
+/* Within each run of skippable positions, every position above an active one
+becomes active, as does the position that follows the run. The subtraction
+propagates a borrow from the start of each run up to its lowest active
+position; the borrow cannot pass the bit that follows the run, because that is
+always set. A possessive position cannot be skipped if the current character
+matches it. */
+
+static uint64_t
+bp_closure(const dfa_bitparallel *bp, uint64_t states, uint64_t mask)
+{
+uint64_t skip = bp->optional & ~(bp->possessive & mask);
+uint64_t first = skip & ~(skip << 1);
+uint64_t follow = (skip << 1) & ~skip;
+uint64_t reach = states | follow;
+return states | ((skip | follow) & (~(reach - first) ^ reach));
+}
+
+/* This function checks an end assertion at the current position, in the same
+way as internal_dfa_match(). */
+
+static BOOL
+bp_end_assert(dfa_match_block *mb, const dfa_bitparallel *bp, PCRE2_SPTR ptr,
+  BOOL utf)
+{
+PCRE2_SPTR end_subject = mb->end_subject;
+
+switch(bp->end_assert)
+  {
+  case OP_EOD:
+  return ptr >= end_subject;
+
+  case OP_EODN:
+  return ptr >= end_subject ||
+    (IS_NEWLINE(ptr) && ptr == end_subject - mb->nllen);
+
+  case OP_DOLL:
+  return (mb->moptions & PCRE2_NOTEOL) == 0 &&
+    (ptr >= end_subject ||
+      ((mb->poptions & PCRE2_DOLLAR_ENDONLY) == 0 && IS_NEWLINE(ptr) &&
+        ptr == end_subject - mb->nllen));
+
+  default:
+  return TRUE;
+  }
+}
+
+
+
+/*************************************************
+*    Bit-parallel DFA match at one position      *
+*************************************************/
+
+/* This function is used instead of internal_dfa_match() when bit-parallel
+tables exist. It finds all the matches that start at one position, and records
+them exactly as internal_dfa_match() does, longest first.
+
+Arguments:
+  mb                pointer to "static" variables block
+  bp                the bit-parallel tables
+  current_subject   where we currently are in the subject string
+  offsets           vector to contain the matching string offsets
+  offsetcount       size of same
+  utf               TRUE in UTF mode
+
+Returns:            > 0 => number of match offset pairs placed in offsets
+                    = 0 => offsets overflowed; longest matches are present
+                     -1 => failed to match
+                   < -1 => some kind of unexpected problem
+*/
+
+static int
+bitparallel_dfa_match(dfa_match_block *mb, const dfa_bitparallel *bp,
+  PCRE2_SPTR current_subject, PCRE2_SIZE *offsets, uint32_t offsetcount,
+  BOOL utf)
+{
+PCRE2_SPTR start_subject = mb->start_subject;
+PCRE2_SPTR end_subject = mb->end_subject;
+PCRE2_SPTR ptr = current_subject;
+uint64_t states = 1;
+int match_count = PCRE2_ERROR_NOMATCH;
+
+if (mb->match_call_count++ >= mb->match_limit) return PCRE2_ERROR_MATCHLIMIT;
+
+switch(bp->start_assert)
+  {
+  case OP_CIRC:
+  if (ptr != start_subject || (mb->moptions & PCRE2_NOTBOL) != 0)
+    return PCRE2_ERROR_NOMATCH;
+  break;
+
+  case OP_SOD:
+  if (ptr != start_subject) return PCRE2_ERROR_NOMATCH;
+  break;
+
+  case OP_SOM:
+  if (ptr != start_subject + mb->start_offset) return PCRE2_ERROR_NOMATCH;
+  break;
+
+  default:
+  break;
+  }
+
+for (;;)
+  {
+  uint64_t mask = 0;
+  uint64_t matched;
+  int clen = 0;
+
+  if (ptr > mb->last_used_ptr) mb->last_used_ptr = ptr;
+
+  if (ptr < end_subject)
+    {
+    uint32_t c;
+    clen = 1;
+#ifdef SUPPORT_UNICODE
+    GETCHARLENTEST(c, ptr, clen);
+#else
+    c = *ptr;
+#endif  /* SUPPORT_UNICODE */
+    mask = bp_char_mask(bp, c);
+    }
+
+  states = bp_closure(bp, states, mask);
+
+  /* Record a match as internal_dfa_match() does when it reaches the end of
+  the pattern. */
+
+  if ((states & bp->accept) != 0 && bp_end_assert(mb, bp, ptr, utf) &&
+      (ptr > current_subject ||
+        ((mb->moptions & PCRE2_NOTEMPTY) == 0 &&
+          ((mb->moptions & PCRE2_NOTEMPTY_ATSTART) == 0 ||
+            current_subject > start_subject + mb->start_offset))))
+    {
+    int count;
+    if (match_count < 0) match_count = (offsetcount >= 2)? 1 : 0;
+      else if (match_count > 0 && ++match_count * 2 > (int)offsetcount)
+        match_count = 0;
+    count = ((match_count == 0)? (int)offsetcount : match_count * 2) - 2;
+    if (count > 0) (void)memmove(offsets + 2, offsets,
+      (size_t)count * sizeof(PCRE2_SIZE));
+    if (offsetcount >= 2)
+      {
+      offsets[0] = (PCRE2_SIZE)(current_subject - start_subject);
+      offsets[1] = (PCRE2_SIZE)(ptr - start_subject);
+      }
+    if ((mb->moptions & PCRE2_DFA_SHORTEST) != 0) return match_count;
+    }
+
+  /* Move on to the next character. A looping position remains active after it
+  has matched; others pass on to the following position. */
+
+  matched = states & mask;
+  states = ((matched & ~bp->loop) << 1) | (matched & bp->loop);
+  if (states == 0) break;
+  ptr += clen;
+  }
+
+if (match_count >= 0 &&
+    ((mb->moptions | mb->poptions) & PCRE2_ENDANCHORED) != 0 &&
+    ptr < end_subject)
+  match_count = PCRE2_ERROR_NOMATCH;
+
+return match_count;
+}
+
+
+
+/*************************************************
+*   Check for any bit-parallel DFA match         *
+*************************************************/
+
+/* Before trying a non-anchored pattern at each starting position in turn, a
+single scan of the subject, with a new thread of matching started at every
+character, finds out whether there is any match at all. If there is not, as is
+often the case when many subjects are being searched, the scan costs much less
+than the attempts it saves.
+
+Arguments:
+  mb                pointer to "static" variables block
+  bp                the bit-parallel tables
+  start_match       where to start scanning
+  utf               TRUE in UTF mode
+
+Returns:            TRUE if a match might start somewhere at or after
+                      start_match; FALSE if there is definitely no match
+*/
+
+static BOOL
+bitparallel_dfa_scan(dfa_match_block *mb, const dfa_bitparallel *bp,
+  PCRE2_SPTR start_match, BOOL utf)
+{
+PCRE2_SPTR end_subject = mb->end_subject;
+PCRE2_SPTR ptr = start_match;
+uint64_t states = 0;
+
+for (;;)
+  {
+  uint64_t mask = 0;
+  uint64_t matched;
+  int clen = 0;
+
+  if (ptr < end_subject)
+    {
+    uint32_t c;
+    clen = 1;
+#ifdef SUPPORT_UNICODE
+    GETCHARLENTEST(c, ptr, clen);
+#else
+    c = *ptr;
+#endif  /* SUPPORT_UNICODE */
+    mask = bp_char_mask(bp, c);
+    }
+
+  states = bp_closure(bp, states | 1, mask);
+  if ((states & bp->accept) != 0 && bp_end_assert(mb, bp, ptr, utf))
+    return TRUE;
+  if (clen == 0) return FALSE;
+
+  matched = states & mask;
+  states = ((matched & ~bp->loop) << 1) | (matched & bp->loop);
+  ptr += clen;
+  }
+}
+
+
+
 /*************************************************
 *     Match a pattern using the DFA algorithm    *
 *************************************************/
@@ -3327,7 +3615,7 @@ Arguments:
   options       option bits
   match_data    points to a match data structure
   gcontext      points to a match context
-  workspace     pointer to workspace
+  workspace     pointer to workspace, or NULL to use a workspace object
   wscount       size of workspace
 
 Returns:        > 0 => number of match offset pairs placed in offsets
@@ -3358,8 +3646,6 @@ BOOL has_first_cu = FALSE;
 BOOL has_req_cu = FALSE;
 
 #if PCRE2_CODE_UNIT_WIDTH == 8
-PCRE2_SPTR memchr_found_first_cu = NULL;
-PCRE2_SPTR memchr_found_first_cu2 = NULL;
 #endif
 
 PCRE2_UCHAR first_cu = 0;
@@ -3368,6 +3654,9 @@ PCRE2_UCHAR req_cu = 0;
 PCRE2_UCHAR req_cu2 = 0;
 
 const uint8_t *start_bits = NULL;
+const dfa_bitparallel *bp = NULL;
+
+pcre2_dfa_workspace *dfa_ws = NULL;
 
 /* We need to have mb pointing to a match block, because the IS_NEWLINE macro
 is used below, and it expects NLBLOCK to be defined as a pointer. */
@@ -3386,6 +3675,8 @@ RWS_anchor *rws = (RWS_anchor *)base_recursion_workspace;
 rws->next = NULL;
 rws->size = RWS_BASE_SIZE;
 rws->free = RWS_BASE_SIZE - RWS_ANCHOR_SIZE;
+mb->rws_memctl = &mb->memctl;
+mb->rws_last = rws;
 
 /* Recognize NULL, length 0 as an empty string. */
 
@@ -3394,7 +3685,23 @@ if (subject == NULL && length == 0) subject = null_str;
 /* Plausibility checks */
 
 if (match_data == NULL) return PCRE2_ERROR_NULL;
-if (re == NULL || subject == NULL || workspace == NULL)
+
+/* If a DFA workspace object is attached to the match context, borrow it for
+the duration of this match, unless it is already lent out (which happens if a
+callout function calls pcre2_dfa_match() recursively with the same context).
+Its kept recursion workspace blocks are chained after the stack block, and any
+new ones are obtained using the object's memory management functions. */
+
+if (mcontext != NULL && mcontext->dfa_workspace != NULL &&
+    !mcontext->dfa_workspace->in_use)
+  {
+  dfa_ws = mcontext->dfa_workspace;
+  dfa_ws->in_use = TRUE;
+  rws->next = dfa_ws->rws;
+  mb->rws_memctl = &dfa_ws->memctl;
+  }
+
+if (re == NULL || subject == NULL || (workspace == NULL && dfa_ws == NULL))
   { rc = PCRE2_ERROR_NULL; goto EXIT; }
 if ((options & ~PUBLIC_DFA_MATCH_OPTIONS) != 0)
   { rc = PCRE2_ERROR_BADOPTION; goto EXIT; }
@@ -3404,7 +3711,8 @@ if (length == PCRE2_ZERO_TERMINATED)
   length = PRIV(strlen)(subject);
   }
 
-if (wscount < 20) { rc = PCRE2_ERROR_DFA_WSSIZE; goto EXIT; }
+if (workspace != NULL && wscount < 20)
+  { rc = PCRE2_ERROR_DFA_WSSIZE; goto EXIT; }
 if (start_offset > length) { rc = PCRE2_ERROR_BADOFFSET; goto EXIT; }
 
 /* Partial matching and PCRE2_ENDANCHORED are currently not allowed at the same
@@ -3430,6 +3738,32 @@ if (re->magic_number != MAGIC_NUMBER)
 if ((re->flags & PCRE2_MODE_MASK) != PCRE2_CODE_UNIT_WIDTH/8)
   { rc = PCRE2_ERROR_BADMODE; goto EXIT; }
 
+/* When no workspace is supplied, use the state vector in the workspace object,
+first making sure that it is large enough for this pattern. It is not replaced
+when restarting after a partial match, because its contents are needed. */
+
+if (workspace == NULL)
+  {
+  PCRE2_SIZE needed = 2 + 2 * INTS_PER_STATEBLOCK *
+    ((re->blocksize - re->code_start)/(PCRE2_CODE_UNIT_WIDTH/8));
+
+  if (needed < DFA_WS_MIN_SIZE) needed = DFA_WS_MIN_SIZE;
+  if (dfa_ws->wscount < needed && (options & PCRE2_DFA_RESTART) == 0)
+    {
+    int *new = dfa_ws->memctl.malloc(needed * sizeof(int),
+      dfa_ws->memctl.memory_data);
+    if (new == NULL) { rc = PCRE2_ERROR_NOMEMORY; goto EXIT; }
+    if (dfa_ws->workspace != NULL)
+      dfa_ws->memctl.free(dfa_ws->workspace, dfa_ws->memctl.memory_data);
+    dfa_ws->workspace = new;
+    dfa_ws->wscount = needed;
+    new[0] = -1;  /* Not restartable */
+    }
+  if (dfa_ws->workspace == NULL) { rc = PCRE2_ERROR_DFA_BADRESTART; goto EXIT; }
+  workspace = dfa_ws->workspace;
+  wscount = dfa_ws->wscount;
+  }
+
 /* PCRE2_NOTEMPTY and PCRE2_NOTEMPTY_ATSTART are match-time flags in the
 options variable for this function. Users of PCRE2 who are not calling the
 function directly would like to have a way of setting these flags, in the same
@@ -3493,7 +3827,7 @@ setting the flag at compile time. */
 if (mcontext == NULL)
   {
   mb->callout = NULL;
-  mb->memctl = re->memctl;
+  mb->memctl = *CODE_MEMCTL(re);
   mb->match_limit = PRIV(default_match_context).match_limit;
   mb->match_limit_depth = PRIV(default_match_context).depth_limit;
   mb->heap_limit = PRIV(default_match_context).heap_limit;
@@ -3524,7 +3858,7 @@ if (mb->heap_limit > re->limit_heap)
   mb->heap_limit = re->limit_heap;
 
 mb->start_code = (PCRE2_SPTR)((const uint8_t *)re + re->code_start);
-mb->tables = re->tables;
+mb->tables = CODE_TABLES(re);
 mb->start_subject = subject;
 mb->end_subject = end_subject;
 mb->start_offset = start_offset;
@@ -3691,6 +4025,45 @@ match_data->mark = NULL;
 match_data->matchedby = PCRE2_MATCHEDBY_DFA_INTERPRETER;
 match_data->options = original_options;
 
+/* If the pattern can match only at the end of the subject and has a known
+maximum length, skip the starting positions that are too far from the end, as
+in pcre2_match(). The extra two characters allow for a final CRLF or \R
+newline. This is not done when restarting or for partial matching. */
+
+if (!anchored && !firstline &&
+    (re->optimization_flags & PCRE2_OPTIM_START_OPTIMIZE) != 0 &&
+    (options & (PCRE2_PARTIAL_HARD|PCRE2_PARTIAL_SOFT|PCRE2_DFA_RESTART)) == 0 &&
+    re->maxlength != UINT16_MAX &&
+    ((re->flags & PCRE2_ENDANCHOR) != 0 ||
+     ((re->overall_options | options) & PCRE2_ENDANCHORED) != 0))
+  {
+  PCRE2_SIZE back = (PCRE2_SIZE)re->maxlength + 2;
+#ifdef SUPPORT_UNICODE
+  if (utf) back *= 4/(PCRE2_CODE_UNIT_WIDTH/8);
+#endif
+  if ((PCRE2_SIZE)(end_subject - start_match) > back)
+    {
+    start_match = end_subject - back;
+#ifdef SUPPORT_UNICODE
+    if (utf) { FORWARDCHARTEST(start_match, end_subject); }
+#endif
+    }
+  }
+
+/* If the pattern has bit-parallel tables, use them instead of the main
+matching function, except for partial matching and restarting, which they do
+not support. For a non-anchored pattern, a quick scan finds out whether there
+is any match at all. */
+
+if ((re->flags & PCRE2_BITPARALLEL) != 0 &&
+    (options & (PCRE2_PARTIAL_HARD|PCRE2_PARTIAL_SOFT|PCRE2_DFA_RESTART)) == 0)
+  {
+  bp = (const dfa_bitparallel *)
+    ((const uint8_t *)re + BITPARALLEL_OFFSET(re));
+  if (!anchored && !bitparallel_dfa_scan(mb, bp, start_match, utf))
+    goto NOMATCH_EXIT;
+  }
+
 /* Call the main matching function, looping for a non-anchored regex after a
 failed match. If not restarting, perform certain optimizations at the start of
 a match. */
@@ -3765,77 +4138,19 @@ for (;;)
       {
       if (has_first_cu)
         {
-        if (first_cu != first_cu2)  /* Caseless */
-          {
-          /* In 16-bit and 32_bit modes we have to do our own search, so can
-          look for both cases at once. */
-
-#if PCRE2_CODE_UNIT_WIDTH != 8
-          PCRE2_UCHAR smc;
-          while (start_match < end_subject &&
-                (smc = *start_match) != first_cu &&
-                 smc != first_cu2)
-            start_match++;
-#else
-          /* In 8-bit mode, the use of memchr() gives a big speed up, even
-          though we have to call it twice in order to find the earliest
-          occurrence of the code unit in either of its cases. Caching is used
-          to remember the positions of previously found code units. This can
-          make a huge difference when the strings are very long and only one
-          case is actually present. */
-
-          PCRE2_SPTR pp1 = NULL;
-          PCRE2_SPTR pp2 = NULL;
-          PCRE2_SIZE searchlength = end_subject - start_match;
-
-          /* If we haven't got a previously found position for first_cu, or if
-          the current starting position is later, we need to do a search. If
-          the code unit is not found, set it to the end. */
-
-          if (memchr_found_first_cu == NULL ||
-              start_match > memchr_found_first_cu)
-            {
-            pp1 = memchr(start_match, first_cu, searchlength);
-            memchr_found_first_cu = (pp1 == NULL)? end_subject : pp1;
-            }
-
-          /* If the start is before a previously found position, use the
-          previous position, or NULL if a previous search failed. */
-
-          else pp1 = (memchr_found_first_cu == end_subject)? NULL :
-            memchr_found_first_cu;
-
-          /* Do the same thing for the other case. */
+        /* Search for both cases at once when caseless. */
 
-          if (memchr_found_first_cu2 == NULL ||
-              start_match > memchr_found_first_cu2)
-            {
-            pp2 = memchr(start_match, first_cu2, searchlength);
-            memchr_found_first_cu2 = (pp2 == NULL)? end_subject : pp2;
-            }
-
-          else pp2 = (memchr_found_first_cu2 == end_subject)? NULL :
-            memchr_found_first_cu2;
-
-          /* Set the start to the end of the subject if neither case was found.
-          Otherwise, use the earlier found point. */
-
-          if (pp1 == NULL)
-            start_match = (pp2 == NULL)? end_subject : pp2;
-          else
-            start_match = (pp2 == NULL || pp1 < pp2)? pp1 : pp2;
-
-#endif  /* 8-bit handling */
-          }
+        if (first_cu != first_cu2)  /* Caseless */
+          start_match = PRIV(memchr2)(start_match, end_subject, first_cu,
+            first_cu2);
 
-        /* The caseful case is much simpler. */
+        /* In the caseful case, memchr() is used in the 8-bit library. */
 
         else
           {
 #if PCRE2_CODE_UNIT_WIDTH != 8
-          while (start_match < end_subject && *start_match !=
-                 first_cu)
-            start_match++;
+          start_match = PRIV(memchr2)(start_match, end_subject, first_cu,
+            first_cu);
 #else  /* 8-bit code units */
           start_match = memchr(start_match, first_cu, end_subject - start_match);
           if (start_match == NULL) start_match = end_subject;
@@ -3892,20 +4207,11 @@ for (;;)
 
       /* If there's no first code unit or a requirement for a multiline line
       start, advance to a non-unique first code unit if any have been
-      identified. The bitmap contains only 256 bits. When code units are 16 or
-      32 bits wide, all code units greater than 254 set the 255 bit. */
+      identified. */
 
       else if (start_bits != NULL)
         {
-        while (start_match < end_subject)
-          {
-          uint32_t c = *start_match;
-#if PCRE2_CODE_UNIT_WIDTH != 8
-          if (c > 255) c = 255;
-#endif
-          if ((start_bits[c/8] & (1u << (c&7))) != 0) break;
-          start_match++;
-          }
+        start_match = PRIV(scan_start_bits)(start_match, end_subject, re);
 
         /* See comment above in first_cu checking about the next line. */
 
@@ -3937,12 +4243,8 @@ for (;;)
       must be later in the subject; otherwise the test starts at the match
       point. This optimization can save a huge amount of backtracking in
       patterns with nested unlimited repeats that aren't going to match.
-      Writing separate code for cased/caseless versions makes it go faster, as
-      does using an autoincrement and backing off on a match. As in the case of
-      the first code unit, using memchr() in the 8-bit library gives a big
-      speed up. Unlike the first_cu check above, we do not need to call
-      memchr() twice in the caseless case because we only need to check for the
-      presence of the character in either case, not find the first occurrence.
+      As in the case of the first code unit, the search uses memchr() in the
+      8-bit caseful case, and PRIV(memchr2)() otherwise.
 
       The search can be skipped if the code unit was found later than the
       current starting point in a previous iteration of the bumpalong loop.
@@ -3964,21 +4266,7 @@ for (;;)
           {
           if (req_cu != req_cu2)  /* Caseless */
             {
-#if PCRE2_CODE_UNIT_WIDTH != 8
-            while (p < end_subject)
-              {
-              uint32_t pp = *p++;
-              if (pp == req_cu || pp == req_cu2) { p--; break; }
-              }
-#else  /* 8-bit code units */
-            PCRE2_SPTR pp = p;
-            p = memchr(pp, req_cu, end_subject - pp);
-            if (p == NULL)
-              {
-              p = memchr(pp, req_cu2, end_subject - pp);
-              if (p == NULL) p = end_subject;
-              }
-#endif /* PCRE2_CODE_UNIT_WIDTH != 8 */
+            p = PRIV(memchr2)(p, end_subject, req_cu, req_cu2);
             }
 
           /* The caseful case */
@@ -3986,11 +4274,7 @@ for (;;)
           else
             {
 #if PCRE2_CODE_UNIT_WIDTH != 8
-            while (p < end_subject)
-              {
-              if (*p++ == req_cu) { p--; break; }
-              }
-
+            p = PRIV(memchr2)(p, end_subject, req_cu, req_cu);
 #else  /* 8-bit code units */
             p = memchr(p, req_cu, end_subject - p);
             if (p == NULL) p = end_subject;
@@ -4024,17 +4308,26 @@ for (;;)
   mb->last_used_ptr = start_match;
   mb->recursive = NULL;
 
-  rc = internal_dfa_match(
-    mb,                           /* fixed match data */
-    mb->start_code,               /* this subexpression's code */
-    start_match,                  /* where we currently are */
-    start_offset,                 /* start offset in subject */
-    match_data->ovector,          /* offset vector */
-    (uint32_t)match_data->oveccount * 2,  /* actual size of same */
-    workspace,                    /* workspace vector */
-    (int)wscount,                 /* size of same */
-    0,                            /* function recurse level */
-    base_recursion_workspace);    /* initial workspace for recursion */
+  if (bp != NULL)
+    rc = bitparallel_dfa_match(
+      mb,                           /* fixed match data */
+      bp,                           /* bit-parallel tables */
+      start_match,                  /* where we currently are */
+      match_data->ovector,          /* offset vector */
+      (uint32_t)match_data->oveccount * 2,  /* actual size of same */
+      utf);                         /* UTF mode */
+  else
+    rc = internal_dfa_match(
+      mb,                           /* fixed match data */
+      mb->start_code,               /* this subexpression's code */
+      start_match,                  /* where we currently are */
+      start_offset,                 /* start offset in subject */
+      match_data->ovector,          /* offset vector */
+      (uint32_t)match_data->oveccount * 2,  /* actual size of same */
+      workspace,                    /* workspace vector */
+      (int)wscount,                 /* size of same */
+      0,                            /* function recurse level */
+      base_recursion_workspace);    /* initial workspace for recursion */
 
   /* Anything other than "no match" means we are done, always; otherwise, carry
   on only if not anchored. */
@@ -4114,7 +4407,17 @@ match_data->start_offset = start_offset;
 rc = PCRE2_ERROR_NOMATCH;
 
 EXIT:
-while (rws->next != NULL)
+
+/* If the workspace object was borrowed, hand back the recursion workspace
+blocks, which may have been added to, for use by the next match. Otherwise,
+free any blocks that were obtained. */
+
+if (dfa_ws != NULL)
+  {
+  dfa_ws->rws = rws->next;
+  dfa_ws->in_use = FALSE;
+  }
+else while (rws->next != NULL)
   {
   RWS_anchor *next = rws->next;
   rws->next = next->next;
@@ -4125,6 +4428,85 @@ match_data->rc = rc;
 return rc;
 }
 
+
+
+/*************************************************
+*          Create a DFA workspace object         *
+*************************************************/
+
+/* If wscount is zero, the state vector is not obtained until the object is
+first used by pcre2_dfa_match(), which sizes it from the pattern. Otherwise a
+vector of the given size is obtained now; it is still enlarged if a pattern
+needs more. */
+
+PCRE2_EXP_DEFN pcre2_dfa_workspace * PCRE2_CALL_CONVENTION
+pcre2_dfa_workspace_create(PCRE2_SIZE wscount, pcre2_general_context *gcontext)
+{
+pcre2_dfa_workspace *yield = PRIV(memctl_malloc)(
+  sizeof(pcre2_real_dfa_workspace), (pcre2_memctl *)gcontext);
+if (yield == NULL) return NULL;
+yield->workspace = NULL;
+yield->wscount = 0;
+yield->rws = NULL;
+yield->in_use = FALSE;
+
+if (wscount > 0)
+  {
+  if (wscount < 20) wscount = 20;
+  yield->workspace = yield->memctl.malloc(wscount * sizeof(int),
+    yield->memctl.memory_data);
+  if (yield->workspace == NULL)
+    {
+    yield->memctl.free(yield, yield->memctl.memory_data);
+    return NULL;
+    }
+  yield->workspace[0] = -1;  /* Not restartable */
+  yield->wscount = wscount;
+  }
+
+return yield;
+}
+
+
+
+/*************************************************
+*          Free a DFA workspace object           *
+*************************************************/
+
+PCRE2_EXP_DEFN void PCRE2_CALL_CONVENTION
+pcre2_dfa_workspace_free(pcre2_dfa_workspace *dfa_workspace)
+{
+if (dfa_workspace != NULL)
+  {
+  RWS_anchor *rws = dfa_workspace->rws;
+  while (rws != NULL)
+    {
+    RWS_anchor *next = rws->next;
+    dfa_workspace->memctl.free(rws, dfa_workspace->memctl.memory_data);
+    rws = next;
+    }
+  if (dfa_workspace->workspace != NULL)
+    dfa_workspace->memctl.free(dfa_workspace->workspace,
+      dfa_workspace->memctl.memory_data);
+  dfa_workspace->memctl.free(dfa_workspace,
+    dfa_workspace->memctl.memory_data);
+  }
+}
+
+
+
+/*************************************************
+*        Get the size of a DFA workspace         *
+*************************************************/
+
+/* The result is the number of ints in the state vector. */
+
+PCRE2_EXP_DEFN PCRE2_SIZE PCRE2_CALL_CONVENTION
+pcre2_get_dfa_workspace_size(pcre2_dfa_workspace *dfa_workspace)
+{
+return dfa_workspace->wscount;
+}
+
 /* These #undefs are here to enable unity builds with CMake. */
 
 #undef NLBLOCK /* Block containing newline information */
@@ -68,6 +68,68 @@ return NULL;
 #else
 
 
+/*************************************************
+*       Grapheme cluster transition table        *
+*************************************************/
+
+/* The rules for finding the end of an extended grapheme cluster are described
+with PRIV(ucp_gbtable) in pcre2_tables.c. Two of them (emoji ZWJ sequences and
+regional indicator pairs) need more than the properties of two adjacent
+characters, so here the left-hand property is extended into a state that
+remembers the extra context. The first 15 states are the ucp_gbXX values (a
+Regional_Indicator state occurs only for the first character); the others are:
+
+  GBS_EP_ZWJ   ZWJ that follows Extended_Pictographic (with optional Extend
+                 characters in between)
+  GBS_RI_EVEN  Regional indicator preceded by an even number of RIs
+  GBS_RI_PAIR  Regional indicator that completes a pair
+
+A state is entered for the first character with just its ucp_gbXX value. The
+table is indexed by the current state and the property of the next character,
+and gives the next state, or GB_XX if there is a grapheme break. The remaining
+value, GB_RC, occurs only for two RIs at the start of a sequence; the number of
+RIs that precede the first one must be counted in the subject to decide.
+
+This table was generated from PRIV(ucp_gbtable) and the additional rules, and
+must be kept in step with it. */
+
+#define GBS_EP_ZWJ    15
+#define GBS_RI_EVEN   16
+#define GBS_RI_PAIR   17
+
+#define GB_XX 255   /* Grapheme break */
+#define GB_RC 254   /* Count preceding RIs */
+
+#define XX GB_XX
+#define RC GB_RC
+
+static const uint8_t gb_transitions[][ucp_gbExtended_Pictographic + 1] = {
+/*  CR LF Ct Ex Pr SM  L  V  T LV LT RI Ot ZJ EP */
+  { XX, 1,XX,XX,XX,XX,XX,XX,XX,XX,XX,XX,XX,XX,XX },  /*  0 CR */
+  { XX,XX,XX,XX,XX,XX,XX,XX,XX,XX,XX,XX,XX,XX,XX },  /*  1 LF */
+  { XX,XX,XX,XX,XX,XX,XX,XX,XX,XX,XX,XX,XX,XX,XX },  /*  2 Control */
+  { XX,XX,XX, 3,XX, 5,XX,XX,XX,XX,XX,XX,XX,13,XX },  /*  3 Extend */
+  { XX,XX,XX, 3, 4, 5, 6, 7, 8, 9,10,16,12,13,XX },  /*  4 Prepend */
+  { XX,XX,XX, 3,XX, 5,XX,XX,XX,XX,XX,XX,XX,13,XX },  /*  5 SpacingMark */
+  { XX,XX,XX, 3,XX, 5, 6, 7,XX, 9,10,XX,XX,13,XX },  /*  6 L */
+  { XX,XX,XX, 3,XX, 5,XX, 7, 8,XX,XX,XX,XX,13,XX },  /*  7 V */
+  { XX,XX,XX, 3,XX, 5,XX,XX, 8,XX,XX,XX,XX,13,XX },  /*  8 T */
+  { XX,XX,XX, 3,XX, 5,XX, 7, 8,XX,XX,XX,XX,13,XX },  /*  9 LV */
+  { XX,XX,XX, 3,XX, 5,XX,XX, 8,XX,XX,XX,XX,13,XX },  /* 10 LVT */
+  { XX,XX,XX,XX,XX,XX,XX,XX,XX,XX,XX,RC,XX,XX,XX },  /* 11 RI */
+  { XX,XX,XX, 3,XX, 5,XX,XX,XX,XX,XX,XX,XX,13,XX },  /* 12 Other */
+  { XX,XX,XX, 3,XX, 5,XX,XX,XX,XX,XX,XX,XX,13,XX },  /* 13 ZWJ */
+  { XX,XX,XX,14,XX, 5,XX,XX,XX,XX,XX,XX,XX,15,XX },  /* 14 ExtPict */
+  { XX,XX,XX, 3,XX, 5,XX,XX,XX,XX,XX,XX,XX,13,14 },  /* 15 ZWJ after ExtPict */
+  { XX,XX,XX,XX,XX,XX,XX,XX,XX,XX,XX,17,XX,XX,XX },  /* 16 RI, even count */
+  { XX,XX,XX,XX,XX,XX,XX,XX,XX,XX,XX,XX,XX,XX,XX },  /* 17 RI pair */
+};
+
+#undef XX
+#undef RC
+
+
+
 /*************************************************
 *      Match an extended grapheme sequence       *
 *************************************************/
@@ -77,6 +139,12 @@ purpose functions in the pcre2_jit_compile.c module. If the logic below is
 changed, they must be kept in step so that the interpreter and the JIT have the
 same behaviour.
 
+No character below U+0100 has the Prepend property, and an ASCII character can
+only be part of a longer sequence when it is LF following CR. Thus a sequence
+that starts with such a character and is followed by an ASCII character is just
+one character long, and the properties of ASCII characters can be found without
+consulting the UCD tables. Most text is handled by these fast paths.
+
 Arguments:
   c              the first character
   eptr           pointer to next character
@@ -93,27 +161,36 @@ PCRE2_SPTR
 PRIV(extuni)(uint32_t c, PCRE2_SPTR eptr, PCRE2_SPTR start_subject,
   PCRE2_SPTR end_subject, BOOL utf, int *xcount)
 {
-BOOL was_ep_ZWJ = FALSE;
-int lgb = UCD_GRAPHBREAK(c);
+int state;
+
+if (c < 256 && c != CHAR_CR && (eptr >= end_subject || *eptr < 128))
+  return eptr;
+
+state = UCD_GRAPHBREAK(c);
 
 while (eptr < end_subject)
   {
-  int rgb;
+  int rgb, next;
   int len = 1;
-  if (!utf) c = *eptr; else { GETCHARLEN(c, eptr, len); }
-  rgb = UCD_GRAPHBREAK(c);
-  if ((PRIV(ucp_gbtable)[lgb] & (1u << rgb)) == 0) break;
 
-  /* ZWJ followed by Extended Pictographic is allowed only if the ZWJ was
-  preceded by Extended Pictographic. */
+  c = *eptr;
+  if (c < 128)
+    rgb = (c >= 32 && c < 127)? ucp_gbOther :
+          (c == CHAR_CR)? ucp_gbCR :
+          (c == CHAR_LF)? ucp_gbLF : ucp_gbControl;
+  else
+    {
+    if (utf) { GETCHARLEN(c, eptr, len); }
+    rgb = UCD_GRAPHBREAK(c);
+    }
 
-  if (lgb == ucp_gbZWJ && rgb == ucp_gbExtended_Pictographic && !was_ep_ZWJ)
-    break;
+  next = gb_transitions[state][rgb];
+  if (next == GB_XX) break;
 
   /* Not breaking between Regional Indicators is allowed only if there
   are an even number of preceding RIs. */
 
-  if (lgb == ucp_gbRegional_Indicator && rgb == ucp_gbRegional_Indicator)
+  if (next == GB_RC)
     {
     int ricount = 0;
     PCRE2_SPTR bptr = eptr - 1;
@@ -135,18 +212,10 @@ while (eptr < end_subject)
       ricount++;
       }
     if ((ricount & 1) != 0) break;  /* Grapheme break required */
+    next = GBS_RI_PAIR;
     }
 
-  /* Set a flag when ZWJ follows Extended Pictographic (with optional Extend in
-  between; see next statement). */
-
-  was_ep_ZWJ = (lgb == ucp_gbExtended_Pictographic && rgb == ucp_gbZWJ);
-
-  /* If Extend follows Extended_Pictographic, do not update lgb; this allows
-  any number of them before a following ZWJ. */
-
-  if (rgb != ucp_gbExtend || lgb != ucp_gbExtended_Pictographic) lgb = rgb;
-
+  state = next;
   eptr += len;
   if (xcount != NULL) *xcount += 1;
   }
@@ -524,6 +524,12 @@ bytes in a code unit in that mode. */
 #define PCRE2_HASBKC        0x00400000u /* contains \C */
 #define PCRE2_HASACCEPT     0x00800000u /* contains (*ACCEPT) */
 #define PCRE2_HASBSK        0x01000000u /* contains \K */
+#define PCRE2_BITPARALLEL   0x02000000u /* bit-parallel DFA tables are set */
+#define PCRE2_ONEPASS       0x04000000u /* one-pass matching is possible */
+#define PCRE2_LITERALPAT    0x08000000u /* pattern is a plain literal string */
+#define PCRE2_NOCAPREF      0x10000000u /* captures not referenced when matching */
+#define PCRE2_ENDANCHOR     0x20000000u /* every branch ends with $ or \z */
+#define PCRE2_MAPPED        0x40000000u /* code is in a read-only region */
 
 #define PCRE2_MODE_MASK     (PCRE2_MODE8 | PCRE2_MODE16 | PCRE2_MODE32)
 
@@ -1563,6 +1569,17 @@ is set, when the item is not the beginning of a range. The XCL_CHAR_SHIFT
 can be used to encode / decode the character value stored in an item. */
 #define XCL_CHAR_END 0x1
 #define XCL_CHAR_SHIFT 1
+/* This bit is set outside XCL_TYPE_MASK when the character lists are
+preceded by a two-level bitmap of the characters from 0x100 to 0xffff, which
+replaces the binary search of the 16 bit lists. The last XCL_BMPMAP_INDEX_SIZE
+bytes before the lists are indexed by the high byte of the character and hold
+leaf numbers. Leaf N is the XCL_BMPMAP_LEAF_SIZE bytes that end
+N * XCL_BMPMAP_LEAF_SIZE bytes before the index. Leaf 0 is empty and leaf 1
+is full. Only the interpreters use the bitmap; other readers of the lists mask
+the type with XCL_TYPE_MASK and never see this bit. */
+#define XCL_BMPMAP 0x2000
+#define XCL_BMPMAP_INDEX_SIZE 256
+#define XCL_BMPMAP_LEAF_SIZE 32
 
 /* Flag bits for an extended class (OP_ECLASS), which is used for complex
 character matches such as [\p{Greek} && \p{Ll}]. */
@@ -2157,6 +2174,41 @@ typedef struct {
   ((uint32_t)(ch) == 0x0130u ?   0x69u : \
    (uint32_t)(ch) ==   0x49u ? 0x0131u : (uint32_t)(ch))
 
+/* Some frequently used properties can be tested in a bitset, without fetching
+the character's record. There is a group of bitsets for each block in the
+ucd_stage2 table, indexed by the value from ucd_stage1. The UCD_PROPBIT()
+macro yields 1 if the character has the property and 0 otherwise. The two
+macros that follow use the bitsets for a general category or particular type
+when one is available. The bits for ASCII characters are also available as
+16-byte class maps in ucd_propbits_ascii. The order of these values must match
+the bitsets generated by maint/GenerateUcd.py. */
+
+#define UCD_PROPBITS_L       0   /* General category L */
+#define UCD_PROPBITS_ND      1   /* Particular type Nd (\d under UCP) */
+#define UCD_PROPBITS_ALNUM   2   /* General category L or N */
+#define UCD_PROPBITS_SPACE   3   /* General category Z or white space */
+#define UCD_PROPBITS_WORD    4   /* L, N, Mn, or Pc (\w under UCP) */
+#define UCD_PROPBITS_COUNT   5
+
+#define REAL_UCD_PROPBIT(ch, n) ((int)((PRIV(ucd_propbits)[ \
+  (PRIV(ucd_stage1)[(int)(ch) / UCD_BLOCK_SIZE] * UCD_PROPBITS_COUNT + (n)) * \
+  (UCD_BLOCK_SIZE / 32) + (int)(ch) % UCD_BLOCK_SIZE / 32] >> \
+  ((ch) % 32)) & 1u))
+
+#if PCRE2_CODE_UNIT_WIDTH == 32
+#define UCD_PROPBIT(ch, n) (((ch) > MAX_UTF_CODE_POINT)? 0 : \
+  REAL_UCD_PROPBIT(ch, n))
+#else
+#define UCD_PROPBIT(ch, n) REAL_UCD_PROPBIT(ch, n)
+#endif
+
+#define UCD_PROPBITS_ASCII(n) (PRIV(ucd_propbits_ascii) + 16 * (n))
+
+#define UCD_CATEGORY_IS(ch, gc) (((gc) == ucp_L)? \
+  UCD_PROPBIT(ch, UCD_PROPBITS_L) : UCD_CATEGORY(ch) == (gc))
+#define UCD_CHARTYPE_IS(ch, pc) (((pc) == ucp_Nd)? \
+  UCD_PROPBIT(ch, UCD_PROPBITS_ND) : UCD_CHARTYPE(ch) == (pc))
+
 /* The "scriptx" and bprops fields contain offsets into vectors of 32-bit words
 that form a bitmap representing a list of scripts or boolean properties. These
 macros test or set a bit in the map by number. */
@@ -2173,6 +2225,64 @@ typedef struct pcre2_serialized_data {
   int32_t  number_of_codes;
 } pcre2_serialized_data;
 
+/* Header for a region of compiled codes that are used in place, made by
+pcre2_serialize_encode_region(). It is followed by a vector of offsets to the
+codes, then the character tables, then the codes. Each part starts on a
+REGION_ALIGNMENT boundary. The codes have the PCRE2_MAPPED flag set, and
+their memctl, tables, and executable_jit fields are zero. Instead, each code
+block is followed by a PCRE2_SIZE (aligned) that is the distance back from the
+start of the code to the tables. There are no pointers in a region, so it can
+be mapped at any address. */
+
+typedef struct pcre2_serialized_region {
+  uint32_t   magic;
+  uint32_t   version;
+  uint32_t   config;
+  int32_t    number_of_codes;
+  PCRE2_SIZE size;
+} pcre2_serialized_region;
+
+#define REGION_ALIGNMENT 8
+#define REGION_ALIGN(x) \
+  (((x) + REGION_ALIGNMENT - 1) & ~(PCRE2_SIZE)(REGION_ALIGNMENT - 1))
+
+/* The tables and memory control functions of a compiled code must be found by
+these macros anywhere that the code might be in a region, because its own
+fields are not usable. */
+
+#define CODE_TABLES(re) ((((re)->flags & PCRE2_MAPPED) == 0)? \
+  (re)->tables : PRIV(mapped_tables)(re))
+
+#define CODE_MEMCTL(re) ((((re)->flags & PCRE2_MAPPED) == 0)? \
+  &(re)->memctl : &PRIV(default_compile_context).memctl)
+
+/* Tables for the bit-parallel version of pcre2_dfa_match(). They are built by
+_pcre2_study_bitparallel() for patterns that are a simple sequence of
+single-character items, each possibly repeated, and are stored in the compiled
+block between the name table and the code. Each item is expanded into one or
+more positions; bit n of a mask refers to position n, and the bit above the
+last position is the accepting state. A position may be skipped when its bit is
+set in the "optional" mask, except that a possessive position may not be
+skipped when the next character matches it. A position whose bit is set in the
+"loop" mask stays active after it has matched. */
+
+#define BITPARALLEL_MAX_POSITIONS  63
+#define BITPARALLEL_MAX_EXCEPTIONS 16
+
+typedef struct dfa_bitparallel {
+  uint64_t chars[256];        /* Positions matched by characters < 256 */
+  uint64_t high;              /* Positions matched by other characters */
+  uint64_t except_masks[BITPARALLEL_MAX_EXCEPTIONS];  /* Positions matched */
+  uint32_t except_chars[BITPARALLEL_MAX_EXCEPTIONS];  /* by these characters */
+  uint64_t optional;          /* Positions that can be skipped */
+  uint64_t possessive;        /* Optional positions that are possessive */
+  uint64_t loop;              /* Positions that repeat indefinitely */
+  uint64_t accept;            /* The accepting state */
+  uint32_t except_count;      /* Number of exception characters */
+  uint8_t  start_assert;      /* OP_CIRC, OP_SOD, OP_SOM, or OP_END */
+  uint8_t  end_assert;        /* OP_DOLL, OP_EOD, OP_EODN, or OP_END */
+} dfa_bitparallel;
+
 
 
 /* ----------------- Items that need PCRE2_CODE_UNIT_WIDTH ----------------- */
@@ -2224,6 +2334,8 @@ extern const uint8_t          PRIV(utf8_table4)[];
 #define _pcre2_ucd_turkish_dotted_i_caseset  PCRE2_SUFFIX(_pcre2_ucd_turkish_dotted_i_caseset_)
 #define _pcre2_ucd_nocase_ranges       PCRE2_SUFFIX(_pcre2_ucd_nocase_ranges_)
 #define _pcre2_ucd_nocase_ranges_size  PCRE2_SUFFIX(_pcre2_ucd_nocase_ranges_size_)
+#define _pcre2_ucd_propbits            PCRE2_SUFFIX(_pcre2_ucd_propbits_)
+#define _pcre2_ucd_propbits_ascii      PCRE2_SUFFIX(_pcre2_ucd_propbits_ascii_)
 #define _pcre2_ucd_digit_sets          PCRE2_SUFFIX(_pcre2_ucd_digit_sets_)
 #define _pcre2_ucd_script_sets         PCRE2_SUFFIX(_pcre2_ucd_script_sets_)
 #define _pcre2_ucd_records             PCRE2_SUFFIX(_pcre2_ucd_records_)
@@ -2253,6 +2365,8 @@ extern const uint32_t                  PRIV(ucd_caseless_sets)[];
 extern const uint32_t                  PRIV(ucd_turkish_dotted_i_caseset);
 extern const uint32_t                  PRIV(ucd_nocase_ranges)[];
 extern const uint32_t                  PRIV(ucd_nocase_ranges_size);
+extern const uint32_t                  PRIV(ucd_propbits)[];
+extern const uint8_t                   PRIV(ucd_propbits_ascii)[];
 extern const uint32_t                  PRIV(ucd_digit_sets)[];
 extern const uint32_t                  PRIV(ucd_script_sets)[];
 extern const ucd_record                PRIV(ucd_records)[];
@@ -2299,13 +2413,17 @@ is available. */
 #define _pcre2_extuni                PCRE2_SUFFIX(_pcre2_extuni_)
 #define _pcre2_find_bracket          PCRE2_SUFFIX(_pcre2_find_bracket_)
 #define _pcre2_is_newline            PCRE2_SUFFIX(_pcre2_is_newline_)
+#define _pcre2_mapped_tables         PCRE2_SUFFIX(_pcre2_mapped_tables_)
 #define _pcre2_jit_free_rodata       PCRE2_SUFFIX(_pcre2_jit_free_rodata_)
 #define _pcre2_jit_free              PCRE2_SUFFIX(_pcre2_jit_free_)
 #define _pcre2_jit_check_exec        PCRE2_SUFFIX(_pcre2_jit_check_exec_)
 #define _pcre2_jit_get_size          PCRE2_SUFFIX(_pcre2_jit_get_size_)
 #define _pcre2_jit_get_target        PCRE2_SUFFIX(_pcre2_jit_get_target_)
+#define _pcre2_memchr2               PCRE2_SUFFIX(_pcre2_memchr2_)
 #define _pcre2_memctl_malloc         PCRE2_SUFFIX(_pcre2_memctl_malloc_)
 #define _pcre2_ord2utf               PCRE2_SUFFIX(_pcre2_ord2utf_)
+#define _pcre2_scan_class_run        PCRE2_SUFFIX(_pcre2_scan_class_run_)
+#define _pcre2_scan_start_bits       PCRE2_SUFFIX(_pcre2_scan_start_bits_)
 #define _pcre2_script_run            PCRE2_SUFFIX(_pcre2_script_run_)
 #define _pcre2_strcmp                PCRE2_SUFFIX(_pcre2_strcmp_)
 #define _pcre2_strcmp_c8             PCRE2_SUFFIX(_pcre2_strcmp_c8_)
@@ -2314,6 +2432,8 @@ is available. */
 #define _pcre2_strncmp               PCRE2_SUFFIX(_pcre2_strncmp_)
 #define _pcre2_strncmp_c8            PCRE2_SUFFIX(_pcre2_strncmp_c8_)
 #define _pcre2_study                 PCRE2_SUFFIX(_pcre2_study_)
+#define _pcre2_study_bitparallel     PCRE2_SUFFIX(_pcre2_study_bitparallel_)
+#define _pcre2_study_onepass         PCRE2_SUFFIX(_pcre2_study_onepass_)
 #define _pcre2_valid_utf             PCRE2_SUFFIX(_pcre2_valid_utf_)
 #define _pcre2_was_newline           PCRE2_SUFFIX(_pcre2_was_newline_)
 #define _pcre2_xclass                PCRE2_SUFFIX(_pcre2_xclass_)
@@ -2334,8 +2454,15 @@ extern void         _pcre2_jit_free(void *, pcre2_memctl *);
 extern BOOL         _pcre2_jit_check_exec(void *, uint32_t);
 extern size_t       _pcre2_jit_get_size(void *);
 const char *        _pcre2_jit_get_target(void);
+extern PCRE2_SPTR   _pcre2_memchr2(PCRE2_SPTR, PCRE2_SPTR, PCRE2_UCHAR,
+                      PCRE2_UCHAR);
+extern const uint8_t *_pcre2_mapped_tables(const pcre2_real_code *);
 extern void *       _pcre2_memctl_malloc(size_t, pcre2_memctl *);
 extern unsigned int _pcre2_ord2utf(uint32_t, PCRE2_UCHAR *);
+extern PCRE2_SPTR   _pcre2_scan_class_run(PCRE2_SPTR, PCRE2_SPTR,
+                      const uint8_t *, BOOL, BOOL);
+extern PCRE2_SPTR   _pcre2_scan_start_bits(PCRE2_SPTR, PCRE2_SPTR,
+                      const pcre2_real_code *);
 extern BOOL         _pcre2_script_run(PCRE2_SPTR, PCRE2_SPTR, BOOL);
 extern int          _pcre2_strcmp(PCRE2_SPTR, PCRE2_SPTR);
 extern int          _pcre2_strcmp_c8(PCRE2_SPTR, const char *);
@@ -2344,6 +2471,8 @@ extern PCRE2_SIZE   _pcre2_strlen(PCRE2_SPTR);
 extern int          _pcre2_strncmp(PCRE2_SPTR, PCRE2_SPTR, size_t);
 extern int          _pcre2_strncmp_c8(PCRE2_SPTR, const char *, size_t);
 extern int          _pcre2_study(pcre2_real_code *);
+extern BOOL         _pcre2_study_bitparallel(pcre2_real_code *);
+extern BOOL         _pcre2_study_onepass(const pcre2_real_code *);
 extern int          _pcre2_valid_utf(PCRE2_SPTR, PCRE2_SIZE, PCRE2_SIZE *);
 extern BOOL         _pcre2_was_newline(PCRE2_SPTR, uint32_t, PCRE2_SPTR,
                       uint32_t *, BOOL);
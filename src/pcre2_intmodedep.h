@@ -60,6 +60,7 @@ zero in order to simply clear the previous macros. */
 
 #undef ACROSSCHAR
 #undef BACKCHAR
+#undef BITPARALLEL_OFFSET
 #undef BYTES2CU
 #undef CHMAX_255
 #undef CU2BYTES
@@ -552,6 +553,13 @@ These are all no-ops since all UTF-32 characters fit into one PCRE2_UCHAR. */
 #define PUTINC(a,n,d)   PUT(a,n,d), a += LINK_SIZE
 #define PUT2INC(a,n,d)  PUT2(a,n,d), a += IMM2_SIZE
 
+/* The offset of the bit-parallel DFA tables in a compiled pattern's block,
+when they exist. They follow the name table, aligned for 64-bit access. */
+
+#define BITPARALLEL_OFFSET(re) \
+  ((sizeof(pcre2_real_code) + \
+    CU2BYTES((size_t)(re)->name_count * (re)->name_entry_size) + 7) & ~(size_t)7)
+
 #endif /* PCRE2_CODE_UNIT_WIDTH != 0 */
 
 
@@ -603,6 +611,7 @@ typedef struct pcre2_real_compile_context {
   int (*stack_guard)(uint32_t, void *);
   void *stack_guard_data;
   const uint8_t *tables;
+  pcre2_compile_arena *arena;
   PCRE2_SIZE max_pattern_length;
   PCRE2_SIZE max_pattern_compiled_length;
   uint16_t bsr_convention;
@@ -613,6 +622,21 @@ typedef struct pcre2_real_compile_context {
   uint32_t optimization_flags;
 } pcre2_real_compile_context;
 
+/* The real compile arena structure. While pcre2_compile() is using an arena,
+its temporary memory is carved in order from a single block that is reset for
+each compilation and enlarged to fit the largest one seen, so that repeated
+compilations need no temporary allocations. */
+
+typedef struct pcre2_real_compile_arena {
+  pcre2_memctl memctl;             /* Memory control fields */
+  uint8_t     *block;              /* The arena's memory */
+  PCRE2_SIZE   size;               /* Size of the block */
+  PCRE2_SIZE   used;               /* Amount of the block in use */
+  PCRE2_SIZE   last;               /* Offset of the most recent allocation */
+  PCRE2_SIZE   needed;             /* Total requested by this compilation */
+  BOOL         in_use;             /* Currently in use by pcre2_compile() */
+} pcre2_real_compile_arena;
+
 /* The real match context structure. */
 
 typedef struct pcre2_real_match_context {
@@ -628,6 +652,14 @@ typedef struct pcre2_real_match_context {
   PCRE2_SIZE (*substitute_case_callout)(PCRE2_SPTR, PCRE2_SIZE, PCRE2_UCHAR *,
                                         PCRE2_SIZE, int, void *);
   void        *substitute_case_callout_data;
+  int        (*substitute_output)(PCRE2_SPTR, PCRE2_SIZE, void *);
+  void        *substitute_output_data;
+  pcre2_frame_pool *frame_pool;
+  pcre2_dfa_workspace *dfa_workspace;
+#ifdef SUPPORT_PROFILE
+  PCRE2_SIZE *profile_counts;
+  PCRE2_SIZE profile_size;
+#endif
   PCRE2_SIZE offset_limit;
   uint32_t heap_limit;
   uint32_t match_limit;
@@ -642,6 +674,35 @@ typedef struct pcre2_real_convert_context {
   uint32_t glob_escape;
 } pcre2_real_convert_context;
 
+/* The real compiled glob structure, as made by pcre2_glob_compile(). The
+glob program, a vector of uint32_t items, follows it in the same block. */
+
+typedef struct pcre2_real_glob {
+  pcre2_memctl memctl;
+  PCRE2_SIZE blocksize;          /* Total size of the block */
+  uint32_t flags;                /* Mode flags */
+  uint32_t separator;            /* Glob separator */
+  uint32_t last_unit;            /* Required last code unit of the subject */
+  uint32_t literal_offset;       /* Offset of longest literal in the program */
+  uint32_t literal_length;       /* Length of that literal */
+  uint32_t code_length;          /* Length of the program */
+} pcre2_real_glob;
+
+/* The real glob set structure. The glob pointers, the list of globs with no
+last code unit, the lists of the others, and copies of the globs follow it in
+the same block. */
+
+typedef struct pcre2_real_glob_set {
+  pcre2_memctl memctl;
+  const pcre2_real_glob **globs; /* Copies of the globs */
+  uint32_t *any_list;            /* Globs with no required last code unit */
+  uint32_t *bucket_list;         /* Globs, sorted by last code unit */
+  uint32_t count;                /* Number of globs */
+  uint32_t any_count;            /* Length of any_list */
+  BOOL utf;                      /* Any glob is in UTF mode */
+  uint32_t bucket_start[257];    /* Start of each list in bucket_list */
+} pcre2_real_glob_set;
+
 /* The real compiled code structure. The type for the blocksize field is
 defined specially because it is required in pcre2_serialize_decode() when
 copying the size from possibly unaligned memory into a variable of the same
@@ -662,6 +723,7 @@ typedef struct pcre2_real_code {
   const uint8_t *tables;          /* The character tables */
   void    *executable_jit;        /* Pointer to JIT code */
   uint8_t  start_bitmap[32];      /* Bitmap for starting code unit < 256 */
+  uint8_t  start_nibbles[32];     /* start_bitmap indexed by nibbles */
   CODE_BLOCKSIZE_TYPE blocksize;  /* Total (bytes) that was malloc-ed */
   CODE_BLOCKSIZE_TYPE code_start; /* Byte code start offset */
   uint32_t magic_number;          /* Paranoid and endianness check */
@@ -678,6 +740,7 @@ typedef struct pcre2_real_code {
   uint16_t newline_convention;    /* What is a newline? */
   uint16_t max_lookbehind;        /* Longest lookbehind (characters) */
   uint16_t minlength;             /* Minimum length of match */
+  uint16_t maxlength;             /* Maximum length of match, if bounded */
   uint16_t top_bracket;           /* Highest numbered group */
   uint16_t top_backref;           /* Highest numbered back reference */
   uint16_t name_entry_size;       /* Size (code units) of table entries */
@@ -715,6 +778,53 @@ typedef struct pcre2_real_match_data {
   PCRE2_SIZE       ovector[131072];  /* Must be last in the structure */
 } pcre2_real_match_data;
 
+/* The real frame pool structure. A frame pool holds a backtracking frames
+vector that pcre2_match() borrows instead of using the one in the match data
+block, so that a single vector can be shared by any number of match data blocks
+that are used in turn (typically by one thread). The in_use flag stops a
+recursive call of pcre2_match() from a callout using the vector while it is
+already lent out. */
+
+typedef struct pcre2_real_frame_pool {
+  pcre2_memctl     memctl;           /* Memory control fields */
+  struct heapframe *heapframes;      /* Backtracking frames heap memory */
+  PCRE2_SIZE       heapframes_size;  /* Malloc-ed size */
+  BOOL             in_use;           /* Currently lent to pcre2_match() */
+} pcre2_real_frame_pool;
+
+/* The real DFA workspace structure. It holds a state vector that
+pcre2_dfa_match() uses when it is called without a workspace argument, and it
+keeps the chain of heap blocks that are used for recursive calls of the
+internal matching function, so that repeated matching needs no fresh memory.
+The state vector is made large enough for each pattern that uses it. As for a
+frame pool, the in_use flag stops a recursive call from a callout using the
+workspace while it is already lent out. */
+
+typedef struct pcre2_real_dfa_workspace {
+  pcre2_memctl       memctl;         /* Memory control fields */
+  int               *workspace;      /* State vector */
+  PCRE2_SIZE         wscount;        /* Number of ints in the vector */
+  struct RWS_anchor *rws;            /* Kept recursion workspace blocks */
+  BOOL               in_use;         /* Currently lent to pcre2_dfa_match() */
+} pcre2_real_dfa_workspace;
+
+/* The real compiled replacement structure. There are two item programs: the
+second is used only when a substitution starts in \Q literal mode because the
+previous one ended inside an unterminated \Q. The items, group list, and
+literals follow the structure in the same memory block. */
+
+typedef struct pcre2_real_replacement {
+  pcre2_memctl     memctl;           /* Memory control fields */
+  const pcre2_real_code *code;       /* The pattern it was compiled for */
+  struct replacement_item *items;    /* The item programs */
+  uint32_t         *groups;          /* Candidate groups for duplicate names */
+  PCRE2_SPTR       literals;         /* Literal text */
+  uint32_t         options;          /* Substitute options given when compiled */
+  PCRE2_SIZE       program_start[2]; /* First item of each program */
+  PCRE2_SIZE       program_items[2]; /* Number of items in each program */
+  BOOL             ends_literal[2];  /* Program ends in \Q literal mode */
+} pcre2_real_replacement;
+
 
 /* ----------------------- PRIVATE STRUCTURES ----------------------------- */
 
@@ -780,6 +890,7 @@ typedef struct class_ranges {
   size_t char_lists_start;         /* Start offset of encoded char lists */
   uint16_t range_list_size;        /* Size of ranges array */
   uint16_t char_lists_types;       /* The XCL_LIST header of char lists */
+  uint16_t char_lists_map_size;    /* Size of XCL_BMPMAP data, or zero */
   /* Followed by the list of ranges (start/end pairs) */
 } class_ranges;
 
@@ -801,6 +912,7 @@ doing the compiling, so that they are thread-safe. */
 
 typedef struct compile_block {
   pcre2_real_compile_context *cx;  /* Points to the compile context */
+  pcre2_memctl *memctl;            /* For temporary memory */
   const uint8_t *lcc;              /* Points to lower casing table */
   const uint8_t *fcc;              /* Points to case-flipping table */
   const uint8_t *cbits;            /* Points to character type table */
@@ -838,6 +950,7 @@ typedef struct compile_block {
   uint32_t max_varlookbehind;      /* Limit for variable lookbehinds */
   int  max_lookbehind;             /* Maximum lookbehind encountered (characters) */
   BOOL had_accept;                 /* (*ACCEPT) encountered */
+  BOOL captures_visible;           /* Captures seen by callout or (*scs:) */
   BOOL had_pruneorskip;            /* (*PRUNE) or (*SKIP) encountered */
   BOOL had_recurse;                /* Had a pattern recursion or subroutine call */
   BOOL dupnames;                   /* Duplicate names exist */
@@ -880,6 +993,9 @@ typedef struct heapframe {
 
   PCRE2_SPTR ecode;          /* The current position in the pattern */
   PCRE2_SIZE back_frame;     /* Amount to subtract on RRETURN */
+#ifdef SUPPORT_PROFILE
+  PCRE2_SPTR profile_ecode;  /* Opcode being processed, for profiling */
+#endif
   uint32_t rdepth;           /* Function "recursion" depth within pcre2_match() */
   uint32_t group_frame_type; /* Type information for group frames */
   uint8_t return_id;         /* Where to go on in internal "return" */
@@ -1035,6 +1151,7 @@ doing traditional NFA matching (pcre2_match() and friends). */
 
 typedef struct match_block {
   pcre2_memctl memctl;            /* For general use */
+  pcre2_memctl *frames_memctl;    /* For the backtracking frames vector */
   uint32_t heap_limit;            /* As it says */
   uint32_t match_limit;           /* As it says */
   uint32_t match_limit_depth;     /* As it says */
@@ -1077,6 +1194,10 @@ typedef struct match_block {
   pcre2_callout_block *cb;        /* Points to a callout block */
   void  *callout_data;            /* To pass back to callouts */
   int (*callout)(pcre2_callout_block *,void *);  /* Callout function or NULL */
+#ifdef SUPPORT_PROFILE
+  PCRE2_SIZE *profile_counts;     /* Profile counts vector or NULL */
+  PCRE2_SIZE profile_size;        /* Number of elements in the vector */
+#endif
 } match_block;
 
 /* A similar structure is used for the same purpose by the DFA matching
@@ -1084,6 +1205,8 @@ functions. */
 
 typedef struct dfa_match_block {
   pcre2_memctl memctl;            /* For general use */
+  pcre2_memctl *rws_memctl;       /* For recursion workspace blocks */
+  struct RWS_anchor *rws_last;    /* Last such block reached in this match */
   PCRE2_SPTR start_code;          /* Start of the compiled pattern */
   PCRE2_SPTR start_subject ;      /* Start of the subject string */
   PCRE2_SPTR end_subject;         /* End of subject string */
@@ -1109,6 +1232,28 @@ typedef struct dfa_match_block {
   dfa_recursion_info *recursive;  /* Linked list of pattern recursion data */
 } dfa_match_block;
 
+/* An item in a compiled replacement. The replacement string is parsed once,
+by pcre2_replacement_compile() or pcre2_substitute(), into a vector of these
+items, which is then interpreted for each substitution. Literal runs point into
+the replacement's literal buffer; named groups are resolved to a group number,
+or, for duplicate names, to a list of candidates in the replacement's group
+list. A conditional item is followed by the items of its first and then of its
+second text. An error item holds the negated error code in its group field. */
+
+typedef struct replacement_item {
+  uint8_t          type;             /* One of the REPL_xxx values */
+  uint8_t          special;          /* CHAR_PLUS or CHAR_MINUS (REPL_COND) */
+  uint8_t          to_case;          /* Case forcing (REPL_CASE) */
+  uint8_t          single_char;      /* Case forcing (REPL_CASE) */
+  uint32_t         group;            /* Group number or first in group list */
+  uint32_t         group_count;      /* Number in group list; 0 for a number */
+  PCRE2_SIZE       text1_items;      /* Length of first text (REPL_COND) */
+  PCRE2_SIZE       text2_items;      /* Length of second text (REPL_COND) */
+  PCRE2_SIZE       start;            /* Literal run start in literal buffer */
+  PCRE2_SIZE       length;           /* Literal run length */
+  PCRE2_SIZE       offset;           /* Offset after the item in replacement */
+} replacement_item;
+
 #endif  /* PCRE2_PCRE2TEST */
 
 #endif /* PCRE2_INTMODEDEP_CAN_DEFINE */
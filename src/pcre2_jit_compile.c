@@ -14325,6 +14325,12 @@ if (code == NULL)
 if ((options & ~PUBLIC_JIT_COMPILE_OPTIONS) != 0)
   return PCRE2_ERROR_JIT_BADOPTION;
 
+/* A code in a region made by pcre2_serialize_encode_region() is read-only, so
+there is nowhere to keep the JIT code. */
+
+if ((re->flags & PCRE2_MAPPED) != 0)
+  return PCRE2_ERROR_JIT_UNSUPPORTED;
+
 /* Support for invalid UTF was first introduced in JIT, with the option
 PCRE2_JIT_INVALID_UTF. Later, support was added to the interpreter, and the
 compile-time option PCRE2_MATCH_INVALID_UTF was created. This is now the
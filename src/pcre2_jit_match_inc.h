@@ -171,6 +171,9 @@ else
 max_oveccount = functions->top_bracket;
 if (oveccount > max_oveccount)
   oveccount = max_oveccount;
+/* Only the whole match is returned when captures are not wanted. */
+if ((options & PCRE2_NO_CAPTURES) != 0)
+  oveccount = 1;
 arguments.oveccount = oveccount << 1;
 
 
@@ -184,7 +187,7 @@ else
   rc = jit_machine_stack_exec(&arguments, convert_executable_func.call_executable_func);
 
 if (rc > (int)oveccount)
-  rc = 0;
+  rc = ((options & PCRE2_NO_CAPTURES) != 0)? 1 : 0;
 match_data->code = re;
 match_data->subject =
   (rc >= 0 || rc == PCRE2_ERROR_NOMATCH || rc == PCRE2_ERROR_PARTIAL)? subject : NULL;
@@ -72,12 +72,12 @@ information, and fields within it. */
   (PCRE2_ANCHORED|PCRE2_ENDANCHORED|PCRE2_NOTBOL|PCRE2_NOTEOL|PCRE2_NOTEMPTY| \
    PCRE2_NOTEMPTY_ATSTART|PCRE2_NO_UTF_CHECK|PCRE2_PARTIAL_HARD| \
    PCRE2_PARTIAL_SOFT|PCRE2_NO_JIT|PCRE2_COPY_MATCHED_SUBJECT| \
-   PCRE2_DISABLE_RECURSELOOP_CHECK)
+   PCRE2_DISABLE_RECURSELOOP_CHECK|PCRE2_NO_CAPTURES)
 
 #define PUBLIC_JIT_MATCH_OPTIONS \
    (PCRE2_NO_UTF_CHECK|PCRE2_NOTBOL|PCRE2_NOTEOL|PCRE2_NOTEMPTY|\
     PCRE2_NOTEMPTY_ATSTART|PCRE2_PARTIAL_SOFT|PCRE2_PARTIAL_HARD|\
-    PCRE2_COPY_MATCHED_SUBJECT)
+    PCRE2_COPY_MATCHED_SUBJECT|PCRE2_NO_CAPTURES)
 
 /* Non-error returns from and within the match() function. Error returns are
 externally defined PCRE2_ERROR_xxx codes, which are all negative. */
@@ -631,6 +631,44 @@ A partial match is returned only if no complete match can be found. */
      } \
   while (0)
 
+/* This macro is used at the start of a maximizing repeat of a character class
+or of \d, \s, \w and their negations in the 8-bit library. It skips over as
+much of the run as can be found quickly, and advances the repeat count to
+match; the loop that follows checks the character that ends the run in the
+usual way. The count i and the pointer Feptr must be set up beforehand. Only
+single code units are skipped, so in UTF mode the class must be one in which
+every ASCII character can be checked by the bitmap. SCAN_CBITS gets one of the
+class bitmaps from the character tables. */
+
+#if PCRE2_CODE_UNIT_WIDTH == 8
+#define SCAN_CLASS_RUN(map, negate, ascii) \
+  do { \
+     PCRE2_SPTR scan_start = Feptr; \
+     PCRE2_SIZE scan_len = (PCRE2_SIZE)(mb->end_subject - Feptr); \
+     if (scan_len > Lmax - i) scan_len = Lmax - i; \
+     Feptr = PRIV(scan_class_run)(Feptr, Feptr + scan_len, map, negate, \
+       ascii); \
+     i += (uint32_t)(Feptr - scan_start); \
+     } \
+  while (0)
+
+#define SCAN_CBITS(offset) (mb->ctypes - ctypes_offset + cbits_offset + (offset))
+#endif
+
+/* This is the equivalent for a maximizing repeat of a single negated
+character outside UTF mode, such as [^"]*, which is a search for either of two
+code units (the same one twice when caseful). */
+
+#define SCAN_NOT_RUN(c1, c2) \
+  do { \
+     PCRE2_SPTR scan_start = Feptr; \
+     PCRE2_SIZE scan_len = (PCRE2_SIZE)(mb->end_subject - Feptr); \
+     if (scan_len > Lmax - i) scan_len = Lmax - i; \
+     Feptr = PRIV(memchr2)(Feptr, Feptr + scan_len, c1, c2); \
+     i += (uint32_t)(Feptr - scan_start); \
+     } \
+  while (0)
+
 
 /* These macros are used to implement backtracking. They simulate a recursive
 call to the match() function by means of a local vector of frames which
@@ -652,6 +690,22 @@ remember the backtracking points. */
      } \
   while (0)
 
+/* When profiling is compiled, this macro counts an event for the opcode at
+ptr. Each code unit offset has two counts in the vector: the number of times
+the opcode was processed, and the number of times matching backtracked into
+it. Offsets beyond the end of the vector are ignored. */
+
+#ifdef SUPPORT_PROFILE
+#define PROFILE_COUNT(ptr, which) \
+  do { \
+     PCRE2_SIZE profile_index = \
+       2 * (PCRE2_SIZE)((ptr) - mb->start_code) + (which); \
+     if (profile_index < mb->profile_size) \
+       mb->profile_counts[profile_index]++; \
+     } \
+  while (0)
+#endif
+
 
 
 /*************************************************
@@ -669,7 +723,8 @@ made performance worse.
 Arguments:
    start_eptr   starting character in subject
    start_ecode  starting position in compiled code
-   top_bracket  number of capturing parentheses in the pattern
+   top_bracket  number of capturing parentheses in the pattern, or zero if
+                  captures are not being recorded
    frame_size   size of each backtracking frame
    match_data   pointer to the match_data block
    mb           pointer to "static" variables block
@@ -789,14 +844,15 @@ if ((heapframe *)((char *)N + frame_size) >= frames_top)
   another frame, so do a final check. */
 
   if (newsize - usedsize < frame_size) return PCRE2_ERROR_HEAPLIMIT;
-  new = match_data->memctl.malloc(newsize, match_data->memctl.memory_data);
+  new = mb->frames_memctl->malloc(newsize, mb->frames_memctl->memory_data);
   if (new == NULL) return PCRE2_ERROR_NOMEMORY;
   memcpy(new, match_data->heapframes, usedsize);
 
   N = (heapframe *)((char *)new + usedsize);
   F = (heapframe *)((char *)N - frame_size);
 
-  match_data->memctl.free(match_data->heapframes, match_data->memctl.memory_data);
+  mb->frames_memctl->free(match_data->heapframes,
+    mb->frames_memctl->memory_data);
   match_data->heapframes = new;
   match_data->heapframes_size = newsize;
   frames_top = (heapframe *)((char *)new + newsize);
@@ -885,6 +941,14 @@ fprintf(stderr, "++ %2ld op=%3d %s\n", Fecode - mb->start_code, *Fecode,
   OP_names[*Fecode]);
 #endif
 
+#ifdef SUPPORT_PROFILE
+  if (mb->profile_counts != NULL)
+    {
+    F->profile_ecode = Fecode;
+    PROFILE_COUNT(Fecode, 0);
+    }
+#endif
+
   Fop = (uint8_t)(*Fecode);  /* Cast needed for 16-bit and 32-bit modes */
   switch(Fop)
     {
@@ -915,9 +979,12 @@ fprintf(stderr, "++ %2ld op=%3d %s\n", Fecode - mb->start_code, *Fecode,
         }
       offset = (number << 1) - 2;
       Fcapture_last = number;
-      Fovector[offset] = P->eptr - mb->start_subject;
-      Fovector[offset+1] = Feptr - mb->start_subject;
-      if (offset >= Foffset_top) Foffset_top = offset + 2;
+      if (top_bracket != 0)
+        {
+        Fovector[offset] = P->eptr - mb->start_subject;
+        Fovector[offset+1] = Feptr - mb->start_subject;
+        if (offset >= Foffset_top) Foffset_top = offset + 2;
+        }
       }
     Fecode += PRIV(OP_lengths)[*Fecode];
     break;
@@ -1868,7 +1935,9 @@ fprintf(stderr, "++ %2ld op=%3d %s\n", Fecode - mb->start_code, *Fecode,
 
         /* Not UTF mode */
           {
-          for (i = Lmin; i < Lmax; i++)
+          i = Lmin;
+          SCAN_NOT_RUN(Lc, Loc);
+          for (; i < Lmax; i++)
             {
             if (Feptr >= mb->end_subject)
               {
@@ -2005,7 +2074,9 @@ fprintf(stderr, "++ %2ld op=%3d %s\n", Fecode - mb->start_code, *Fecode,
 #endif
         /* Not UTF mode */
           {
-          for (i = Lmin; i < Lmax; i++)
+          i = Lmin;
+          SCAN_NOT_RUN(Lc, Lc);
+          for (; i < Lmax; i++)
             {
             if (Feptr >= mb->end_subject)
               {
@@ -2201,7 +2272,11 @@ fprintf(stderr, "++ %2ld op=%3d %s\n", Fecode - mb->start_code, *Fecode,
 #ifdef SUPPORT_UNICODE
         if (utf)
           {
-          for (i = Lmin; i < Lmax; i++)
+          i = Lmin;
+#if PCRE2_CODE_UNIT_WIDTH == 8
+          SCAN_CLASS_RUN(Lbyte_map, FALSE, TRUE);
+#endif
+          for (; i < Lmax; i++)
             {
             int len = 1;
             if (Feptr >= mb->end_subject)
@@ -2237,7 +2312,11 @@ fprintf(stderr, "++ %2ld op=%3d %s\n", Fecode - mb->start_code, *Fecode,
 #endif
           /* Not UTF mode */
           {
-          for (i = Lmin; i < Lmax; i++)
+          i = Lmin;
+#if PCRE2_CODE_UNIT_WIDTH == 8
+          SCAN_CLASS_RUN(Lbyte_map, FALSE, FALSE);
+#endif
+          for (; i < Lmax; i++)
             {
             if (Feptr >= mb->end_subject)
               {
@@ -2770,12 +2849,12 @@ fprintf(stderr, "++ %2ld op=%3d %s\n", Fecode - mb->start_code, *Fecode,
         break;
 
         case PT_GC:
-        if ((Fecode[2] == PRIV(ucp_gentype)[prop->chartype]) == notmatch)
+        if (UCD_CATEGORY_IS(fc, Fecode[2]) == notmatch)
           RRETURN(MATCH_NOMATCH);
         break;
 
         case PT_PC:
-        if ((Fecode[2] == prop->chartype) == notmatch)
+        if (UCD_CHARTYPE_IS(fc, Fecode[2]) == notmatch)
           RRETURN(MATCH_NOMATCH);
         break;
 
@@ -2795,9 +2874,7 @@ fprintf(stderr, "++ %2ld op=%3d %s\n", Fecode - mb->start_code, *Fecode,
         /* These are specials */
 
         case PT_ALNUM:
-        chartype = prop->chartype;
-        if ((PRIV(ucp_gentype)[chartype] == ucp_L ||
-             PRIV(ucp_gentype)[chartype] == ucp_N) == notmatch)
+        if (UCD_PROPBIT(fc, UCD_PROPBITS_ALNUM) == notmatch)
           RRETURN(MATCH_NOMATCH);
         break;
 
@@ -2807,26 +2884,12 @@ fprintf(stderr, "++ %2ld op=%3d %s\n", Fecode - mb->start_code, *Fecode,
 
         case PT_SPACE:    /* Perl space */
         case PT_PXSPACE:  /* POSIX space */
-        switch(fc)
-          {
-          HSPACE_CASES:
-          VSPACE_CASES:
-          if (notmatch) RRETURN(MATCH_NOMATCH);
-          break;
-
-          default:
-          if ((PRIV(ucp_gentype)[prop->chartype] == ucp_Z) == notmatch)
-            RRETURN(MATCH_NOMATCH);
-          break;
-          }
+        if (UCD_PROPBIT(fc, UCD_PROPBITS_SPACE) == notmatch)
+          RRETURN(MATCH_NOMATCH);
         break;
 
         case PT_WORD:
-        chartype = prop->chartype;
-        if ((PRIV(ucp_gentype)[chartype] == ucp_L ||
-             PRIV(ucp_gentype)[chartype] == ucp_N ||
-             chartype == ucp_Mn ||
-             chartype == ucp_Pc) == notmatch)
+        if (UCD_PROPBIT(fc, UCD_PROPBITS_WORD) == notmatch)
           RRETURN(MATCH_NOMATCH);
         break;
 
@@ -3023,7 +3086,7 @@ fprintf(stderr, "++ %2ld op=%3d %s\n", Fecode - mb->start_code, *Fecode,
               RRETURN(MATCH_NOMATCH);
               }
             GETCHARINCTEST(fc, Feptr);
-            if ((UCD_CATEGORY(fc) == Lpropvalue) == notmatch)
+            if (UCD_CATEGORY_IS(fc, Lpropvalue) == notmatch)
               RRETURN(MATCH_NOMATCH);
             }
           break;
@@ -3037,7 +3100,7 @@ fprintf(stderr, "++ %2ld op=%3d %s\n", Fecode - mb->start_code, *Fecode,
               RRETURN(MATCH_NOMATCH);
               }
             GETCHARINCTEST(fc, Feptr);
-            if ((UCD_CHARTYPE(fc) == Lpropvalue) == notmatch)
+            if (UCD_CHARTYPE_IS(fc, Lpropvalue) == notmatch)
               RRETURN(MATCH_NOMATCH);
             }
           break;
@@ -3078,15 +3141,13 @@ fprintf(stderr, "++ %2ld op=%3d %s\n", Fecode - mb->start_code, *Fecode,
           case PT_ALNUM:
           for (i = 1; i <= Lmin; i++)
             {
-            int category;
             if (Feptr >= mb->end_subject)
               {
               SCHECK_PARTIAL();
               RRETURN(MATCH_NOMATCH);
               }
             GETCHARINCTEST(fc, Feptr);
-            category = UCD_CATEGORY(fc);
-            if ((category == ucp_L || category == ucp_N) == notmatch)
+            if (UCD_PROPBIT(fc, UCD_PROPBITS_ALNUM) == notmatch)
               RRETURN(MATCH_NOMATCH);
             }
           break;
@@ -3105,35 +3166,21 @@ fprintf(stderr, "++ %2ld op=%3d %s\n", Fecode - mb->start_code, *Fecode,
               RRETURN(MATCH_NOMATCH);
               }
             GETCHARINCTEST(fc, Feptr);
-            switch(fc)
-              {
-              HSPACE_CASES:
-              VSPACE_CASES:
-              if (notmatch) RRETURN(MATCH_NOMATCH);
-              break;
-
-              default:
-              if ((UCD_CATEGORY(fc) == ucp_Z) == notmatch)
-                RRETURN(MATCH_NOMATCH);
-              break;
-              }
+            if (UCD_PROPBIT(fc, UCD_PROPBITS_SPACE) == notmatch)
+              RRETURN(MATCH_NOMATCH);
             }
           break;
 
           case PT_WORD:
           for (i = 1; i <= Lmin; i++)
             {
-            int chartype, category;
             if (Feptr >= mb->end_subject)
               {
               SCHECK_PARTIAL();
               RRETURN(MATCH_NOMATCH);
               }
             GETCHARINCTEST(fc, Feptr);
-            chartype = UCD_CHARTYPE(fc);
-            category = PRIV(ucp_gentype)[chartype];
-            if ((category == ucp_L || category == ucp_N ||
-                 chartype == ucp_Mn || chartype == ucp_Pc) == notmatch)
+            if (UCD_PROPBIT(fc, UCD_PROPBITS_WORD) == notmatch)
               RRETURN(MATCH_NOMATCH);
             }
           break;
@@ -3813,7 +3860,7 @@ fprintf(stderr, "++ %2ld op=%3d %s\n", Fecode - mb->start_code, *Fecode,
               RRETURN(MATCH_NOMATCH);
               }
             GETCHARINCTEST(fc, Feptr);
-            if ((UCD_CATEGORY(fc) == Lpropvalue) == (Lctype == OP_NOTPROP))
+            if (UCD_CATEGORY_IS(fc, Lpropvalue) == (Lctype == OP_NOTPROP))
               RRETURN(MATCH_NOMATCH);
             }
           PCRE2_UNREACHABLE(); /* Control never reaches here */
@@ -3830,7 +3877,7 @@ fprintf(stderr, "++ %2ld op=%3d %s\n", Fecode - mb->start_code, *Fecode,
               RRETURN(MATCH_NOMATCH);
               }
             GETCHARINCTEST(fc, Feptr);
-            if ((UCD_CHARTYPE(fc) == Lpropvalue) == (Lctype == OP_NOTPROP))
+            if (UCD_CHARTYPE_IS(fc, Lpropvalue) == (Lctype == OP_NOTPROP))
               RRETURN(MATCH_NOMATCH);
             }
           PCRE2_UNREACHABLE(); /* Control never reaches here */
@@ -3877,7 +3924,6 @@ fprintf(stderr, "++ %2ld op=%3d %s\n", Fecode - mb->start_code, *Fecode,
           case PT_ALNUM:
           for (;;)
             {
-            int category;
             RMATCH(Fecode, RM212);
             if (rrc != MATCH_NOMATCH) RRETURN(rrc);
             if (Lmin++ >= Lmax) RRETURN(MATCH_NOMATCH);
@@ -3887,8 +3933,7 @@ fprintf(stderr, "++ %2ld op=%3d %s\n", Fecode - mb->start_code, *Fecode,
               RRETURN(MATCH_NOMATCH);
               }
             GETCHARINCTEST(fc, Feptr);
-            category = UCD_CATEGORY(fc);
-            if ((category == ucp_L || category == ucp_N) == (Lctype == OP_NOTPROP))
+            if (UCD_PROPBIT(fc, UCD_PROPBITS_ALNUM) == (Lctype == OP_NOTPROP))
               RRETURN(MATCH_NOMATCH);
             }
           PCRE2_UNREACHABLE(); /* Control never reaches here */
@@ -3910,25 +3955,14 @@ fprintf(stderr, "++ %2ld op=%3d %s\n", Fecode - mb->start_code, *Fecode,
               RRETURN(MATCH_NOMATCH);
               }
             GETCHARINCTEST(fc, Feptr);
-            switch(fc)
-              {
-              HSPACE_CASES:
-              VSPACE_CASES:
-              if (Lctype == OP_NOTPROP) RRETURN(MATCH_NOMATCH);
-              break;
-
-              default:
-              if ((UCD_CATEGORY(fc) == ucp_Z) == (Lctype == OP_NOTPROP))
-                RRETURN(MATCH_NOMATCH);
-              break;
-              }
+            if (UCD_PROPBIT(fc, UCD_PROPBITS_SPACE) == (Lctype == OP_NOTPROP))
+              RRETURN(MATCH_NOMATCH);
             }
           PCRE2_UNREACHABLE(); /* Control never reaches here */
 
           case PT_WORD:
           for (;;)
             {
-            int chartype, category;
             RMATCH(Fecode, RM214);
             if (rrc != MATCH_NOMATCH) RRETURN(rrc);
             if (Lmin++ >= Lmax) RRETURN(MATCH_NOMATCH);
@@ -3938,12 +3972,7 @@ fprintf(stderr, "++ %2ld op=%3d %s\n", Fecode - mb->start_code, *Fecode,
               RRETURN(MATCH_NOMATCH);
               }
             GETCHARINCTEST(fc, Feptr);
-            chartype = UCD_CHARTYPE(fc);
-            category = PRIV(ucp_gentype)[chartype];
-            if ((category == ucp_L ||
-                 category == ucp_N ||
-                 chartype == ucp_Mn ||
-                 chartype == ucp_Pc) == (Lctype == OP_NOTPROP))
+            if (UCD_PROPBIT(fc, UCD_PROPBITS_WORD) == (Lctype == OP_NOTPROP))
               RRETURN(MATCH_NOMATCH);
             }
           PCRE2_UNREACHABLE(); /* Control never reaches here */
@@ -4397,7 +4426,12 @@ fprintf(stderr, "++ %2ld op=%3d %s\n", Fecode - mb->start_code, *Fecode,
           break;
 
           case PT_GC:
-          for (i = Lmin; i < Lmax; i++)
+          i = Lmin;
+#if PCRE2_CODE_UNIT_WIDTH == 8
+          if (Lpropvalue == ucp_L)
+            SCAN_CLASS_RUN(UCD_PROPBITS_ASCII(UCD_PROPBITS_L), notmatch, TRUE);
+#endif
+          for (; i < Lmax; i++)
             {
             int len = 1;
             if (Feptr >= mb->end_subject)
@@ -4406,13 +4440,18 @@ fprintf(stderr, "++ %2ld op=%3d %s\n", Fecode - mb->start_code, *Fecode,
               break;
               }
             GETCHARLENTEST(fc, Feptr, len);
-            if ((UCD_CATEGORY(fc) == Lpropvalue) == notmatch) break;
+            if (UCD_CATEGORY_IS(fc, Lpropvalue) == notmatch) break;
             Feptr+= len;
             }
           break;
 
           case PT_PC:
-          for (i = Lmin; i < Lmax; i++)
+          i = Lmin;
+#if PCRE2_CODE_UNIT_WIDTH == 8
+          if (Lpropvalue == ucp_Nd)
+            SCAN_CLASS_RUN(UCD_PROPBITS_ASCII(UCD_PROPBITS_ND), notmatch, TRUE);
+#endif
+          for (; i < Lmax; i++)
             {
             int len = 1;
             if (Feptr >= mb->end_subject)
@@ -4421,7 +4460,7 @@ fprintf(stderr, "++ %2ld op=%3d %s\n", Fecode - mb->start_code, *Fecode,
               break;
               }
             GETCHARLENTEST(fc, Feptr, len);
-            if ((UCD_CHARTYPE(fc) == Lpropvalue) == notmatch) break;
+            if (UCD_CHARTYPE_IS(fc, Lpropvalue) == notmatch) break;
             Feptr+= len;
             }
           break;
@@ -4462,9 +4501,12 @@ fprintf(stderr, "++ %2ld op=%3d %s\n", Fecode - mb->start_code, *Fecode,
           break;
 
           case PT_ALNUM:
-          for (i = Lmin; i < Lmax; i++)
+          i = Lmin;
+#if PCRE2_CODE_UNIT_WIDTH == 8
+          SCAN_CLASS_RUN(UCD_PROPBITS_ASCII(UCD_PROPBITS_ALNUM), notmatch, TRUE);
+#endif
+          for (; i < Lmax; i++)
             {
-            int category;
             int len = 1;
             if (Feptr >= mb->end_subject)
               {
@@ -4472,8 +4514,7 @@ fprintf(stderr, "++ %2ld op=%3d %s\n", Fecode - mb->start_code, *Fecode,
               break;
               }
             GETCHARLENTEST(fc, Feptr, len);
-            category = UCD_CATEGORY(fc);
-            if ((category == ucp_L || category == ucp_N) == notmatch)
+            if (UCD_PROPBIT(fc, UCD_PROPBITS_ALNUM) == notmatch)
               break;
             Feptr+= len;
             }
@@ -4485,7 +4526,11 @@ fprintf(stderr, "++ %2ld op=%3d %s\n", Fecode - mb->start_code, *Fecode,
 
           case PT_SPACE:    /* Perl space */
           case PT_PXSPACE:  /* POSIX space */
-          for (i = Lmin; i < Lmax; i++)
+          i = Lmin;
+#if PCRE2_CODE_UNIT_WIDTH == 8
+          SCAN_CLASS_RUN(UCD_PROPBITS_ASCII(UCD_PROPBITS_SPACE), notmatch, TRUE);
+#endif
+          for (; i < Lmax; i++)
             {
             int len = 1;
             if (Feptr >= mb->end_subject)
@@ -4494,27 +4539,18 @@ fprintf(stderr, "++ %2ld op=%3d %s\n", Fecode - mb->start_code, *Fecode,
               break;
               }
             GETCHARLENTEST(fc, Feptr, len);
-            switch(fc)
-              {
-              HSPACE_CASES:
-              VSPACE_CASES:
-              if (notmatch) goto ENDLOOP99;  /* Break the loop */
-              break;
-
-              default:
-              if ((UCD_CATEGORY(fc) == ucp_Z) == notmatch)
-                goto ENDLOOP99;   /* Break the loop */
-              break;
-              }
+            if (UCD_PROPBIT(fc, UCD_PROPBITS_SPACE) == notmatch) break;
             Feptr+= len;
             }
-          ENDLOOP99:
           break;
 
           case PT_WORD:
-          for (i = Lmin; i < Lmax; i++)
+          i = Lmin;
+#if PCRE2_CODE_UNIT_WIDTH == 8
+          SCAN_CLASS_RUN(UCD_PROPBITS_ASCII(UCD_PROPBITS_WORD), notmatch, TRUE);
+#endif
+          for (; i < Lmax; i++)
             {
-            int chartype, category;
             int len = 1;
             if (Feptr >= mb->end_subject)
               {
@@ -4522,12 +4558,7 @@ fprintf(stderr, "++ %2ld op=%3d %s\n", Fecode - mb->start_code, *Fecode,
               break;
               }
             GETCHARLENTEST(fc, Feptr, len);
-            chartype = UCD_CHARTYPE(fc);
-            category = PRIV(ucp_gentype)[chartype];
-            if ((category == ucp_L ||
-                 category == ucp_N ||
-                 chartype == ucp_Mn ||
-                 chartype == ucp_Pc) == notmatch)
+            if (UCD_PROPBIT(fc, UCD_PROPBITS_WORD) == notmatch)
               break;
             Feptr+= len;
             }
@@ -4852,7 +4883,11 @@ fprintf(stderr, "++ %2ld op=%3d %s\n", Fecode - mb->start_code, *Fecode,
           break;
 
           case OP_NOT_DIGIT:
-          for (i = Lmin; i < Lmax; i++)
+          i = Lmin;
+#if PCRE2_CODE_UNIT_WIDTH == 8
+          SCAN_CLASS_RUN(SCAN_CBITS(cbit_digit), TRUE, TRUE);
+#endif
+          for (; i < Lmax; i++)
             {
             int len = 1;
             if (Feptr >= mb->end_subject)
@@ -4867,7 +4902,11 @@ fprintf(stderr, "++ %2ld op=%3d %s\n", Fecode - mb->start_code, *Fecode,
           break;
 
           case OP_DIGIT:
-          for (i = Lmin; i < Lmax; i++)
+          i = Lmin;
+#if PCRE2_CODE_UNIT_WIDTH == 8
+          SCAN_CLASS_RUN(SCAN_CBITS(cbit_digit), FALSE, TRUE);
+#endif
+          for (; i < Lmax; i++)
             {
             int len = 1;
             if (Feptr >= mb->end_subject)
@@ -4882,7 +4921,11 @@ fprintf(stderr, "++ %2ld op=%3d %s\n", Fecode - mb->start_code, *Fecode,
           break;
 
           case OP_NOT_WHITESPACE:
-          for (i = Lmin; i < Lmax; i++)
+          i = Lmin;
+#if PCRE2_CODE_UNIT_WIDTH == 8
+          SCAN_CLASS_RUN(SCAN_CBITS(cbit_space), TRUE, TRUE);
+#endif
+          for (; i < Lmax; i++)
             {
             int len = 1;
             if (Feptr >= mb->end_subject)
@@ -4897,7 +4940,11 @@ fprintf(stderr, "++ %2ld op=%3d %s\n", Fecode - mb->start_code, *Fecode,
           break;
 
           case OP_WHITESPACE:
-          for (i = Lmin; i < Lmax; i++)
+          i = Lmin;
+#if PCRE2_CODE_UNIT_WIDTH == 8
+          SCAN_CLASS_RUN(SCAN_CBITS(cbit_space), FALSE, TRUE);
+#endif
+          for (; i < Lmax; i++)
             {
             int len = 1;
             if (Feptr >= mb->end_subject)
@@ -4912,7 +4959,11 @@ fprintf(stderr, "++ %2ld op=%3d %s\n", Fecode - mb->start_code, *Fecode,
           break;
 
           case OP_NOT_WORDCHAR:
-          for (i = Lmin; i < Lmax; i++)
+          i = Lmin;
+#if PCRE2_CODE_UNIT_WIDTH == 8
+          SCAN_CLASS_RUN(SCAN_CBITS(cbit_word), TRUE, TRUE);
+#endif
+          for (; i < Lmax; i++)
             {
             int len = 1;
             if (Feptr >= mb->end_subject)
@@ -4927,7 +4978,11 @@ fprintf(stderr, "++ %2ld op=%3d %s\n", Fecode - mb->start_code, *Fecode,
           break;
 
           case OP_WORDCHAR:
-          for (i = Lmin; i < Lmax; i++)
+          i = Lmin;
+#if PCRE2_CODE_UNIT_WIDTH == 8
+          SCAN_CLASS_RUN(SCAN_CBITS(cbit_word), FALSE, TRUE);
+#endif
+          for (; i < Lmax; i++)
             {
             int len = 1;
             if (Feptr >= mb->end_subject)
@@ -5118,7 +5173,11 @@ fprintf(stderr, "++ %2ld op=%3d %s\n", Fecode - mb->start_code, *Fecode,
           break;
 
           case OP_NOT_DIGIT:
-          for (i = Lmin; i < Lmax; i++)
+          i = Lmin;
+#if PCRE2_CODE_UNIT_WIDTH == 8
+          SCAN_CLASS_RUN(SCAN_CBITS(cbit_digit), TRUE, FALSE);
+#endif
+          for (; i < Lmax; i++)
             {
             if (Feptr >= mb->end_subject)
               {
@@ -5132,7 +5191,11 @@ fprintf(stderr, "++ %2ld op=%3d %s\n", Fecode - mb->start_code, *Fecode,
           break;
 
           case OP_DIGIT:
-          for (i = Lmin; i < Lmax; i++)
+          i = Lmin;
+#if PCRE2_CODE_UNIT_WIDTH == 8
+          SCAN_CLASS_RUN(SCAN_CBITS(cbit_digit), FALSE, FALSE);
+#endif
+          for (; i < Lmax; i++)
             {
             if (Feptr >= mb->end_subject)
               {
@@ -5146,7 +5209,11 @@ fprintf(stderr, "++ %2ld op=%3d %s\n", Fecode - mb->start_code, *Fecode,
           break;
 
           case OP_NOT_WHITESPACE:
-          for (i = Lmin; i < Lmax; i++)
+          i = Lmin;
+#if PCRE2_CODE_UNIT_WIDTH == 8
+          SCAN_CLASS_RUN(SCAN_CBITS(cbit_space), TRUE, FALSE);
+#endif
+          for (; i < Lmax; i++)
             {
             if (Feptr >= mb->end_subject)
               {
@@ -5160,7 +5227,11 @@ fprintf(stderr, "++ %2ld op=%3d %s\n", Fecode - mb->start_code, *Fecode,
           break;
 
           case OP_WHITESPACE:
-          for (i = Lmin; i < Lmax; i++)
+          i = Lmin;
+#if PCRE2_CODE_UNIT_WIDTH == 8
+          SCAN_CLASS_RUN(SCAN_CBITS(cbit_space), FALSE, FALSE);
+#endif
+          for (; i < Lmax; i++)
             {
             if (Feptr >= mb->end_subject)
               {
@@ -5174,7 +5245,11 @@ fprintf(stderr, "++ %2ld op=%3d %s\n", Fecode - mb->start_code, *Fecode,
           break;
 
           case OP_NOT_WORDCHAR:
-          for (i = Lmin; i < Lmax; i++)
+          i = Lmin;
+#if PCRE2_CODE_UNIT_WIDTH == 8
+          SCAN_CLASS_RUN(SCAN_CBITS(cbit_word), TRUE, FALSE);
+#endif
+          for (; i < Lmax; i++)
             {
             if (Feptr >= mb->end_subject)
               {
@@ -5188,7 +5263,11 @@ fprintf(stderr, "++ %2ld op=%3d %s\n", Fecode - mb->start_code, *Fecode,
           break;
 
           case OP_WORDCHAR:
-          for (i = Lmin; i < Lmax; i++)
+          i = Lmin;
+#if PCRE2_CODE_UNIT_WIDTH == 8
+          SCAN_CLASS_RUN(SCAN_CBITS(cbit_word), FALSE, FALSE);
+#endif
+          for (; i < Lmax; i++)
             {
             if (Feptr >= mb->end_subject)
               {
@@ -6511,10 +6590,13 @@ fprintf(stderr, "++ %2ld op=%3d %s\n", Fecode - mb->start_code, *Fecode,
         continue;  /* With next opcode */
         }
 
-      /* Deal with actual capturing. */
+      /* Deal with actual capturing. If top_bracket is zero in a pattern that
+      has capturing groups, captures are not wanted (PCRE2_NO_CAPTURES), and
+      the frames have no space for them. */
 
-      offset = (number << 1) - 2;
       Fcapture_last = number;
+      if (top_bracket == 0) break;
+      offset = (number << 1) - 2;
       Fovector[offset] = P->eptr - mb->start_subject;
       Fovector[offset+1] = Feptr - mb->start_subject;
       if (offset >= Foffset_top) Foffset_top = offset + 2;
@@ -6719,10 +6801,7 @@ fprintf(stderr, "++ %2ld op=%3d %s\n", Fecode - mb->start_code, *Fecode,
 #ifdef SUPPORT_UNICODE
       if (Fop == OP_UCP_WORD_BOUNDARY || Fop == OP_NOT_UCP_WORD_BOUNDARY)
         {
-        int chartype = UCD_CHARTYPE(fc);
-        int category = PRIV(ucp_gentype)[chartype];
-        prev_is_word = (category == ucp_L || category == ucp_N ||
-          chartype == ucp_Mn || chartype == ucp_Pc);
+        prev_is_word = UCD_PROPBIT(fc, UCD_PROPBITS_WORD) != 0;
         }
       else
 #endif  /* SUPPORT_UNICODE */
@@ -6752,10 +6831,7 @@ fprintf(stderr, "++ %2ld op=%3d %s\n", Fecode - mb->start_code, *Fecode,
 #ifdef SUPPORT_UNICODE
       if (Fop == OP_UCP_WORD_BOUNDARY || Fop == OP_NOT_UCP_WORD_BOUNDARY)
         {
-        int chartype = UCD_CHARTYPE(fc);
-        int category = PRIV(ucp_gentype)[chartype];
-        cur_is_word = (category == ucp_L || category == ucp_N ||
-          chartype == ucp_Mn || chartype == ucp_Pc);
+        cur_is_word = UCD_PROPBIT(fc, UCD_PROPBITS_WORD) != 0;
         }
       else
 #endif  /* SUPPORT_UNICODE */
@@ -6912,6 +6988,18 @@ if (Frdepth == 0) return rrc;                     /* Exit from the top level */
 F = (heapframe *)((char *)F - Fback_frame);       /* Backtrack */
 mb->cb->callout_flags |= PCRE2_CALLOUT_BACKTRACK; /* Note for callouts */
 
+/* A failure or a backtracking verb is counted as a backtrack into the opcode
+that was being processed in the frame that is resumed. When this is a group,
+Fecode points to the branch that failed, so that a failure in an alternative
+after the first is counted against its OP_ALT. */
+
+#ifdef SUPPORT_PROFILE
+if (mb->profile_counts != NULL && (rrc == MATCH_NOMATCH ||
+    (rrc >= MATCH_BACKTRACK_MIN && rrc <= MATCH_BACKTRACK_MAX)))
+  PROFILE_COUNT((Fop >= OP_ASSERT && Fop <= OP_SCOND && *Fecode == OP_ALT)?
+    Fecode : F->profile_ecode, 1);
+#endif
+
 #ifdef DEBUG_SHOW_RMATCH
 fprintf(stderr, "++ RETURN %d to RM%d\n", rrc, Freturn_id);
 #endif
@@ -6945,6 +7033,511 @@ switch (Freturn_id)
 }
 
 
+/*************************************************
+*       Match one character, one-pass method     *
+*************************************************/
+
+/* This function and the next are used for patterns that were found at compile
+time to be matchable in a single pass, and are called only when matching is
+anchored. Each choice that the matcher makes is settled by the next character,
+and it was established at compile time that taking any other choice would fail
+at once, so there is never any need to backtrack. See _pcre2_study_onepass() for
+the details. Because there are no backtracking frames, heap, depth, and match
+limits do not apply.
+
+This function tests one character against an item that matches a single
+character. A single caseless character is handled slightly differently from a
+repeated one, in exactly the same way as in match().
+
+Arguments:
+  type         the item, e.g. OP_CHAR or OP_DIGIT
+  d            the character for character items
+  od           the other case of d, for caseless items
+  bitmap       the bitmap for class items
+  single       TRUE if the item is not repeated
+  eptr         the current subject position
+  mb           the match block
+
+Returns:       the subject position after the character, or NULL if it does
+               not match
+*/
+
+static PCRE2_SPTR
+onepass_char(uint32_t type, uint32_t d, uint32_t od, const uint8_t *bitmap,
+  BOOL single, PCRE2_SPTR eptr, match_block *mb)
+{
+uint32_t c;
+BOOL yield;
+#ifdef SUPPORT_UNICODE
+BOOL utf = (mb->poptions & PCRE2_UTF) != 0;
+BOOL ucp = (mb->poptions & PCRE2_UCP) != 0;
+#else
+BOOL utf = FALSE;
+#endif
+
+if (eptr >= mb->end_subject) return NULL;
+if (type == OP_ANY && IS_NEWLINE(eptr)) return NULL;
+
+/* A single caseless character below 128 (or any single caseless character
+without UTF or UCP) is compared with one code unit using the tables. */
+
+#ifdef SUPPORT_UNICODE
+if (type == OP_CHARI && single && (d < 128 || (!utf && !ucp)))
+#else
+if (type == OP_CHARI && single)
+#endif
+  {
+  c = *eptr;
+  return (TABLE_GET(d, mb->lcc, d) == TABLE_GET(c, mb->lcc, c))?
+    eptr + 1 : NULL;
+  }
+
+GETCHARINCTEST(c, eptr);
+
+switch(type)
+  {
+  case OP_CHAR:
+  yield = c == d;
+  break;
+
+  case OP_CHARI:
+  yield = c == d || c == od;
+  break;
+
+  case OP_NOT:
+  yield = c != d;
+  break;
+
+  case OP_NOTI:
+  yield = c != d && c != od;
+  break;
+
+  case OP_CLASS:
+  case OP_NCLASS:
+  if (c > 255) yield = type == OP_NCLASS;
+    else yield = (bitmap[c/8] & (1u << (c&7))) != 0;
+  break;
+
+  case OP_DIGIT:
+  yield = CHMAX_255(c) && (mb->ctypes[c] & ctype_digit) != 0;
+  break;
+
+  case OP_NOT_DIGIT:
+  yield = !CHMAX_255(c) || (mb->ctypes[c] & ctype_digit) == 0;
+  break;
+
+  case OP_WHITESPACE:
+  yield = CHMAX_255(c) && (mb->ctypes[c] & ctype_space) != 0;
+  break;
+
+  case OP_NOT_WHITESPACE:
+  yield = !CHMAX_255(c) || (mb->ctypes[c] & ctype_space) == 0;
+  break;
+
+  case OP_WORDCHAR:
+  yield = CHMAX_255(c) && (mb->ctypes[c] & ctype_word) != 0;
+  break;
+
+  case OP_NOT_WORDCHAR:
+  yield = !CHMAX_255(c) || (mb->ctypes[c] & ctype_word) == 0;
+  break;
+
+  default:   /* OP_ANY, OP_ALLANY */
+  yield = TRUE;
+  break;
+  }
+
+return yield? eptr : NULL;
+}
+
+
+
+/*************************************************
+*       Decode an item, one-pass method          *
+*************************************************/
+
+/* This function decodes an item that matches a single character, possibly
+repeated, for the one-pass matcher. The compile-time check has ensured that
+there are no other kinds of item where this is called.
+
+Arguments:
+  ecode        points to the item
+  item         where to return the details
+  mb           the match block
+
+Returns:       pointer to the next item
+*/
+
+typedef struct onepass_item {
+  uint32_t type;       /* The item, or the repeated item, e.g. OP_DIGIT */
+  uint32_t fc;         /* The character for character items */
+  uint32_t foc;        /* Its other case */
+  const uint8_t *bitmap;   /* The bitmap for a class */
+  uint32_t min;        /* Minimum number of repeats */
+  uint32_t max;        /* Maximum number of repeats */
+  BOOL single;         /* TRUE if the item is not repeated */
+} onepass_item;
+
+static PCRE2_SPTR
+onepass_decode(PCRE2_SPTR ecode, onepass_item *item, match_block *mb)
+{
+uint32_t op = *ecode;
+uint32_t rep;
+#ifdef SUPPORT_UNICODE
+BOOL utf = (mb->poptions & PCRE2_UTF) != 0;
+BOOL ucp = (mb->poptions & PCRE2_UCP) != 0;
+#else
+BOOL utf = FALSE;
+#endif
+
+item->fc = item->foc = 0;
+item->bitmap = NULL;
+item->min = item->max = 1;
+item->single = FALSE;
+
+if (op >= OP_STAR && op <= OP_NOTPOSUPTOI)
+  {
+  if (op >= OP_NOTSTARI) { rep = op - OP_NOTSTARI; op = OP_NOTI; }
+  else if (op >= OP_NOTSTAR) { rep = op - OP_NOTSTAR; op = OP_NOT; }
+  else if (op >= OP_STARI) { rep = op - OP_STARI; op = OP_CHARI; }
+  else { rep = op - OP_STAR; op = OP_CHAR; }
+  }
+else if (op >= OP_TYPESTAR && op <= OP_TYPEPOSUPTO)
+  rep = op - OP_TYPESTAR;
+
+/* Items that are not repeated, including classes, which may be followed by a
+repeat. */
+
+else
+  {
+  item->type = op;
+  ecode++;
+  if (op == OP_CLASS || op == OP_NCLASS)
+    {
+    item->bitmap = (const uint8_t *)ecode;
+    ecode += 32 / sizeof(PCRE2_UCHAR);
+    op = *ecode;
+    if (op >= OP_CRSTAR && op <= OP_CRPOSRANGE)
+      {
+      if (op == OP_CRRANGE || op == OP_CRMINRANGE || op == OP_CRPOSRANGE)
+        {
+        item->min = GET2(ecode, 1);
+        item->max = GET2(ecode, 1 + IMM2_SIZE);
+        if (item->max == 0) item->max = UINT32_MAX;
+        ecode += 1 + 2 * IMM2_SIZE;
+        }
+      else
+        {
+        item->min = rep_min[op - OP_CRSTAR];
+        item->max = rep_max[op - OP_CRSTAR];
+        ecode++;
+        }
+      }
+    return ecode;
+    }
+
+  if (op < OP_CHAR || op > OP_NOTI) return ecode;
+  item->single = TRUE;
+  goto CHARACTER;
+  }
+
+/* Repeated characters and types; the repeats are in the same order for all
+of them. */
+
+ecode++;
+switch(rep + OP_STAR)
+  {
+  case OP_STAR:
+  case OP_MINSTAR:
+  case OP_POSSTAR:
+  item->min = 0;
+  item->max = UINT32_MAX;
+  break;
+
+  case OP_PLUS:
+  case OP_MINPLUS:
+  case OP_POSPLUS:
+  item->max = UINT32_MAX;
+  break;
+
+  case OP_QUERY:
+  case OP_MINQUERY:
+  case OP_POSQUERY:
+  item->min = 0;
+  break;
+
+  case OP_UPTO:
+  case OP_MINUPTO:
+  case OP_POSUPTO:
+  item->min = 0;
+  item->max = GET2(ecode, 0);
+  ecode += IMM2_SIZE;
+  break;
+
+  default:   /* OP_EXACT */
+  item->min = item->max = GET2(ecode, 0);
+  ecode += IMM2_SIZE;
+  break;
+  }
+
+if (op >= OP_TYPESTAR)
+  {
+  item->type = *ecode++;
+  return ecode;
+  }
+item->type = op;
+
+/* Pick up a character and its other case. */
+
+CHARACTER:
+GETCHARINCTEST(item->fc, ecode);
+#ifdef SUPPORT_UNICODE
+if ((utf || ucp) && item->fc > 127) item->foc = UCD_OTHERCASE(item->fc); else
+#endif
+item->foc = TABLE_GET(item->fc, mb->fcc, item->fc);
+return ecode;
+}
+
+
+
+/*************************************************
+*    Test the start of a branch, one-pass method *
+*************************************************/
+
+/* This function tests whether the next character can start a branch, for
+choosing a branch of a group in the one-pass matcher. The compile-time check
+has ensured that the branch starts with an item that matches at least once,
+possibly inside groups that are not optional.
+
+Arguments:
+  ecode        points to the start of the branch
+  eptr         the current subject position
+  mb           the match block
+
+Returns:       TRUE if the next character can start the branch
+*/
+
+static BOOL
+onepass_first(PCRE2_SPTR ecode, PCRE2_SPTR eptr, match_block *mb)
+{
+onepass_item item;
+
+if (*ecode == OP_BRA || *ecode == OP_CBRA)
+  {
+  PCRE2_SPTR branch = ecode;
+  do
+    {
+    if (onepass_first(branch + ((branch == ecode)?
+        PRIV(OP_lengths)[*branch] : 1 + LINK_SIZE), eptr, mb))
+      return TRUE;
+    branch += GET(branch, 1);
+    }
+  while (*branch == OP_ALT);
+  return FALSE;
+  }
+
+(void)onepass_decode(ecode, &item, mb);
+return onepass_char(item.type, item.fc, item.foc, item.bitmap, item.single,
+  eptr, mb) != NULL;
+}
+
+
+
+/*************************************************
+*       Match a pattern, one-pass method         *
+*************************************************/
+
+/* This function runs the one-pass matcher (see above) at a single starting
+position. The code consists of items that match single characters, possibly
+repeated, non-repeated groups, which may be optional, and simple assertions.
+Each item is matched as many times as possible, up to its maximum. When a group
+has several branches, or is optional, the first item of each branch is tested
+against the next character to choose the branch.
+
+Arguments:
+  start_eptr    starting character in subject
+  start_ecode   starting position in compiled code
+  top_bracket   number of capturing parentheses in the pattern, or zero if
+                  captures are not being recorded
+  match_data    pointer to match_data block
+  mb            pointer to "static" variables block
+
+Returns:        MATCH_MATCH if matched
+                MATCH_NOMATCH if failed to match
+*/
+
+static int
+onepass_match(PCRE2_SPTR start_eptr, PCRE2_SPTR start_ecode,
+  uint16_t top_bracket, pcre2_match_data *match_data, match_block *mb)
+{
+PCRE2_SPTR eptr = start_eptr;
+PCRE2_SPTR ecode = start_ecode;
+PCRE2_SIZE *ovector = match_data->ovector;
+PCRE2_SIZE offset_top = 0;
+uint32_t ovecsize = 2 * ((top_bracket + 1 > match_data->oveccount)?
+  match_data->oveccount : top_bracket + 1);
+uint32_t i;
+#ifdef SUPPORT_UNICODE
+BOOL utf = (mb->poptions & PCRE2_UTF) != 0;
+#else
+BOOL utf = FALSE;  /* Required for the IS_NEWLINE macro */
+#endif
+
+for (i = 2; i < ovecsize; i++) ovector[i] = PCRE2_UNSET;
+
+for (;;)
+  {
+  onepass_item item;
+  PCRE2_SPTR bracode;
+  PCRE2_SPTR next;
+  uint32_t number;
+
+  switch(*ecode)
+    {
+    /* A group with several branches, or an optional group, is entered only if
+    the first item of a branch matches the next character; otherwise the match
+    fails, or the optional group is skipped. A group with only one branch that
+    is not optional is entered without a test. */
+
+    case OP_BRAZERO:
+    case OP_BRA:
+    case OP_CBRA:
+    bracode = (*ecode == OP_BRAZERO)? ecode + 1 : ecode;
+    next = bracode + PRIV(OP_lengths)[*bracode];
+
+    if (*ecode == OP_BRAZERO || bracode[GET(bracode, 1)] == OP_ALT)
+      {
+      PCRE2_SPTR branch = bracode;
+      for (;;)
+        {
+        if (onepass_first(next, eptr, mb)) break;
+        branch += GET(branch, 1);
+        if (*branch != OP_ALT)
+          {
+          next = NULL;
+          break;
+          }
+        next = branch + 1 + LINK_SIZE;
+        }
+
+      if (next == NULL)
+        {
+        if (*ecode != OP_BRAZERO) return MATCH_NOMATCH;
+        ecode = branch + 1 + LINK_SIZE;
+        continue;
+        }
+      }
+
+    /* Record the start of a capture; the end is recorded at the ket. */
+
+    if (*bracode == OP_CBRA)
+      {
+      number = GET2(bracode, 1 + LINK_SIZE);
+      if (2 * number < ovecsize)
+        ovector[2 * number] = eptr - mb->start_subject;
+      }
+    ecode = next;
+    continue;
+
+    /* At the end of a branch, skip to the ket. */
+
+    case OP_ALT:
+    do ecode += GET(ecode, 1); while (*ecode == OP_ALT);
+    continue;
+
+    case OP_KET:
+    bracode = ecode - GET(ecode, 1);
+    if (*bracode == OP_CBRA)
+      {
+      number = GET2(bracode, 1 + LINK_SIZE);
+      if (2 * number < ovecsize)
+        ovector[2 * number + 1] = eptr - mb->start_subject;
+      if (2 * number > offset_top) offset_top = 2 * number;
+      }
+    ecode += 1 + LINK_SIZE;
+    continue;
+
+    /* The end of the pattern. The tests are the same as in match(), but there
+    is nothing to backtrack into if they fail. */
+
+    case OP_END:
+    if (eptr == start_eptr &&
+         ((mb->moptions & PCRE2_NOTEMPTY) != 0 ||
+           ((mb->moptions & PCRE2_NOTEMPTY_ATSTART) != 0 &&
+             start_eptr == mb->start_subject + mb->start_offset)))
+      return MATCH_NOMATCH;
+
+    if (eptr < mb->end_subject &&
+        ((mb->moptions | mb->poptions) & PCRE2_ENDANCHORED) != 0)
+      return MATCH_NOMATCH;
+
+    mb->end_match_ptr = eptr;
+    mb->end_offset_top = offset_top;
+    if (eptr > mb->last_used_ptr) mb->last_used_ptr = eptr;
+    ovector[0] = start_eptr - mb->start_subject;
+    ovector[1] = eptr - mb->start_subject;
+    return MATCH_MATCH;
+
+    /* Assertions, as in match(), except that partial matching is not
+    supported. */
+
+    case OP_CIRC:
+    if (eptr != mb->start_subject || (mb->moptions & PCRE2_NOTBOL) != 0)
+      return MATCH_NOMATCH;
+    ecode++;
+    continue;
+
+    case OP_SOD:
+    if (eptr != mb->start_subject) return MATCH_NOMATCH;
+    ecode++;
+    continue;
+
+    case OP_SOM:
+    if (eptr != mb->start_subject + mb->start_offset) return MATCH_NOMATCH;
+    ecode++;
+    continue;
+
+    case OP_DOLL:
+    if ((mb->moptions & PCRE2_NOTEOL) != 0) return MATCH_NOMATCH;
+    if ((mb->poptions & PCRE2_DOLLAR_ENDONLY) == 0) goto ASSERT_NL_OR_EOS;
+    PCRE2_FALLTHROUGH /* Fall through */
+
+    case OP_EOD:
+    if (eptr < mb->true_end_subject) return MATCH_NOMATCH;
+    ecode++;
+    continue;
+
+    case OP_EODN:
+    ASSERT_NL_OR_EOS:
+    if (eptr < mb->true_end_subject &&
+        (!IS_NEWLINE(eptr) || eptr != mb->true_end_subject - mb->nllen))
+      return MATCH_NOMATCH;
+    ecode++;
+    continue;
+
+    /* Everything else is an item that matches a single character, possibly
+    repeated. Match it as often as possible, up to the maximum. */
+
+    default:
+    ecode = onepass_decode(ecode, &item, mb);
+    for (i = 0; i < item.max; i++)
+      {
+      next = onepass_char(item.type, item.fc, item.foc, item.bitmap,
+        item.single, eptr, mb);
+      if (next == NULL)
+        {
+        if (i < item.min) return MATCH_NOMATCH;
+        break;
+        }
+      eptr = next;
+      }
+    continue;
+    }
+  }
+}
+
+
+
 /*************************************************
 *           Match a Regular Expression           *
 *************************************************/
@@ -6985,11 +7578,6 @@ BOOL has_first_cu = FALSE;
 BOOL has_req_cu = FALSE;
 BOOL startline;
 
-#if PCRE2_CODE_UNIT_WIDTH == 8
-PCRE2_SPTR memchr_found_first_cu;
-PCRE2_SPTR memchr_found_first_cu2;
-#endif
-
 PCRE2_UCHAR first_cu = 0;
 PCRE2_UCHAR first_cu2 = 0;
 PCRE2_UCHAR req_cu = 0;
@@ -7016,8 +7604,15 @@ BOOL allow_invalid;
 uint32_t fragment_options = 0;
 #endif  /* SUPPORT_UNICODE */
 
-PCRE2_SIZE frame_size;
+PCRE2_SIZE frame_size = 0;   /* Not set when one-pass matching is used */
 PCRE2_SIZE heapframes_size;
+uint16_t top_bracket;
+
+/* Variables for borrowing the frames vector from a frame pool. */
+
+pcre2_frame_pool *frame_pool;
+heapframe *md_heapframes = NULL;
+PCRE2_SIZE md_heapframes_size = 0;
 
 /* We need to have mb as a pointer to a match block, because the IS_NEWLINE
 macro is used below, and it expects NLBLOCK to be defined as a pointer. */
@@ -7124,11 +7719,15 @@ match_data->startchar = 0;
 
 /* If the pattern was successfully studied with JIT support, we will run the
 JIT executable instead of the rest of this function. Most options must be set
-at compile time for the JIT code to be usable. */
+at compile time for the JIT code to be usable. JIT matching is not used when
+profiling, because it does not process opcodes. */
 
 #ifdef SUPPORT_JIT
 if (re->executable_jit != NULL &&
     (options & ~PUBLIC_JIT_MATCH_OPTIONS) == 0 &&
+#ifdef SUPPORT_PROFILE
+    (mcontext == NULL || mcontext->profile_size == 0) &&
+#endif
     PRIV(jit_check_exec)(re->executable_jit, options))
   {
   /* Prepare for JIT matching. Check a UTF string for validity unless no check
@@ -7367,7 +7966,7 @@ control functions from the pattern. */
 if (mcontext == NULL)
   {
   mcontext = (pcre2_match_context *)(&PRIV(default_match_context));
-  mb->memctl = re->memctl;
+  mb->memctl = *CODE_MEMCTL(re);
   }
 else mb->memctl = mcontext->memctl;
 
@@ -7392,6 +7991,12 @@ gets set later. */
 mb->callout = mcontext->callout;
 mb->callout_data = mcontext->callout_data;
 
+#ifdef SUPPORT_PROFILE
+mb->profile_counts = (mcontext->profile_size == 0)? NULL :
+  mcontext->profile_counts;
+mb->profile_size = mcontext->profile_size;
+#endif
+
 mb->start_subject = subject;
 mb->start_offset = start_offset;
 mb->end_subject = end_subject;
@@ -7456,6 +8061,45 @@ switch(re->newline_convention)
   /* LCOV_EXCL_STOP */
   }
 
+/* Pointers to the individual character tables */
+
+mb->lcc = CODE_TABLES(re) + lcc_offset;
+mb->fcc = mb->lcc - lcc_offset + fcc_offset;
+mb->ctypes = mb->lcc - lcc_offset + ctypes_offset;
+
+/* If the caller does not want the captured substrings, and the pattern never
+consults them while matching, captures need not be recorded at all. Telling the
+matchers that there are no capturing groups makes the backtracking frames
+smaller (so less is copied for each new frame) and suppresses the stores. */
+
+top_bracket = ((options & PCRE2_NO_CAPTURES) != 0 &&
+  (re->flags & PCRE2_NOCAPREF) != 0)? 0 : re->top_bracket;
+
+/* If the pattern was found at compile time to be suitable for one-pass
+matching, and this match is anchored, use the one-pass matcher, which needs no
+backtracking frames. It does not support partial matching, and it is not used
+when profiling, because it does not process opcodes one at a time. */
+
+if ((re->flags & PCRE2_ONEPASS) != 0 && anchored && mb->partial == 0
+#ifdef SUPPORT_PROFILE
+    && mb->profile_counts == NULL
+#endif
+    )
+  {
+  frame_pool = NULL;
+  start_partial = match_partial = NULL;
+  if (start_match > bumpalong_limit) rc = MATCH_NOMATCH; else
+    {
+    mb->start_used_ptr = start_match;
+    mb->last_used_ptr = start_match;
+    mb->moptions = options;
+    mb->end_offset_top = 0;
+    rc = onepass_match(start_match, mb->start_code, top_bracket,
+      match_data, mb);
+    }
+  goto ENDLOOP;
+  }
+
 /* The backtracking frames have fixed data at the front, and a PCRE2_SIZE
 vector at the end, whose size depends on the number of capturing parentheses in
 the pattern. It is not used at all if there are no capturing parentheses.
@@ -7470,7 +8114,7 @@ array, that does not guarantee it is suitably aligned for pointers, as some
 architectures have pointers that are larger than a size_t. */
 
 frame_size = (offsetof(heapframe, ovector) +
-  re->top_bracket * 2 * sizeof(PCRE2_SIZE) + HEAPFRAME_ALIGNMENT - 1) &
+  top_bracket * 2 * sizeof(PCRE2_SIZE) + HEAPFRAME_ALIGNMENT - 1) &
   ~(HEAPFRAME_ALIGNMENT - 1);
 
 /* Limits set in the pattern override the match context only if they are
@@ -7499,18 +8143,49 @@ if (heapframes_size / 1024 > mb->heap_limit)
   heapframes_size = max_size;
   }
 
-/* If an existing frame vector in the match_data block is large enough, we can
-use it. Otherwise, free any pre-existing vector and get a new one. */
+/* If a frame pool is attached to the match context, borrow its frames vector
+for the duration of this match, unless it is already lent out (which happens if
+a callout function calls pcre2_match() recursively with the same context). The
+match data block's own vector, if any, is put aside and restored at the end, so
+that match() can always find the frames via the match data block. New memory
+for the vector is obtained using the owner's memory management functions. */
+
+frame_pool = mcontext->frame_pool;
+if (frame_pool != NULL && !frame_pool->in_use)
+  {
+  frame_pool->in_use = TRUE;
+  md_heapframes = match_data->heapframes;
+  md_heapframes_size = match_data->heapframes_size;
+  match_data->heapframes = frame_pool->heapframes;
+  match_data->heapframes_size = frame_pool->heapframes_size;
+  mb->frames_memctl = &frame_pool->memctl;
+  }
+else
+  {
+  frame_pool = NULL;
+  mb->frames_memctl = &match_data->memctl;
+  }
+
+/* If an existing frame vector is large enough, we can use it. Otherwise, free
+any pre-existing vector and get a new one. */
 
 if (match_data->heapframes_size < heapframes_size)
   {
-  match_data->memctl.free(match_data->heapframes,
-    match_data->memctl.memory_data);
-  match_data->heapframes = match_data->memctl.malloc(heapframes_size,
-    match_data->memctl.memory_data);
+  mb->frames_memctl->free(match_data->heapframes,
+    mb->frames_memctl->memory_data);
+  match_data->heapframes = mb->frames_memctl->malloc(heapframes_size,
+    mb->frames_memctl->memory_data);
   if (match_data->heapframes == NULL)
     {
     match_data->heapframes_size = 0;
+    if (frame_pool != NULL)
+      {
+      frame_pool->heapframes = NULL;
+      frame_pool->heapframes_size = 0;
+      frame_pool->in_use = FALSE;
+      match_data->heapframes = md_heapframes;
+      match_data->heapframes_size = md_heapframes_size;
+      }
     return match_data->rc = PCRE2_ERROR_NOMEMORY;
     }
   match_data->heapframes_size = heapframes_size;
@@ -7522,12 +8197,6 @@ to avoid uninitialized memory read errors when it is copied to a new frame. */
 memset((char *)(match_data->heapframes) + offsetof(heapframe, ovector), 0xff,
   frame_size - offsetof(heapframe, ovector));
 
-/* Pointers to the individual character tables */
-
-mb->lcc = re->tables + lcc_offset;
-mb->fcc = re->tables + fcc_offset;
-mb->ctypes = re->tables + ctypes_offset;
-
 /* Set up the first code unit to match, if available. If there's no first code
 unit there may be a bitmap of possible first characters. */
 
@@ -7583,10 +8252,36 @@ FRAGMENT_RESTART:
 start_partial = match_partial = NULL;
 mb->hitend = FALSE;
 
-#if PCRE2_CODE_UNIT_WIDTH == 8
-memchr_found_first_cu = NULL;
-memchr_found_first_cu2 = NULL;
+/* If every branch of the pattern ends with an item that matches only at the
+end of the subject (or before a final newline), or if PCRE2_ENDANCHORED is set,
+and the pattern has a known maximum length, no match can start further from the
+end than that length plus two characters for a CRLF or \R newline. Skip
+directly to that point instead of trying every earlier position. In UTF modes a
+character may be up to 4 code units (8-bit) or 2 code units (16-bit) long, and
+the starting point must be moved to the start of a character. This cannot be
+used for partial matching, with the firstline option, or with invalid UTF
+support, where the end of the current fragment may not be the end of the
+subject. */
+
+if (!anchored && !firstline && mb->partial == 0 &&
+    (re->optimization_flags & PCRE2_OPTIM_START_OPTIMIZE) != 0 &&
+    (re->overall_options & PCRE2_MATCH_INVALID_UTF) == 0 &&
+    re->maxlength != UINT16_MAX &&
+    ((re->flags & PCRE2_ENDANCHOR) != 0 ||
+     ((re->overall_options | options) & PCRE2_ENDANCHORED) != 0))
+  {
+  PCRE2_SIZE back = (PCRE2_SIZE)re->maxlength + 2;
+#ifdef SUPPORT_UNICODE
+  if (utf) back *= 4/(PCRE2_CODE_UNIT_WIDTH/8);
 #endif
+  if ((PCRE2_SIZE)(end_subject - start_match) > back)
+    {
+    start_match = end_subject - back;
+#ifdef SUPPORT_UNICODE
+    if (utf) { FORWARDCHARTEST(start_match, end_subject); }
+#endif
+    }
+  }
 
 for(;;)
   {
@@ -7660,77 +8355,19 @@ for(;;)
       {
       if (has_first_cu)
         {
-        if (first_cu != first_cu2)  /* Caseless */
-          {
-          /* In 16-bit and 32_bit modes we have to do our own search, so can
-          look for both cases at once. */
+        /* Search for both cases at once when caseless. */
 
-#if PCRE2_CODE_UNIT_WIDTH != 8
-          PCRE2_UCHAR smc;
-          while (start_match < end_subject &&
-                (smc = *start_match) != first_cu &&
-                 smc != first_cu2)
-            start_match++;
-#else
-          /* In 8-bit mode, the use of memchr() gives a big speed up, even
-          though we have to call it twice in order to find the earliest
-          occurrence of the code unit in either of its cases. Caching is used
-          to remember the positions of previously found code units. This can
-          make a huge difference when the strings are very long and only one
-          case is actually present. */
-
-          PCRE2_SPTR pp1 = NULL;
-          PCRE2_SPTR pp2 = NULL;
-          PCRE2_SIZE searchlength = end_subject - start_match;
-
-          /* If we haven't got a previously found position for first_cu, or if
-          the current starting position is later, we need to do a search. If
-          the code unit is not found, set it to the end. */
-
-          if (memchr_found_first_cu == NULL ||
-              start_match > memchr_found_first_cu)
-            {
-            pp1 = memchr(start_match, first_cu, searchlength);
-            memchr_found_first_cu = (pp1 == NULL)? end_subject : pp1;
-            }
-
-          /* If the start is before a previously found position, use the
-          previous position, or NULL if a previous search failed. */
-
-          else pp1 = (memchr_found_first_cu == end_subject)? NULL :
-            memchr_found_first_cu;
-
-          /* Do the same thing for the other case. */
-
-          if (memchr_found_first_cu2 == NULL ||
-              start_match > memchr_found_first_cu2)
-            {
-            pp2 = memchr(start_match, first_cu2, searchlength);
-            memchr_found_first_cu2 = (pp2 == NULL)? end_subject : pp2;
-            }
-
-          else pp2 = (memchr_found_first_cu2 == end_subject)? NULL :
-            memchr_found_first_cu2;
-
-          /* Set the start to the end of the subject if neither case was found.
-          Otherwise, use the earlier found point. */
-
-          if (pp1 == NULL)
-            start_match = (pp2 == NULL)? end_subject : pp2;
-          else
-            start_match = (pp2 == NULL || pp1 < pp2)? pp1 : pp2;
-
-#endif  /* 8-bit handling */
-          }
+        if (first_cu != first_cu2)  /* Caseless */
+          start_match = PRIV(memchr2)(start_match, end_subject, first_cu,
+            first_cu2);
 
-        /* The caseful case is much simpler. */
+        /* In the caseful case, memchr() is used in the 8-bit library. */
 
         else
           {
 #if PCRE2_CODE_UNIT_WIDTH != 8
-          while (start_match < end_subject && *start_match !=
-                 first_cu)
-            start_match++;
+          start_match = PRIV(memchr2)(start_match, end_subject, first_cu,
+            first_cu);
 #else
           start_match = memchr(start_match, first_cu, end_subject - start_match);
           if (start_match == NULL) start_match = end_subject;
@@ -7790,20 +8427,11 @@ for(;;)
 
       /* If there's no first code unit or a requirement for a multiline line
       start, advance to a non-unique first code unit if any have been
-      identified. The bitmap contains only 256 bits. When code units are 16 or
-      32 bits wide, all code units greater than 254 set the 255 bit. */
+      identified. */
 
       else if (start_bits != NULL)
         {
-        while (start_match < end_subject)
-          {
-          uint32_t c = *start_match;
-#if PCRE2_CODE_UNIT_WIDTH != 8
-          if (c > 255) c = 255;
-#endif
-          if ((start_bits[c/8] & (1u << (c&7))) != 0) break;
-          start_match++;
-          }
+        start_match = PRIV(scan_start_bits)(start_match, end_subject, re);
 
         /* See comment above in first_cu checking about the next few lines. */
 
@@ -7841,12 +8469,8 @@ for(;;)
       set, req_cu must be later in the subject; otherwise the test starts at
       the match point. This optimization can save a huge amount of backtracking
       in patterns with nested unlimited repeats that aren't going to match.
-      Writing separate code for caseful/caseless versions makes it go faster,
-      as does using an autoincrement and backing off on a match. As in the case
-      of the first code unit, using memchr() in the 8-bit library gives a big
-      speed up. Unlike the first_cu check above, we do not need to call
-      memchr() twice in the caseless case because we only need to check for the
-      presence of the character in either case, not find the first occurrence.
+      As in the case of the first code unit, the search uses memchr() in the
+      8-bit caseful case, and PRIV(memchr2)() otherwise.
 
       The search can be skipped if the code unit was found later than the
       current starting point in a previous iteration of the bumpalong loop.
@@ -7868,21 +8492,7 @@ for(;;)
           {
           if (req_cu != req_cu2)  /* Caseless */
             {
-#if PCRE2_CODE_UNIT_WIDTH != 8
-            while (p < end_subject)
-              {
-              uint32_t pp = *p++;
-              if (pp == req_cu || pp == req_cu2) { p--; break; }
-              }
-#else  /* 8-bit code units */
-            PCRE2_SPTR pp = p;
-            p = memchr(pp, req_cu, end_subject - pp);
-            if (p == NULL)
-              {
-              p = memchr(pp, req_cu2, end_subject - pp);
-              if (p == NULL) p = end_subject;
-              }
-#endif /* PCRE2_CODE_UNIT_WIDTH != 8 */
+            p = PRIV(memchr2)(p, end_subject, req_cu, req_cu2);
             }
 
           /* The caseful case */
@@ -7890,11 +8500,7 @@ for(;;)
           else
             {
 #if PCRE2_CODE_UNIT_WIDTH != 8
-            while (p < end_subject)
-              {
-              if (*p++ == req_cu) { p--; break; }
-              }
-
+            p = PRIV(memchr2)(p, end_subject, req_cu, req_cu);
 #else  /* 8-bit code units */
             p = memchr(p, req_cu, end_subject - p);
             if (p == NULL) p = end_subject;
@@ -7951,7 +8557,7 @@ for(;;)
   fprintf(stderr, "++ Calling match()\n");
 #endif
 
-  rc = match(start_match, mb->start_code, re->top_bracket, frame_size,
+  rc = match(start_match, mb->start_code, top_bracket, frame_size,
     match_data, mb);
 
 #ifdef DEBUG_SHOW_OPS
@@ -8140,6 +8746,18 @@ if (utf && end_subject != true_end_subject &&
   }
 #endif  /* SUPPORT_UNICODE */
 
+/* If the frames vector was borrowed from a frame pool, hand it back (it may
+have been enlarged) and restore the match data block's own vector. */
+
+if (frame_pool != NULL)
+  {
+  frame_pool->heapframes = match_data->heapframes;
+  frame_pool->heapframes_size = match_data->heapframes_size;
+  frame_pool->in_use = FALSE;
+  match_data->heapframes = md_heapframes;
+  match_data->heapframes_size = md_heapframes_size;
+  }
+
 /* Fill in fields that are always returned in the match data. */
 
 match_data->code = re;
@@ -8154,8 +8772,9 @@ string if requested. */
 
 if (rc == MATCH_MATCH)
   {
-  match_data->rc = ((int)mb->end_offset_top >= 2 * match_data->oveccount)?
-    0 : (int)mb->end_offset_top/2 + 1;
+  if ((options & PCRE2_NO_CAPTURES) != 0) match_data->rc = 1; else
+    match_data->rc = ((int)mb->end_offset_top >= 2 * match_data->oveccount)?
+      0 : (int)mb->end_offset_top/2 + 1;
   match_data->subject_length = length;
   match_data->start_offset = start_offset;
   match_data->startchar = start_match - subject;
@@ -82,7 +82,8 @@ pcre2_match_data_create_from_pattern(const pcre2_code *code,
   pcre2_general_context *gcontext)
 {
 if (code == NULL) return NULL;
-if (gcontext == NULL) gcontext = (pcre2_general_context *)code;
+if (gcontext == NULL)
+  gcontext = (pcre2_general_context *)CODE_MEMCTL(code);
 return pcre2_match_data_create(((const pcre2_real_code *)code)->top_bracket + 1,
   gcontext);
 }
@@ -110,6 +111,45 @@ if (match_data != NULL)
 
 
 
+/*************************************************
+*            Create a frame pool                 *
+*************************************************/
+
+/* The frames vector is not obtained until the pool is first used by
+pcre2_match(), which then keeps it as large as the largest match needed. */
+
+PCRE2_EXP_DEFN pcre2_frame_pool * PCRE2_CALL_CONVENTION
+pcre2_frame_pool_create(pcre2_general_context *gcontext)
+{
+pcre2_frame_pool *yield = PRIV(memctl_malloc)(sizeof(pcre2_real_frame_pool),
+  (pcre2_memctl *)gcontext);
+if (yield == NULL) return NULL;
+yield->heapframes = NULL;
+yield->heapframes_size = 0;
+yield->in_use = FALSE;
+return yield;
+}
+
+
+
+/*************************************************
+*             Free a frame pool                  *
+*************************************************/
+
+PCRE2_EXP_DEFN void PCRE2_CALL_CONVENTION
+pcre2_frame_pool_free(pcre2_frame_pool *frame_pool)
+{
+if (frame_pool != NULL)
+  {
+  if (frame_pool->heapframes != NULL)
+    frame_pool->memctl.free(frame_pool->heapframes,
+      frame_pool->memctl.memory_data);
+  frame_pool->memctl.free(frame_pool, frame_pool->memctl.memory_data);
+  }
+}
+
+
+
 /*************************************************
 *         Get last mark in match                 *
 *************************************************/
@@ -181,4 +221,16 @@ pcre2_get_match_data_heapframes_size(pcre2_match_data *match_data)
 return match_data->heapframes_size;
 }
 
+
+
+/*************************************************
+*        Get frame pool heapframes size          *
+*************************************************/
+
+PCRE2_EXP_DEFN PCRE2_SIZE PCRE2_CALL_CONVENTION
+pcre2_get_frame_pool_heapframes_size(pcre2_frame_pool *frame_pool)
+{
+return frame_pool->heapframes_size;
+}
+
 /* End of pcre2_match_data.c */
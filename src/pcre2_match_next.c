@@ -168,4 +168,99 @@ to continue and make progress. */
 return TRUE;
 }
 
+
+/*************************************************
+*          Collect a batch of matches            *
+*************************************************/
+
+/* This function runs the standard global matching loop (pcre2_match() followed
+by pcre2_next_match()) internally, storing the offsets of each match in a
+caller-supplied vector, until either max_matches matches have been found or
+there are no more. For each match, "pairs" pairs of offsets are stored: the
+whole match followed by the first pairs-1 capturing groups, with unset groups
+(or groups beyond the match data's ovector) set to PCRE2_UNSET. If pairs is
+zero, matches are only counted. When no capture groups are wanted, the matches
+are run with PCRE2_NO_CAPTURES. Partial matching is not supported, because a
+partial match would have to be returned as well as the matches already stored.
+The number of matches is limited to INT_MAX so that it fits in the result.
+
+In UTF mode the subject is checked only by the first match; the remaining
+matches are run with PCRE2_NO_UTF_CHECK. On return, the match data holds the
+last match found (or a "no match" result), so a caller whose vector was filled
+can continue by calling pcre2_next_match() and then this function again.
+
+Arguments:
+  code            points to the compiled expression
+  subject         points to the subject string
+  length          length of subject string (may contain binary zeros)
+  start_offset    where to start in the subject string
+  options         option bits
+  match_data      points to a match_data block
+  mcontext        points a PCRE2 context
+  offsets         where to store the offset pairs
+  max_matches     the maximum number of matches to store
+  pairs           the number of offset pairs to store for each match
+
+Returns:          >= 0 the number of matches stored
+                  < 0 an error code from pcre2_match(), or
+                      PCRE2_ERROR_BADOPTION for a partial matching option
+*/
+
+PCRE2_EXP_DEFN int PCRE2_CALL_CONVENTION
+pcre2_match_all(const pcre2_code *code, PCRE2_SPTR subject, PCRE2_SIZE length,
+  PCRE2_SIZE start_offset, uint32_t options, pcre2_match_data *match_data,
+  pcre2_match_context *mcontext, PCRE2_SIZE *offsets, uint32_t max_matches,
+  uint32_t pairs)
+{
+uint32_t count = 0;
+uint32_t goptions = 0;
+
+if (match_data == NULL || (offsets == NULL && pairs > 0 && max_matches > 0))
+  return PCRE2_ERROR_NULL;
+
+if ((options & (PCRE2_PARTIAL_HARD|PCRE2_PARTIAL_SOFT)) != 0)
+  return PCRE2_ERROR_BADOPTION;
+
+if (max_matches > (uint32_t)INT_MAX) max_matches = (uint32_t)INT_MAX;
+if (pairs <= 1) options |= PCRE2_NO_CAPTURES;
+
+while (count < max_matches)
+  {
+  uint32_t i;
+  int rc = pcre2_match(code, subject, length, start_offset, options | goptions,
+    match_data, mcontext);
+
+  if (rc == PCRE2_ERROR_NOMATCH) break;
+  if (rc < 0) return rc;
+
+  /* A return of zero means that the ovector was too small, so all of its
+  pairs are set. Otherwise, pairs at or above rc are unset. */
+
+  if (rc == 0) rc = match_data->oveccount;
+  for (i = 0; i < pairs; i++)
+    {
+    if (i < (uint32_t)rc)
+      {
+      *offsets++ = match_data->ovector[2*i];
+      *offsets++ = match_data->ovector[2*i + 1];
+      }
+    else
+      {
+      *offsets++ = PCRE2_UNSET;
+      *offsets++ = PCRE2_UNSET;
+      }
+    }
+
+  if (++count >= max_matches ||
+      !pcre2_next_match(match_data, &start_offset, &goptions))
+    break;
+
+  /* The whole subject has been checked for UTF validity by the first match. */
+
+  options |= PCRE2_NO_UTF_CHECK;
+  }
+
+return (int)count;
+}
+
 /* End of pcre2_match_next.c */
@@ -95,6 +95,7 @@ if (where == NULL)   /* Requests field length */
     return sizeof(const uint8_t *);
 
     case PCRE2_INFO_JITSIZE:
+    case PCRE2_INFO_PROFILESIZE:
     case PCRE2_INFO_SIZE:
     case PCRE2_INFO_FRAMESIZE:
     return sizeof(size_t);
@@ -235,6 +236,13 @@ switch(what)
   *((uint32_t *)where) = re->newline_convention;
   break;
 
+  /* There are two counts for each code unit of the compiled code. */
+
+  case PCRE2_INFO_PROFILESIZE:
+  *((size_t *)where) = 2 * ((re->blocksize - re->code_start) /
+    sizeof(PCRE2_UCHAR));
+  break;
+
   case PCRE2_INFO_SIZE:
   *((size_t *)where) = re->blocksize;
   break;
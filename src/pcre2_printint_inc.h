@@ -638,18 +638,23 @@ fprintf(f, "]%s", after);
 
 /* The print_lengths flag controls whether offsets and lengths of items are
 printed. Lenths can be turned off from pcre2test so that automatic tests on
-bytecode can be written that do not depend on the value of LINK_SIZE.
+bytecode can be written that do not depend on the value of LINK_SIZE. If a
+vector of profile counts is supplied (see pcre2_set_profile()), each line
+starts with the execution and backtrack counts for the item it shows. Where
+several characters are shown on one line, the counts are those of the first.
 
 Arguments:
   re              a compiled pattern
   f               the file to write to
   print_lengths   show various lengths
+  profile         profile counts vector or NULL
 
 Returns:          nothing
 */
 
 static void
-pcre2_printint(pcre2_code *re, FILE *f, BOOL print_lengths)
+pcre2_printint(pcre2_code *re, FILE *f, BOOL print_lengths,
+  const PCRE2_SIZE *profile)
 {
 PCRE2_SPTR codestart, nametable, code;
 uint32_t nesize = re->name_entry_size;
@@ -666,6 +671,13 @@ for(;;)
   const char *flag = "  ";
   unsigned int extra = 0;
 
+  if (profile != NULL)
+    {
+    PCRE2_SIZE offset = 2 * (PCRE2_SIZE)(code - codestart);
+    fprintf(f, "%8lu %9lu ", (unsigned long)profile[offset],
+      (unsigned long)profile[offset + 1]);
+    }
+
   if (print_lengths)
     fprintf(f, "%3d ", (int)(code - codestart));
   else
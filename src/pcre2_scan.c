@@ -0,0 +1,443 @@
+/*************************************************
+*      Perl-Compatible Regular Expressions       *
+*************************************************/
+
+/* PCRE is a library of functions to support regular expressions whose syntax
+and semantics are as close as possible to those of the Perl 5 language.
+
+                       Written by Philip Hazel
+     Original API code Copyright (c) 1997-2012 University of Cambridge
+          New API code Copyright (c) 2016-2026 University of Cambridge
+
+-----------------------------------------------------------------------------
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright notice,
+      this list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above copyright
+      notice, this list of conditions and the following disclaimer in the
+      documentation and/or other materials provided with the distribution.
+
+    * Neither the name of the University of Cambridge nor the names of its
+      contributors may be used to endorse or promote products derived from
+      this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+POSSIBILITY OF SUCH DAMAGE.
+-----------------------------------------------------------------------------
+*/
+
+
+
+/* This module contains functions that scan a subject string for code units
+that may start a match or that a match requires. They are used by the
+interpreters (pcre2_match() and pcre2_dfa_match()) for their start-of-match
+optimizations. Vector instructions are used where they are available;
+otherwise there are simple loops. */
+
+
+#include "pcre2_internal.h"
+
+/* Vector scanning is available for GCC and compatible compilers on x86
+processors and on 64-bit Arm processors. SSE2 is part of the x86-64
+architecture. The scan of the starting bitmap, which is done only in the 8-bit
+library, needs SSSE3 on x86; it is used only if the processor supports it,
+which is checked at run time unless the compiler already assumes it. */
+
+#if defined(__GNUC__)
+#if defined(__SSE2__)
+#define SCAN_SSE2
+#include <emmintrin.h>
+#endif
+#if PCRE2_CODE_UNIT_WIDTH == 8 && (defined(__x86_64__) || defined(__i386__))
+#define SCAN_SSSE3
+#include <tmmintrin.h>
+#ifdef __SSSE3__
+#define SCAN_TARGET
+#define SCAN_HAVE_SSSE3 1
+#else
+#define SCAN_TARGET __attribute__((target("ssse3")))
+#define SCAN_HAVE_SSSE3 __builtin_cpu_supports("ssse3")
+#endif
+#endif
+#if defined(__aarch64__) && defined(__ARM_NEON)
+#define SCAN_NEON
+#include <arm_neon.h>
+#endif
+#endif
+
+
+
+#ifdef SCAN_SSSE3
+/*************************************************
+*   Scan for a code unit in a set using SSSE3    *
+*************************************************/
+
+/* The set of code units is given as a nibble table: byte n of the first
+(second) half has bit h set if the code unit h*16 + n (128 + h*16 + n) is in
+the set. Each block of 16 code units is split into low and high nibbles. The
+low nibble selects a byte from one of the two halves of the table, chosen by
+the top bit of the code unit, and the high nibble selects the bit within that
+byte. This function is called only when there are at least 16 code units left.
+
+Arguments:
+  p           where to start
+  end         end of the subject
+  nibbles     the set, as a nibble table
+
+Returns:      pointer to the first code unit in the set, or the start of the
+                final (incomplete) block of 16 code units
+*/
+
+static SCAN_TARGET PCRE2_SPTR
+find_in_set_ssse3(PCRE2_SPTR p, PCRE2_SPTR end, const uint8_t *nibbles)
+{
+const __m128i table_low = _mm_loadu_si128((const __m128i *)nibbles);
+const __m128i table_high = _mm_loadu_si128((const __m128i *)(nibbles + 16));
+const __m128i bit_select = _mm_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128,
+  1, 2, 4, 8, 16, 32, 64, -128);
+const __m128i low_mask = _mm_set1_epi8(0x0f);
+const __m128i zero = _mm_setzero_si128();
+
+while (end - p >= 16)
+  {
+  __m128i data = _mm_loadu_si128((const __m128i *)p);
+  __m128i low = _mm_and_si128(data, low_mask);
+  __m128i high = _mm_and_si128(_mm_srli_epi16(data, 4), low_mask);
+  __m128i top = _mm_cmplt_epi8(data, zero);
+  __m128i byte = _mm_or_si128(
+    _mm_and_si128(top, _mm_shuffle_epi8(table_high, low)),
+    _mm_andnot_si128(top, _mm_shuffle_epi8(table_low, low)));
+  __m128i hit = _mm_and_si128(byte, _mm_shuffle_epi8(bit_select, high));
+  unsigned int mask =
+    (unsigned int)_mm_movemask_epi8(_mm_cmpeq_epi8(hit, zero)) ^ 0xffffu;
+  if (mask != 0) return p + __builtin_ctz(mask);
+  p += 16;
+  }
+
+return p;
+}
+#endif  /* SCAN_SSSE3 */
+
+
+
+#if defined SCAN_NEON && PCRE2_CODE_UNIT_WIDTH == 8
+/*************************************************
+*   Scan for a code unit in a set using NEON     *
+*************************************************/
+
+/* This is the same as the SSSE3 function above, except that the two halves of
+the nibble table are looked up together, using the top bit of each code unit as
+bit 4 of the index.
+
+Arguments:
+  p           where to start
+  end         end of the subject
+  nibbles     the set, as a nibble table
+
+Returns:      pointer to the first code unit in the set, or the start of the
+                final (incomplete) block of 16 code units
+*/
+
+static PCRE2_SPTR
+find_in_set_neon(PCRE2_SPTR p, PCRE2_SPTR end, const uint8_t *nibbles)
+{
+static const uint8_t bits[16] =
+  { 1, 2, 4, 8, 16, 32, 64, 128, 1, 2, 4, 8, 16, 32, 64, 128 };
+uint8x16x2_t table;
+const uint8x16_t bit_select = vld1q_u8(bits);
+const uint8x16_t low_mask = vdupq_n_u8(0x0f);
+
+table.val[0] = vld1q_u8(nibbles);
+table.val[1] = vld1q_u8(nibbles + 16);
+
+while (end - p >= 16)
+  {
+  uint8x16_t data = vld1q_u8(p);
+  uint8x16_t index = vorrq_u8(vandq_u8(data, low_mask),
+    vandq_u8(vshrq_n_u8(data, 3), vdupq_n_u8(0x10)));
+  uint8x16_t high = vandq_u8(vshrq_n_u8(data, 4), vdupq_n_u8(0x07));
+  uint8x16_t hit = vtstq_u8(vqtbl2q_u8(table, index),
+    vqtbl1q_u8(bit_select, high));
+  uint64_t mask = vget_lane_u64(vreinterpret_u64_u8(
+    vshrn_n_u16(vreinterpretq_u16_u8(hit), 4)), 0);
+  if (mask != 0) return p + (__builtin_ctzll(mask) >> 2);
+  p += 16;
+  }
+
+return p;
+}
+#endif  /* SCAN_NEON && PCRE2_CODE_UNIT_WIDTH == 8 */
+
+
+
+/*************************************************
+*       Scan for a starting code unit            *
+*************************************************/
+
+/* This function is used when a match can start only with one of the code
+units listed in the starting bitmap of a pattern. The bitmap contains only 256
+bits. When code units are 16 or 32 bits wide, all code units greater than 254
+set the 255 bit.
+
+Arguments:
+  p           where to start
+  end         end of the subject
+  re          the compiled pattern
+
+Returns:      pointer to the first code unit that is in the bitmap, or end
+*/
+
+PCRE2_SPTR
+PRIV(scan_start_bits)(PCRE2_SPTR p, PCRE2_SPTR end, const pcre2_real_code *re)
+{
+const uint8_t *start_bits = re->start_bitmap;
+
+#ifdef SCAN_SSSE3
+if (end - p >= 16 && SCAN_HAVE_SSSE3)
+  {
+  p = find_in_set_ssse3(p, end, re->start_nibbles);
+  if (end - p >= 16) return p;
+  }
+#endif
+
+#if defined SCAN_NEON && PCRE2_CODE_UNIT_WIDTH == 8
+if (end - p >= 16)
+  {
+  p = find_in_set_neon(p, end, re->start_nibbles);
+  if (end - p >= 16) return p;
+  }
+#endif
+
+while (p < end)
+  {
+  uint32_t c = *p;
+#if PCRE2_CODE_UNIT_WIDTH != 8
+  if (c > 255) c = 255;
+#endif
+  if ((start_bits[c/8] & (1u << (c&7))) != 0) break;
+  p++;
+  }
+
+return p;
+}
+
+
+
+/*************************************************
+*      Scan over a run of characters in a class  *
+*************************************************/
+
+/* This function is used for a maximizing repeat of a character class or of
+one of \d, \s, \w, \D, \S, and \W. It skips over code units that are certainly
+in the class, and returns where the run may end; the caller's own loop checks
+the code unit at that point and continues as before. It is used only in the
+8-bit library. The class is given as a bitmap of 256 bits, as in OP_CLASS or
+the cbits part of the character tables, and is negated for \D, \S, and \W. In
+UTF mode, only ASCII characters are skipped.
+
+Short runs are checked by a simple loop. Once a run is long enough, the
+bitmap of code units that end the run is transposed into a nibble table for the
+vector scan.
+
+Arguments:
+  p           where to start
+  end         the furthest point the run may extend to
+  map         the class bitmap
+  negate      TRUE to negate the class
+  ascii       TRUE to stop at any code unit greater than 127
+
+Returns:      pointer to the first code unit that may not be in the class, or
+                end
+*/
+
+#if PCRE2_CODE_UNIT_WIDTH == 8
+PCRE2_SPTR
+PRIV(scan_class_run)(PCRE2_SPTR p, PCRE2_SPTR end, const uint8_t *map,
+  BOOL negate, BOOL ascii)
+{
+uint8_t flip = negate? 0xff : 0;
+uint32_t c;
+
+#if defined SCAN_SSSE3 || defined SCAN_NEON
+PCRE2_SPTR short_end = (end - p > 32)? p + 32 : end;
+
+for (; p < short_end; p++)
+  {
+  c = *p;
+  if ((ascii && c > 127) || ((map[c/8] ^ flip) & (1u << (c&7))) == 0)
+    return p;
+  }
+
+if (end - p >= 16
+#ifdef SCAN_SSSE3
+    && SCAN_HAVE_SSSE3
+#endif
+   )
+  {
+  int half, k, j;
+  uint8_t nibbles[32];
+
+  /* Build the nibble table for the code units that are not in the class.
+  Bytes k, k+2, ... k+14 of each half of the bitmap hold the bits for the code
+  units with low nibbles 8k to 8k+7 and high nibbles 0 to 7 (8 to 15); this 8x8
+  bit matrix is transposed to get the table bytes. */
+
+  for (half = 0; half < 2; half++)
+    {
+    for (k = 0; k < 2; k++)
+      {
+      uint64_t x = 0, y;
+      for (j = 0; j < 8; j++)
+        {
+        uint8_t b = (ascii && half != 0)? 0 : map[half*16 + k + 2*j] ^ flip;
+        x |= (uint64_t)(uint8_t)~b << (8*j);
+        }
+      y = (x ^ (x >> 7)) & 0x00aa00aa00aa00aaULL;
+      x ^= y ^ (y << 7);
+      y = (x ^ (x >> 14)) & 0x0000cccc0000ccccULL;
+      x ^= y ^ (y << 14);
+      y = (x ^ (x >> 28)) & 0x00000000f0f0f0f0ULL;
+      x ^= y ^ (y << 28);
+      for (j = 0; j < 8; j++) nibbles[half*16 + k*8 + j] = (uint8_t)(x >> (8*j));
+      }
+    }
+
+#ifdef SCAN_SSSE3
+  p = find_in_set_ssse3(p, end, nibbles);
+#else
+  p = find_in_set_neon(p, end, nibbles);
+#endif
+  if (end - p >= 16) return p;
+  }
+#endif  /* SCAN_SSSE3 || SCAN_NEON */
+
+for (; p < end; p++)
+  {
+  c = *p;
+  if ((ascii && c > 127) || ((map[c/8] ^ flip) & (1u << (c&7))) == 0) break;
+  }
+return p;
+}
+#endif  /* PCRE2_CODE_UNIT_WIDTH == 8 */
+
+
+
+/*************************************************
+*      Scan for either of two code units         *
+*************************************************/
+
+/* This function finds the first occurrence of either of two code units, which
+may be the same. It is used to find a first or required code unit, in both its
+cases when caseless. Finding the earlier of the two in one pass avoids having
+to remember where each of them was previously found. In the 8-bit library, when
+vector instructions are not available, memchr() is used on short sections of
+the subject.
+
+Arguments:
+  p           where to start
+  end         end of the subject
+  c1          one code unit
+  c2          the other code unit
+
+Returns:      pointer to the first occurrence of c1 or c2, or end
+*/
+
+PCRE2_SPTR
+PRIV(memchr2)(PCRE2_SPTR p, PCRE2_SPTR end, PCRE2_UCHAR c1, PCRE2_UCHAR c2)
+{
+#if defined SCAN_SSE2 || defined SCAN_NEON
+#define UNITS_PER_VECTOR (16/(PCRE2_CODE_UNIT_WIDTH/8))
+#endif
+
+#ifdef SCAN_SSE2
+#if PCRE2_CODE_UNIT_WIDTH == 8
+const __m128i v1 = _mm_set1_epi8((char)c1);
+const __m128i v2 = _mm_set1_epi8((char)c2);
+#define VECTOR_CMPEQ _mm_cmpeq_epi8
+#elif PCRE2_CODE_UNIT_WIDTH == 16
+const __m128i v1 = _mm_set1_epi16((short)c1);
+const __m128i v2 = _mm_set1_epi16((short)c2);
+#define VECTOR_CMPEQ _mm_cmpeq_epi16
+#else
+const __m128i v1 = _mm_set1_epi32((int)c1);
+const __m128i v2 = _mm_set1_epi32((int)c2);
+#define VECTOR_CMPEQ _mm_cmpeq_epi32
+#endif
+
+while (end - p >= 2*UNITS_PER_VECTOR)
+  {
+  __m128i a = _mm_loadu_si128((const __m128i *)p);
+  __m128i b = _mm_loadu_si128((const __m128i *)(p + UNITS_PER_VECTOR));
+  unsigned int mask = (unsigned int)_mm_movemask_epi8(
+    _mm_or_si128(VECTOR_CMPEQ(a, v1), VECTOR_CMPEQ(a, v2))) |
+    ((unsigned int)_mm_movemask_epi8(
+    _mm_or_si128(VECTOR_CMPEQ(b, v1), VECTOR_CMPEQ(b, v2))) << 16);
+  if (mask != 0)
+    return p + __builtin_ctz(mask)/(PCRE2_CODE_UNIT_WIDTH/8);
+  p += 2*UNITS_PER_VECTOR;
+  }
+#undef VECTOR_CMPEQ
+
+#elif defined SCAN_NEON
+#if PCRE2_CODE_UNIT_WIDTH == 8
+const uint8x16_t v1 = vdupq_n_u8(c1);
+const uint8x16_t v2 = vdupq_n_u8(c2);
+#define VECTOR_EQ(x) vorrq_u8(vceqq_u8(x, v1), vceqq_u8(x, v2))
+#define VECTOR_LOAD vld1q_u8
+#elif PCRE2_CODE_UNIT_WIDTH == 16
+const uint16x8_t v1 = vdupq_n_u16(c1);
+const uint16x8_t v2 = vdupq_n_u16(c2);
+#define VECTOR_EQ(x) \
+  vreinterpretq_u8_u16(vorrq_u16(vceqq_u16(x, v1), vceqq_u16(x, v2)))
+#define VECTOR_LOAD vld1q_u16
+#else
+const uint32x4_t v1 = vdupq_n_u32(c1);
+const uint32x4_t v2 = vdupq_n_u32(c2);
+#define VECTOR_EQ(x) \
+  vreinterpretq_u8_u32(vorrq_u32(vceqq_u32(x, v1), vceqq_u32(x, v2)))
+#define VECTOR_LOAD vld1q_u32
+#endif
+
+/* Narrowing each 16-bit lane by 4 bits leaves 4 bits per byte of the result
+of the comparison in a 64-bit value. */
+
+while (end - p >= UNITS_PER_VECTOR)
+  {
+  uint8x16_t hit = VECTOR_EQ(VECTOR_LOAD(p));
+  uint64_t mask = vget_lane_u64(vreinterpret_u64_u8(
+    vshrn_n_u16(vreinterpretq_u16_u8(hit), 4)), 0);
+  if (mask != 0)
+    return p + (__builtin_ctzll(mask) >> 2)/(PCRE2_CODE_UNIT_WIDTH/8);
+  p += UNITS_PER_VECTOR;
+  }
+#undef VECTOR_EQ
+#undef VECTOR_LOAD
+
+#elif PCRE2_CODE_UNIT_WIDTH == 8
+while (end - p >= 64)
+  {
+  PCRE2_SPTR p1 = memchr(p, c1, 64);
+  PCRE2_SPTR p2 = memchr(p, c2, (p1 == NULL)? 64 : (size_t)(p1 - p));
+  if (p2 != NULL) return p2;
+  if (p1 != NULL) return p1;
+  p += 64;
+  }
+#endif
+
+while (p < end && *p != c1 && *p != c2) p++;
+return p;
+}
+
+/* End of pcre2_scan.c */
@@ -40,7 +40,8 @@ POSSIBILITY OF SUCH DAMAGE.
 
 
 /* This module contains functions for serializing and deserializing
-a sequence of compiled codes. */
+a sequence of compiled codes, and for placing compiled codes in a region of
+memory where they can be used in place. */
 
 
 #include "pcre2_internal.h"
@@ -50,6 +51,7 @@ a sequence of compiled codes. */
 /* Magic number to provide a small check against being handed junk. */
 
 #define SERIALIZED_DATA_MAGIC 0x50523253u
+#define SERIALIZED_REGION_MAGIC 0x50523252u
 
 /* Deserialization is limited to the current PCRE version and
 character width. */
@@ -97,8 +99,8 @@ for (i = 0; i < number_of_codes; i++)
   re = (const pcre2_real_code *)(codes[i]);
   if (re->magic_number != MAGIC_NUMBER) return PCRE2_ERROR_BADMAGIC;
   if (tables == NULL)
-    tables = re->tables;
-  else if (tables != re->tables)
+    tables = CODE_TABLES(re);
+  else if (tables != CODE_TABLES(re))
     return PCRE2_ERROR_MIXEDTABLES;
   total_size += re->blocksize;
   }
@@ -124,6 +126,7 @@ dst_bytes += TABLES_LENGTH;
 
 for (i = 0; i < number_of_codes; i++)
   {
+  uint32_t flags;
   re = (const pcre2_real_code *)(codes[i]);
   (void)memcpy(dst_bytes, (const char *)re, re->blocksize);
 
@@ -144,6 +147,12 @@ for (i = 0; i < number_of_codes; i++)
   (void)memset(dst_bytes + offsetof(pcre2_real_code, executable_jit), 0,
     sizeof(void *));
 
+  /* A code that came from a region is serialized as an ordinary code. */
+
+  flags = re->flags & ~PCRE2_MAPPED;
+  (void)memcpy(dst_bytes + offsetof(pcre2_real_code, flags), &flags,
+    sizeof(uint32_t));
+
   dst_bytes += re->blocksize;
   }
 
@@ -238,7 +247,7 @@ for (i = 0; i < number_of_codes; i++)
 
   dst_re->tables = tables;
   dst_re->executable_jit = NULL;
-  dst_re->flags |= PCRE2_DEREF_TABLES;
+  dst_re->flags = (dst_re->flags | PCRE2_DEREF_TABLES) & ~PCRE2_MAPPED;
 
   codes[i] = dst_re;
   dst_re = NULL;
@@ -278,6 +287,196 @@ return data->number_of_codes;
 }
 
 
+/*************************************************
+*       Place compiled patterns in a region      *
+*************************************************/
+
+/* The region is laid out as described with pcre2_serialized_region in
+pcre2_internal.h. If region is NULL, just the size that is needed is returned.
+Otherwise the region must be suitably aligned, and *region_size must give its
+size; on return it is set to the size that was used. */
+
+PCRE2_EXP_DEFN int32_t PCRE2_CALL_CONVENTION
+pcre2_serialize_encode_region(const pcre2_code **codes,
+  int32_t number_of_codes, uint8_t *region, PCRE2_SIZE *region_size)
+{
+int32_t i;
+PCRE2_SIZE total_size, tables_offset, offset;
+PCRE2_SIZE *offsets;
+const pcre2_real_code *re;
+const uint8_t *tables;
+pcre2_serialized_region *header;
+
+if (codes == NULL || region_size == NULL) return PCRE2_ERROR_NULL;
+if (number_of_codes <= 0) return PCRE2_ERROR_BADDATA;
+
+/* Compute total size. */
+
+tables_offset = REGION_ALIGN(sizeof(pcre2_serialized_region) +
+  number_of_codes * sizeof(PCRE2_SIZE));
+total_size = REGION_ALIGN(tables_offset + TABLES_LENGTH);
+tables = NULL;
+
+for (i = 0; i < number_of_codes; i++)
+  {
+  if (codes[i] == NULL) return PCRE2_ERROR_NULL;
+  re = (const pcre2_real_code *)(codes[i]);
+  if (re->magic_number != MAGIC_NUMBER) return PCRE2_ERROR_BADMAGIC;
+  if (tables == NULL)
+    tables = CODE_TABLES(re);
+  else if (tables != CODE_TABLES(re))
+    return PCRE2_ERROR_MIXEDTABLES;
+  total_size += REGION_ALIGN(REGION_ALIGN(re->blocksize) + sizeof(PCRE2_SIZE));
+  }
+
+if (region == NULL)
+  {
+  *region_size = total_size;
+  return number_of_codes;
+  }
+
+if (*region_size < total_size) return PCRE2_ERROR_NOMEMORY;
+if (((uintptr_t)region & (REGION_ALIGNMENT - 1)) != 0)
+  return PCRE2_ERROR_BADDATA;
+
+header = (pcre2_serialized_region *)region;
+header->magic = SERIALIZED_REGION_MAGIC;
+header->version = SERIALIZED_DATA_VERSION;
+header->config = SERIALIZED_DATA_CONFIG;
+header->number_of_codes = number_of_codes;
+header->size = total_size;
+
+offsets = (PCRE2_SIZE *)(region + sizeof(pcre2_serialized_region));
+memcpy(region + tables_offset, tables, TABLES_LENGTH);
+offset = REGION_ALIGN(tables_offset + TABLES_LENGTH);
+
+/* Each code is used in place, so it must not contain any pointers. Instead,
+it is marked, and the distance back to the tables follows it. */
+
+for (i = 0; i < number_of_codes; i++)
+  {
+  pcre2_real_code *dst_re = (pcre2_real_code *)(region + offset);
+  PCRE2_SIZE trailer;
+
+  re = (const pcre2_real_code *)(codes[i]);
+  memcpy(dst_re, re, re->blocksize);
+  memset(&dst_re->memctl, 0, sizeof(pcre2_memctl));
+  dst_re->tables = NULL;
+  dst_re->executable_jit = NULL;
+  dst_re->flags = (dst_re->flags | PCRE2_MAPPED) & ~PCRE2_DEREF_TABLES;
+
+  trailer = offset - tables_offset;
+  memcpy(region + offset + REGION_ALIGN(re->blocksize), &trailer,
+    sizeof(PCRE2_SIZE));
+
+  offsets[i] = offset;
+  offset += REGION_ALIGN(REGION_ALIGN(re->blocksize) + sizeof(PCRE2_SIZE));
+  }
+
+*region_size = total_size;
+return number_of_codes;
+}
+
+
+
+/*************************************************
+*     Use compiled patterns from a region        *
+*************************************************/
+
+/* Nothing is allocated or copied, and the region is not written to, so it can
+be a read-only mapping of a file or shared memory object. The codes remain
+valid for as long as the region is mapped; they must not be freed. Everything
+is checked, so that a corrupt region is not used. */
+
+PCRE2_EXP_DEFN int32_t PCRE2_CALL_CONVENTION
+pcre2_serialize_attach_region(const pcre2_code **codes,
+  int32_t number_of_codes, const uint8_t *region, PCRE2_SIZE region_size)
+{
+const pcre2_serialized_region *header =
+  (const pcre2_serialized_region *)region;
+const PCRE2_SIZE *offsets;
+PCRE2_SIZE tables_offset;
+int32_t i;
+
+if (region == NULL || codes == NULL) return PCRE2_ERROR_NULL;
+if (number_of_codes <= 0) return PCRE2_ERROR_BADDATA;
+if (((uintptr_t)region & (REGION_ALIGNMENT - 1)) != 0)
+  return PCRE2_ERROR_BADDATA;
+if (region_size < sizeof(pcre2_serialized_region))
+  return PCRE2_ERROR_BADSERIALIZEDDATA;
+if (header->magic != SERIALIZED_REGION_MAGIC) return PCRE2_ERROR_BADMAGIC;
+if (header->version != SERIALIZED_DATA_VERSION) return PCRE2_ERROR_BADMODE;
+if (header->config != SERIALIZED_DATA_CONFIG) return PCRE2_ERROR_BADMODE;
+if (header->number_of_codes <= 0 || header->size > region_size)
+  return PCRE2_ERROR_BADSERIALIZEDDATA;
+
+if (number_of_codes > header->number_of_codes)
+  number_of_codes = header->number_of_codes;
+
+tables_offset = REGION_ALIGN(sizeof(pcre2_serialized_region) +
+  (PCRE2_SIZE)header->number_of_codes * sizeof(PCRE2_SIZE));
+if (tables_offset > header->size ||
+    header->size - tables_offset < TABLES_LENGTH)
+  return PCRE2_ERROR_BADSERIALIZEDDATA;
+
+offsets = (const PCRE2_SIZE *)(region + sizeof(pcre2_serialized_region));
+
+for (i = 0; i < number_of_codes; i++)
+  {
+  const pcre2_real_code *re;
+  PCRE2_SIZE offset = offsets[i];
+  PCRE2_SIZE trailer;
+
+  if (offset < tables_offset + TABLES_LENGTH || offset > header->size ||
+      header->size - offset < sizeof(pcre2_real_code) ||
+      (offset & (REGION_ALIGNMENT - 1)) != 0)
+    return PCRE2_ERROR_BADSERIALIZEDDATA;
+
+  re = (const pcre2_real_code *)(region + offset);
+  if (re->magic_number != MAGIC_NUMBER ||
+      (re->flags & PCRE2_MAPPED) == 0 ||
+      re->blocksize <= sizeof(pcre2_real_code) ||
+      re->code_start >= re->blocksize ||
+      re->name_entry_size > MAX_NAME_SIZE + IMM2_SIZE + 1 ||
+      re->name_count > MAX_NAME_COUNT ||
+      re->blocksize > header->size - offset ||
+      header->size - offset < REGION_ALIGN(re->blocksize) + sizeof(PCRE2_SIZE))
+    return PCRE2_ERROR_BADSERIALIZEDDATA;
+
+  memcpy(&trailer, region + offset + REGION_ALIGN(re->blocksize),
+    sizeof(PCRE2_SIZE));
+  if (trailer != offset - tables_offset) return PCRE2_ERROR_BADSERIALIZEDDATA;
+
+  codes[i] = re;
+  }
+
+return number_of_codes;
+}
+
+
+
+/*************************************************
+*        Find the tables for a region code       *
+*************************************************/
+
+/* This is called by the CODE_TABLES() macro for codes that have the
+PCRE2_MAPPED flag.
+
+Argument:   the compiled code
+Returns:    pointer to the character tables in the code's region
+*/
+
+const uint8_t *
+PRIV(mapped_tables)(const pcre2_real_code *re)
+{
+PCRE2_SIZE trailer;
+memcpy(&trailer, (const uint8_t *)re + REGION_ALIGN(re->blocksize),
+  sizeof(PCRE2_SIZE));
+return (const uint8_t *)re - trailer;
+}
+
+
+
 /*************************************************
 *            Free the allocated stream           *
 *************************************************/
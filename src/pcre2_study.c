@@ -768,6 +768,305 @@ return -3;                 /* Avoid compiler warnings */
 
 
 
+/*************************************************
+*   Find the maximum subject length for a group  *
+*************************************************/
+
+/* Scan a parenthesized group and compute the maximum length of subject that
+it can match, in characters. This is an upper bound; it is used when a pattern
+is anchored at the end of the subject, so that matching can start near the end
+instead of trying every earlier starting position. Anything whose length cannot
+easily be bounded (unlimited repeats, back references, recursion, conditional
+groups, \X, and backtracking verbs) causes the scan to give up. Assertions do
+not consume characters, so they are skipped.
+
+When the outermost group is being scanned, endanchored points to a flag that
+is cleared unless every branch ends with an item that matches only at the end
+of the subject (possibly before a final newline). It is NULL for nested calls.
+
+Arguments:
+  code            pointer to start of group (the bracket)
+  utf             UTF flag
+  countptr        pointer to call count (to catch over complexity)
+  endanchored     NULL or pointer to the end-anchored flag
+
+Returns:   the maximum length
+           -1 unbounded, unknown, or pattern too complicated
+*/
+
+static int
+find_maxlength(PCRE2_SPTR code, BOOL utf, int *countptr, BOOL *endanchored)
+{
+int length = 0;
+int branchlength = 0;
+PCRE2_UCHAR last_op = OP_END;
+PCRE2_SPTR cc = code + 1 + LINK_SIZE;
+
+/* Skip over capturing bracket number */
+
+if (*code == OP_CBRA || *code == OP_SCBRA) cc += IMM2_SIZE;
+
+/* A large and/or complex regex can take too long to process. */
+
+if ((*countptr)++ > 1000) return -1;
+
+for (;;)
+  {
+  int d;
+  PCRE2_UCHAR op = *cc;
+
+  if (branchlength >= (int)UINT16_MAX) return -1;
+
+  switch (op)
+    {
+    /* Groups that match at most once contribute their longest branch. The
+    ket of a repeated group is caught below. */
+
+    case OP_BRA:
+    case OP_SBRA:
+    case OP_CBRA:
+    case OP_SCBRA:
+    case OP_ONCE:
+    case OP_SCRIPT_RUN:
+    d = find_maxlength(cc, utf, countptr, NULL);
+    if (d < 0) return d;
+    branchlength += d;
+    do cc += GET(cc, 1); while (*cc == OP_ALT);
+    cc += 1 + LINK_SIZE;
+    break;
+
+    /* End of a branch or of the group. If the group can repeat, there is no
+    upper bound. */
+
+    case OP_ALT:
+    case OP_KET:
+    case OP_END:
+    if (branchlength > length) length = branchlength;
+    if (endanchored != NULL && last_op != OP_EOD && last_op != OP_EODN &&
+        last_op != OP_DOLL)
+      *endanchored = FALSE;
+    if (op != OP_ALT) return length;
+    cc += 1 + LINK_SIZE;
+    branchlength = 0;
+    last_op = OP_END;
+    continue;
+
+    /* A group with a {0,1} quantifier is handled as the group itself; one
+    with a {0} quantifier matches nothing. */
+
+    case OP_BRAZERO:
+    case OP_BRAMINZERO:
+    case OP_BRAPOSZERO:
+    cc += PRIV(OP_lengths)[op];
+    continue;
+
+    case OP_SKIPZERO:
+    cc += PRIV(OP_lengths)[op];
+    do cc += GET(cc, 1); while (*cc == OP_ALT);
+    cc += 1 + LINK_SIZE;
+    break;
+
+    /* Skip over assertions and other items that do not match characters */
+
+    case OP_ASSERT:
+    case OP_ASSERT_NOT:
+    case OP_ASSERTBACK:
+    case OP_ASSERTBACK_NOT:
+    case OP_ASSERT_NA:
+    case OP_ASSERT_SCS:
+    case OP_ASSERTBACK_NA:
+    do cc += GET(cc, 1); while (*cc == OP_ALT);
+    cc += 1 + LINK_SIZE;
+    break;
+
+    /* Callouts are ignored when checking for an end anchor, so that the
+    optimization is not affected by automatic callouts. */
+
+    case OP_CALLOUT_STR:
+    cc += GET(cc, 1 + 2*LINK_SIZE);
+    continue;
+
+    case OP_CALLOUT:
+    cc += PRIV(OP_lengths)[op];
+    continue;
+
+    case OP_SET_SOM:
+    case OP_SOD:
+    case OP_SOM:
+    case OP_EOD:
+    case OP_EODN:
+    case OP_CIRC:
+    case OP_CIRCM:
+    case OP_DOLL:
+    case OP_DOLLM:
+    case OP_NOT_WORD_BOUNDARY:
+    case OP_WORD_BOUNDARY:
+    case OP_NOT_UCP_WORD_BOUNDARY:
+    case OP_UCP_WORD_BOUNDARY:
+    cc += PRIV(OP_lengths)[op];
+    break;
+
+    /* Single characters, and those with a {0,1} quantifier */
+
+    case OP_CHAR:
+    case OP_CHARI:
+    case OP_NOT:
+    case OP_NOTI:
+    case OP_QUERY:
+    case OP_QUERYI:
+    case OP_MINQUERY:
+    case OP_MINQUERYI:
+    case OP_POSQUERY:
+    case OP_POSQUERYI:
+    case OP_NOTQUERY:
+    case OP_NOTQUERYI:
+    case OP_NOTMINQUERY:
+    case OP_NOTMINQUERYI:
+    case OP_NOTPOSQUERY:
+    case OP_NOTPOSQUERYI:
+    branchlength++;
+    cc += PRIV(OP_lengths)[op];
+#ifdef SUPPORT_UNICODE
+    if (utf && HAS_EXTRALEN(cc[-1])) cc += GET_EXTRALEN(cc[-1]);
+#endif
+    break;
+
+    /* Bounded repetitions of a single character */
+
+    case OP_UPTO:
+    case OP_UPTOI:
+    case OP_MINUPTO:
+    case OP_MINUPTOI:
+    case OP_POSUPTO:
+    case OP_POSUPTOI:
+    case OP_NOTUPTO:
+    case OP_NOTUPTOI:
+    case OP_NOTMINUPTO:
+    case OP_NOTMINUPTOI:
+    case OP_NOTPOSUPTO:
+    case OP_NOTPOSUPTOI:
+    case OP_EXACT:
+    case OP_EXACTI:
+    case OP_NOTEXACT:
+    case OP_NOTEXACTI:
+    branchlength += GET2(cc, 1);
+    cc += PRIV(OP_lengths)[op];
+#ifdef SUPPORT_UNICODE
+    if (utf && HAS_EXTRALEN(cc[-1])) cc += GET_EXTRALEN(cc[-1]);
+#endif
+    break;
+
+    /* Repeated character types. "Any newline" may match two characters, and
+    \X has no upper bound. */
+
+    case OP_TYPEQUERY:
+    case OP_TYPEMINQUERY:
+    case OP_TYPEPOSQUERY:
+    if (cc[1] == OP_EXTUNI) return -1;
+    branchlength += (cc[1] == OP_ANYNL)? 2 : 1;
+    if (cc[1] == OP_PROP || cc[1] == OP_NOTPROP) cc += 2;
+    cc += PRIV(OP_lengths)[op];
+    break;
+
+    case OP_TYPEUPTO:
+    case OP_TYPEMINUPTO:
+    case OP_TYPEPOSUPTO:
+    case OP_TYPEEXACT:
+    if (cc[1 + IMM2_SIZE] == OP_EXTUNI) return -1;
+    branchlength += GET2(cc, 1) * ((cc[1 + IMM2_SIZE] == OP_ANYNL)? 2 : 1);
+    if (cc[1 + IMM2_SIZE] == OP_PROP || cc[1 + IMM2_SIZE] == OP_NOTPROP)
+      cc += 2;
+    cc += PRIV(OP_lengths)[op];
+    break;
+
+    /* Single character types */
+
+    case OP_PROP:
+    case OP_NOTPROP:
+    cc += 2;
+    PCRE2_FALLTHROUGH /* Fall through */
+
+    case OP_NOT_DIGIT:
+    case OP_DIGIT:
+    case OP_NOT_WHITESPACE:
+    case OP_WHITESPACE:
+    case OP_NOT_WORDCHAR:
+    case OP_WORDCHAR:
+    case OP_ANY:
+    case OP_ALLANY:
+    case OP_HSPACE:
+    case OP_NOT_HSPACE:
+    case OP_VSPACE:
+    case OP_NOT_VSPACE:
+    branchlength++;
+    cc++;
+    break;
+
+    case OP_ANYNL:
+    branchlength += 2;
+    cc++;
+    break;
+
+    /* Classes, possibly with a bounded quantifier */
+
+    case OP_CLASS:
+    case OP_NCLASS:
+#ifdef SUPPORT_WIDE_CHARS
+    case OP_XCLASS:
+    case OP_ECLASS:
+    if (op == OP_XCLASS || op == OP_ECLASS)
+      cc += GET(cc, 1);
+    else
+#endif
+      cc += PRIV(OP_lengths)[OP_CLASS];
+
+    switch (*cc)
+      {
+      case OP_CRQUERY:
+      case OP_CRMINQUERY:
+      case OP_CRPOSQUERY:
+      branchlength++;
+      cc++;
+      break;
+
+      case OP_CRRANGE:
+      case OP_CRMINRANGE:
+      case OP_CRPOSRANGE:
+      d = GET2(cc, 1 + IMM2_SIZE);
+      if (d == 0) return -1;          /* Unlimited maximum */
+      branchlength += d;
+      cc += 1 + 2 * IMM2_SIZE;
+      break;
+
+      case OP_CRSTAR:
+      case OP_CRMINSTAR:
+      case OP_CRPOSSTAR:
+      case OP_CRPLUS:
+      case OP_CRMINPLUS:
+      case OP_CRPOSPLUS:
+      return -1;
+
+      default:
+      branchlength++;
+      break;
+      }
+    break;
+
+    /* Everything else - unlimited repeats, repeated groups, back references,
+    recursion, conditions, \X, \C in UTF mode, and backtracking verbs - means
+    that there is no usable upper bound. In non-UTF mode \C is compiled as
+    OP_ALLANY. */
+
+    default:
+    return -1;
+    }
+
+  last_op = op;
+  }
+}
+
+
+
 /*************************************************
 *      Set a bit and maybe its alternate case    *
 *************************************************/
@@ -2039,6 +2338,19 @@ if ((re->flags & (PCRE2_FIRSTSET|PCRE2_STARTLINE)) == 0)
 
     DONE:
     re->flags |= flags;
+
+    /* If the bitmap is kept, rearrange it for the vector scan of the subject
+    in PRIV(scan_start_bits)(). Byte n of the first (second) half has bit h set
+    if the code unit h*16 + n (128 + h*16 + n) is a starting code unit. */
+
+    if ((flags & PCRE2_FIRSTMAPSET) != 0)
+      {
+      for (i = 0; i < 256; i++)
+        {
+        if ((re->start_bitmap[i/8] & (1u << (i&7))) != 0)
+          re->start_nibbles[(i >> 7)*16 + (i & 15)] |= 1u << ((i >> 4) & 7);
+        }
+      }
     }
   }
 
@@ -2080,7 +2392,1097 @@ if ((re->flags & (PCRE2_MATCH_EMPTY|PCRE2_HASACCEPT)) == 0 &&
     }
   }
 
+/* Find the maximum length of subject string, and whether the pattern can match
+only at the end of the subject. Together these allow the matchers to skip
+starting positions that are too far from the end. (*ACCEPT) can end a match
+early, so patterns that contain it are not considered. */
+
+if ((re->flags & PCRE2_HASACCEPT) == 0)
+  {
+  BOOL endanchored = TRUE;
+  int max;
+  count = 0;
+  max = find_maxlength(code, utf, &count, &endanchored);
+  if (max >= 0)
+    {
+    re->maxlength = (uint16_t)max;
+    if (endanchored) re->flags |= PCRE2_ENDANCHOR;
+    }
+  }
+
 return 0;
 }
 
+
+/*************************************************
+*   Decode an item that matches one character    *
+*************************************************/
+
+/* This function is used when setting up bit-parallel DFA tables and when
+checking whether a pattern can be matched in one pass. It decodes an item that
+matches exactly one character each time, possibly repeated.
+
+Arguments:
+  code         points to the item
+  item         where to return the details
+  utf          TRUE in UTF mode
+
+Returns:       pointer to the next item, or NULL if not a single-character item
+*/
+
+typedef struct char_item {
+  uint32_t type;       /* The item, or the repeated item, e.g. OP_DIGIT */
+  uint32_t c;          /* The character for character items */
+  const uint8_t *bitmap;   /* The bitmap for a class */
+  uint32_t min;        /* Minimum number of repeats */
+  uint32_t max;        /* Maximum, or UINT32_MAX for unlimited */
+  BOOL possessive;     /* TRUE for a possessive repeat */
+  BOOL repeated;       /* TRUE if the item is repeated */
+} char_item;
+
+static PCRE2_SPTR
+decode_char_item(PCRE2_SPTR code, char_item *item, BOOL utf)
+{
+uint32_t op = *code;
+uint32_t rep;
+
+(void)utf;  /* Not used in 32-bit mode */
+
+item->c = 0;
+item->bitmap = NULL;
+item->min = item->max = 1;
+item->possessive = item->repeated = FALSE;
+
+switch(op)
+  {
+  case OP_NOT_DIGIT:
+  case OP_DIGIT:
+  case OP_NOT_WHITESPACE:
+  case OP_WHITESPACE:
+  case OP_NOT_WORDCHAR:
+  case OP_WORDCHAR:
+  case OP_ANY:
+  case OP_ALLANY:
+  item->type = op;
+  return code + 1;
+
+  case OP_CHAR:
+  case OP_CHARI:
+  case OP_NOT:
+  case OP_NOTI:
+  item->type = op;
+  code++;
+  GETCHARINCTEST(item->c, code);
+  return code;
+
+  case OP_CLASS:
+  case OP_NCLASS:
+  item->type = op;
+  item->bitmap = (const uint8_t *)(code + 1);
+  code += 1 + 32 / sizeof(PCRE2_UCHAR);
+  op = *code;
+  if (op < OP_CRSTAR || op > OP_CRPOSRANGE) return code;
+  item->repeated = TRUE;
+  item->possessive = op >= OP_CRPOSSTAR;
+  switch(op)
+    {
+    case OP_CRSTAR:
+    case OP_CRMINSTAR:
+    case OP_CRPOSSTAR:
+    item->min = 0;
+    item->max = UINT32_MAX;
+    break;
+
+    case OP_CRPLUS:
+    case OP_CRMINPLUS:
+    case OP_CRPOSPLUS:
+    item->max = UINT32_MAX;
+    break;
+
+    case OP_CRQUERY:
+    case OP_CRMINQUERY:
+    case OP_CRPOSQUERY:
+    item->min = 0;
+    break;
+
+    default:   /* OP_CRRANGE, OP_CRMINRANGE, OP_CRPOSRANGE */
+    item->min = GET2(code, 1);
+    item->max = GET2(code, 1 + IMM2_SIZE);
+    if (item->max == 0) item->max = UINT32_MAX;
+    return code + 1 + 2 * IMM2_SIZE;
+    }
+  return code + 1;
+
+  default:
+  if (op >= OP_STAR && op <= OP_NOTPOSUPTOI)
+    {
+    if (op >= OP_NOTSTARI) { rep = op - OP_NOTSTARI; op = OP_NOTI; }
+    else if (op >= OP_NOTSTAR) { rep = op - OP_NOTSTAR; op = OP_NOT; }
+    else if (op >= OP_STARI) { rep = op - OP_STARI; op = OP_CHARI; }
+    else { rep = op - OP_STAR; op = OP_CHAR; }
+    }
+  else if (op >= OP_TYPESTAR && op <= OP_TYPEPOSUPTO)
+    rep = op - OP_TYPESTAR;
+  else return NULL;
+  break;
+  }
+
+/* The repeats are in the same order for all types of item. */
+
+code++;
+item->repeated = TRUE;
+item->possessive = rep + OP_STAR >= OP_POSSTAR;
+
+switch(rep + OP_STAR)
+  {
+  case OP_STAR:
+  case OP_MINSTAR:
+  case OP_POSSTAR:
+  item->min = 0;
+  item->max = UINT32_MAX;
+  break;
+
+  case OP_PLUS:
+  case OP_MINPLUS:
+  case OP_POSPLUS:
+  item->max = UINT32_MAX;
+  break;
+
+  case OP_QUERY:
+  case OP_MINQUERY:
+  case OP_POSQUERY:
+  item->min = 0;
+  break;
+
+  case OP_UPTO:
+  case OP_MINUPTO:
+  case OP_POSUPTO:
+  item->min = 0;
+  item->max = GET2(code, 0);
+  code += IMM2_SIZE;
+  break;
+
+  default:   /* OP_EXACT */
+  item->min = item->max = GET2(code, 0);
+  code += IMM2_SIZE;
+  break;
+  }
+
+if (op >= OP_TYPESTAR)
+  {
+  item->type = *code++;
+  if (item->type < OP_NOT_DIGIT || item->type > OP_ALLANY) return NULL;
+  }
+else
+  {
+  item->type = op;
+  GETCHARINCTEST(item->c, code);
+  }
+
+return code;
+}
+
+
+
+/*************************************************
+*    Newline test for bit-parallel DFA tables    *
+*************************************************/
+
+/* This function checks whether a single character is a newline, in the same
+way as IS_NEWLINE() does at match time. It is not called for the CRLF
+convention, where the answer depends on the following character.
+
+Arguments:
+  c            the character
+  convention   the pattern's newline convention
+
+Returns:       TRUE if c is a newline
+*/
+
+static BOOL
+bp_is_newline(uint32_t c, uint32_t convention)
+{
+switch(convention)
+  {
+  case PCRE2_NEWLINE_CR:
+  return c == CHAR_CR;
+
+  case PCRE2_NEWLINE_LF:
+  return c == CHAR_NL;
+
+  case PCRE2_NEWLINE_NUL:
+  return c == CHAR_NUL;
+
+  case PCRE2_NEWLINE_ANYCRLF:
+  return c == CHAR_CR || c == CHAR_LF;
+
+  case PCRE2_NEWLINE_ANY:
+  return c == CHAR_LF || c == CHAR_VT || c == CHAR_FF || c == CHAR_CR ||
+    c == CHAR_NEL
+#ifndef EBCDIC
+    || c == 0x2028 || c == 0x2029
+#endif
+    ;
+
+  default:
+  return FALSE;
+  }
+}
+
+
+
+/*************************************************
+*  Match a character for bit-parallel DFA tables *
+*************************************************/
+
+/* This function decides whether a character is matched by one of the items
+that the bit-parallel DFA matcher supports. It must give exactly the same
+answer as the corresponding code in internal_dfa_match(), including the small
+differences between an item on its own and a repeated item.
+
+Arguments:
+  item         the item
+  c            the character
+  re           the compiled pattern
+
+Returns:       TRUE if the character matches
+*/
+
+typedef struct bp_item {
+  uint32_t type;       /* OP_CHAR, OP_CHARI, OP_NOT, OP_NOTI, OP_CLASS, */
+                       /* OP_NCLASS, or a character type such as OP_DIGIT */
+  uint32_t c;          /* The character for character items */
+  uint32_t othercase;  /* Its other case for repeated or negated items */
+  const uint8_t *bitmap;   /* The bitmap for a class */
+  BOOL repeated;       /* TRUE if the item is repeated */
+  uint64_t positions;  /* The positions to which the item was expanded */
+} bp_item;
+
+static BOOL
+bp_item_matches(const bp_item *item, uint32_t c, const pcre2_real_code *re)
+{
+const uint8_t *tables = re->tables;
+uint32_t d = item->c;
+
+switch(item->type)
+  {
+  case OP_CHAR:
+  return c == d;
+
+  case OP_CHARI:
+  if (item->repeated) return c == d || c == item->othercase;
+#ifdef SUPPORT_UNICODE
+  if ((re->overall_options & (PCRE2_UTF|PCRE2_UCP)) != 0)
+    return c == d ||
+      d == ((c < 128)? tables[fcc_offset + c] : UCD_OTHERCASE(c));
+#endif
+  return TABLE_GET(c, tables + lcc_offset, c) ==
+    TABLE_GET(d, tables + lcc_offset, d);
+
+  case OP_NOT:
+  return c != d;
+
+  case OP_NOTI:
+  return c != d && c != item->othercase;
+
+  case OP_CLASS:
+  case OP_NCLASS:
+  if (c > 255) return item->type == OP_NCLASS;
+  return (item->bitmap[c/8] & (1u << (c&7))) != 0;
+
+  case OP_DIGIT:
+  return c < 256 && (tables[ctypes_offset + c] & ctype_digit) != 0;
+
+  case OP_NOT_DIGIT:
+  return c > 255 || (tables[ctypes_offset + c] & ctype_digit) == 0;
+
+  case OP_WHITESPACE:
+  return c < 256 && (tables[ctypes_offset + c] & ctype_space) != 0;
+
+  case OP_NOT_WHITESPACE:
+  return c > 255 || (tables[ctypes_offset + c] & ctype_space) == 0;
+
+  case OP_WORDCHAR:
+  return c < 256 && (tables[ctypes_offset + c] & ctype_word) != 0;
+
+  case OP_NOT_WORDCHAR:
+  return c > 255 || (tables[ctypes_offset + c] & ctype_word) == 0;
+
+  /* A repeated "any character" does not check characters greater than 255
+  for being a newline. */
+
+  case OP_ANY:
+  if (item->repeated && c > 255) return TRUE;
+  return !bp_is_newline(c, re->newline_convention);
+
+  default:   /* OP_ALLANY */
+  return TRUE;
+  }
+}
+
+
+
+/*************************************************
+*    Set up tables for bit-parallel DFA matching *
+*************************************************/
+
+/* This function is called at the end of compiling a pattern when
+PCRE2_EXTRA_DFA_BITPARALLEL is set. If the pattern is a single sequence of
+items that each match one character, possibly repeated, optionally preceded by
+a start assertion and followed by an end assertion, it fills in the tables
+that are used by pcre2_dfa_match() to match it by the bit-parallel method.
+Non-repeated brackets are allowed, because they make no difference to DFA
+matching, but alternatives, repeated groups, and all other items cause the
+function to fail. The space for the tables was reserved by pcre2_compile().
+
+Argument:
+  re       points to the compiled expression
+
+Returns:   TRUE if the tables were set up; FALSE if the pattern is unsuitable
+*/
+
+BOOL
+PRIV(study_bitparallel)(pcre2_real_code *re)
+{
+dfa_bitparallel *bp =
+  (dfa_bitparallel *)((uint8_t *)re + BITPARALLEL_OFFSET(re));
+PCRE2_SPTR code = (PCRE2_SPTR)((uint8_t *)re + re->code_start);
+bp_item items[BITPARALLEL_MAX_POSITIONS];
+uint32_t item_count = 0;
+uint32_t positions = 0;
+uint32_t max_char;
+uint32_t i;
+uint32_t c;
+int depth = 0;
+#ifdef SUPPORT_UNICODE
+BOOL utf = (re->overall_options & PCRE2_UTF) != 0;
+BOOL utf_or_ucp = (re->overall_options & (PCRE2_UTF|PCRE2_UCP)) != 0;
+#else
+BOOL utf = FALSE;
+#endif
+
+memset(bp, 0, sizeof(dfa_bitparallel));
+bp->start_assert = bp->end_assert = OP_END;
+
+#ifdef SUPPORT_UNICODE
+if (utf) max_char = MAX_UTF_CODE_POINT; else
+#endif
+#if PCRE2_CODE_UNIT_WIDTH == 8
+  max_char = 0xff;
+#elif PCRE2_CODE_UNIT_WIDTH == 16
+  max_char = 0xffff;
+#else
+  max_char = 0xffffffffu;
+#endif
+
+/* Scan the compiled pattern, expanding each item into positions. */
+
+for (;;)
+  {
+  bp_item *item;
+  char_item decoded;
+  const uint8_t *bitmap;
+  uint32_t op = *code;
+  uint32_t min, max;
+  BOOL possessive, repeated;
+
+  switch(op)
+    {
+    case OP_BRA:
+    depth++;
+    code += 1 + LINK_SIZE;
+    continue;
+
+    case OP_CBRA:
+    depth++;
+    code += 1 + LINK_SIZE + IMM2_SIZE;
+    continue;
+
+    case OP_KET:
+    if (--depth < 0) return FALSE;
+    code += 1 + LINK_SIZE;
+    continue;
+
+    case OP_END:
+    goto DONE;
+
+    case OP_CIRC:
+    case OP_SOD:
+    case OP_SOM:
+    if (positions > 0 || bp->start_assert != OP_END) return FALSE;
+    bp->start_assert = (uint8_t)op;
+    code++;
+    continue;
+
+    /* An end assertion may be followed only by the ends of brackets. */
+
+    case OP_DOLL:
+    case OP_EOD:
+    case OP_EODN:
+    bp->end_assert = (uint8_t)op;
+    code++;
+    while (*code == OP_KET)
+      {
+      depth--;
+      code += 1 + LINK_SIZE;
+      }
+    if (*code != OP_END) return FALSE;
+    goto DONE;
+
+    /* Any other item must match a single character, possibly repeated. In
+    the positions an unlimited maximum is represented by zero. */
+
+    default:
+    code = decode_char_item(code, &decoded, utf);
+    if (code == NULL) return FALSE;
+    op = decoded.type;
+    c = decoded.c;
+    bitmap = decoded.bitmap;
+    min = decoded.min;
+    max = (decoded.max == UINT32_MAX)? 0 : decoded.max;
+    possessive = decoded.possessive;
+    repeated = decoded.repeated;
+    break;
+    }
+
+  /* The "." metacharacter cannot be handled when the newline is CRLF, because
+  whether CR is a newline depends on the following character. */
+
+  if (op == OP_ANY && re->newline_convention == PCRE2_NEWLINE_CRLF)
+    return FALSE;
+
+  /* Set up the item, then expand it into positions: "min" mandatory ones,
+  followed by an optional looping position if the maximum is unlimited, or
+  enough optional ones to reach the maximum. */
+
+  if (item_count >= BITPARALLEL_MAX_POSITIONS ||
+      min > BITPARALLEL_MAX_POSITIONS || max > BITPARALLEL_MAX_POSITIONS)
+    return FALSE;
+
+  item = items + item_count++;
+  item->type = op;
+  item->repeated = repeated;
+  item->positions = 0;
+  if (op >= OP_CHAR && op <= OP_NOTI)
+    {
+    item->c = c;
+#ifdef SUPPORT_UNICODE
+    if (utf_or_ucp && c >= 128) item->othercase = UCD_OTHERCASE(c); else
+#endif
+    item->othercase = TABLE_GET(c, re->tables + fcc_offset, c);
+    }
+  else if (op == OP_CLASS || op == OP_NCLASS)
+    item->bitmap = bitmap;
+
+  for (i = 0; i < ((max == 0)? min + 1 : max); i++)
+    {
+    uint64_t bit;
+    if (positions >= BITPARALLEL_MAX_POSITIONS) return FALSE;
+    bit = (uint64_t)1 << positions++;
+    item->positions |= bit;
+    if (i < min) continue;
+    bp->optional |= bit;
+    if (possessive) bp->possessive |= bit;
+    if (max == 0) bp->loop |= bit;
+    }
+  }
+
+/* The whole pattern has been scanned. Set up the character masks. */
+
+DONE:
+if (depth != 0) return FALSE;
+bp->accept = (uint64_t)1 << positions;
+
+for (i = 0; i < item_count; i++)
+  {
+  bp_item *item = items + i;
+  for (c = 0; c < 256; c++)
+    if (bp_item_matches(item, c, re)) bp->chars[c] |= item->positions;
+  }
+
+/* Characters greater than 255 can occur except in 8-bit non-UTF mode. The
+"high" mask covers all of them, except for a few exceptional characters that
+are listed separately. */
+
+if (max_char > 255)
+  {
+  for (i = 0; i < item_count; i++)
+    {
+    bp_item *item = items + i;
+    uint32_t candidates[8];
+    uint32_t candidate_count = 0;
+    uint32_t j, k;
+
+    switch(item->type)
+      {
+      case OP_CHARI:
+      candidates[candidate_count++] = item->othercase;
+#ifdef SUPPORT_UNICODE
+      if (!item->repeated && utf_or_ucp)
+        {
+        candidates[candidate_count - 1] = UCD_OTHERCASE(item->c);
+        if (UCD_CASESET(item->c) != 0)
+          {
+          const uint32_t *cp = PRIV(ucd_caseless_sets) + UCD_CASESET(item->c);
+          while (*cp != NOTACHAR && candidate_count < 6)
+            candidates[candidate_count++] = *cp++;
+          if (*cp != NOTACHAR) return FALSE;
+          }
+        }
+#endif
+      PCRE2_FALLTHROUGH /* Fall through */
+
+      case OP_CHAR:
+      case OP_NOT:
+      case OP_NOTI:
+      candidates[candidate_count++] = item->c;
+      if (item->type == OP_NOTI)
+        candidates[candidate_count++] = item->othercase;
+      if (item->type != OP_CHAR && item->type != OP_CHARI)
+        bp->high |= item->positions;
+      break;
+
+      case OP_ANY:
+      if (!item->repeated &&
+          re->newline_convention == PCRE2_NEWLINE_ANY)
+        {
+        candidates[candidate_count++] = 0x2028;
+        candidates[candidate_count++] = 0x2029;
+        }
+      PCRE2_FALLTHROUGH /* Fall through */
+
+      case OP_ALLANY:
+      case OP_NCLASS:
+      case OP_NOT_DIGIT:
+      case OP_NOT_WHITESPACE:
+      case OP_NOT_WORDCHAR:
+      bp->high |= item->positions;
+      break;
+
+      default:
+      break;
+      }
+
+    /* Add any new exceptional characters to the list. */
+
+    for (j = 0; j < candidate_count; j++)
+      {
+      uint32_t x = candidates[j];
+      if (x <= 255 || x > max_char) continue;
+      for (k = 0; k < bp->except_count; k++)
+        if (bp->except_chars[k] == x) break;
+      if (k < bp->except_count) continue;
+      if (k >= BITPARALLEL_MAX_EXCEPTIONS) return FALSE;
+      bp->except_chars[k] = x;
+      bp->except_count++;
+      }
+    }
+
+  /* Compute the masks for the exceptional characters. */
+
+  for (i = 0; i < bp->except_count; i++)
+    {
+    uint32_t j;
+    for (j = 0; j < item_count; j++)
+      if (bp_item_matches(items + j, bp->except_chars[i], re))
+        bp->except_masks[i] |= items[j].positions;
+    }
+  }
+
+return TRUE;
+}
+
+
+
+/*************************************************
+*   Find the characters matched by an item       *
+*************************************************/
+
+/* The set of characters that may be matched next at some point in a pattern is
+kept as a bitmap for characters less than 256, with a flag that is set if any
+larger character might match. Two further flags record whether an end of line
+assertion ($ or \Z) or the end of the pattern might be reached without matching
+a character. The "newline" flag is set if a character in the set might be a
+newline, or the first character of a CRLF newline. */
+
+typedef struct op_set {
+  uint8_t bits[32];    /* Characters less than 256 */
+  BOOL high;           /* Any larger character might match */
+  BOOL newline;        /* A newline might match */
+  BOOL dollar;         /* $ or \Z might be reached */
+  BOOL end;            /* The end of the pattern might be reached */
+} op_set;
+
+/* This function adds the characters matched by one item to a set. It follows
+the code for the item in pcre2_match(), which treats a single caseless
+character differently from a repeated one. The result may contain extra
+characters, but it must not leave any out.
+
+Arguments:
+  item         the item
+  set          the set
+  re           the compiled pattern
+
+Returns:       nothing
+*/
+
+static void
+op_add_item(const char_item *item, op_set *set, const pcre2_real_code *re)
+{
+const uint8_t *tables = re->tables;
+uint32_t d = item->c;
+uint32_t oc = 0;
+uint32_t c;
+BOOL newline = FALSE;
+#ifdef SUPPORT_UNICODE
+BOOL utf_or_ucp = (re->overall_options & (PCRE2_UTF|PCRE2_UCP)) != 0;
+#endif
+
+if (item->type >= OP_CHAR && item->type <= OP_NOTI)
+  {
+#ifdef SUPPORT_UNICODE
+  if (utf_or_ucp && d > 127) oc = UCD_OTHERCASE(d); else
+#endif
+  oc = TABLE_GET(d, tables + fcc_offset, d);
+  }
+
+for (c = 0; c < 256; c++)
+  {
+  BOOL yield;
+
+  switch(item->type)
+    {
+    case OP_CHAR:
+    yield = c == d;
+    break;
+
+    case OP_CHARI:
+    yield = c == d || c == oc;
+#ifdef SUPPORT_UNICODE
+    if (!item->repeated && (!utf_or_ucp || d < 128))
+#else
+    if (!item->repeated)
+#endif
+      yield = TABLE_GET(d, tables + lcc_offset, d) == tables[lcc_offset + c];
+    break;
+
+    case OP_NOT:
+    yield = c != d;
+    break;
+
+    case OP_NOTI:
+    yield = c != d && c != oc;
+    break;
+
+    case OP_CLASS:
+    case OP_NCLASS:
+    yield = (item->bitmap[c/8] & (1u << (c&7))) != 0;
+    break;
+
+    case OP_DIGIT:
+    yield = (tables[ctypes_offset + c] & ctype_digit) != 0;
+    break;
+
+    case OP_NOT_DIGIT:
+    yield = (tables[ctypes_offset + c] & ctype_digit) == 0;
+    break;
+
+    case OP_WHITESPACE:
+    yield = (tables[ctypes_offset + c] & ctype_space) != 0;
+    break;
+
+    case OP_NOT_WHITESPACE:
+    yield = (tables[ctypes_offset + c] & ctype_space) == 0;
+    break;
+
+    case OP_WORDCHAR:
+    yield = (tables[ctypes_offset + c] & ctype_word) != 0;
+    break;
+
+    case OP_NOT_WORDCHAR:
+    yield = (tables[ctypes_offset + c] & ctype_word) == 0;
+    break;
+
+    /* Whether a CR matches "." in CRLF mode depends on the next character,
+    so it is included. */
+
+    case OP_ANY:
+    yield = re->newline_convention == PCRE2_NEWLINE_CRLF ||
+      !bp_is_newline(c, re->newline_convention);
+    break;
+
+    default:   /* OP_ALLANY */
+    yield = TRUE;
+    break;
+    }
+
+  if (!yield) continue;
+  set->bits[c/8] |= 1u << (c&7);
+  if (bp_is_newline(c, re->newline_convention) ||
+      (c == CHAR_CR && re->newline_convention == PCRE2_NEWLINE_CRLF))
+    newline = TRUE;
+  }
+
+switch(item->type)
+  {
+  case OP_CHAR:
+  case OP_CHARI:
+  if (d > 255 || (item->type == OP_CHARI && oc > 255)) set->high = TRUE;
+  break;
+
+  case OP_CLASS:
+  case OP_DIGIT:
+  case OP_WHITESPACE:
+  case OP_WORDCHAR:
+  break;
+
+  default:
+  set->high = TRUE;
+  if (re->newline_convention == PCRE2_NEWLINE_ANY) newline = TRUE;
+  break;
+  }
+
+/* The "." item never matches where a newline starts. */
+
+if (newline && item->type != OP_ANY) set->newline = TRUE;
+}
+
+
+
+/*************************************************
+*    Find what may follow a point in a pattern   *
+*************************************************/
+
+/* This function adds to a set the characters that may be matched first by the
+rest of a pattern, starting at a given point, and notes whether an end of line
+assertion or the end of the pattern may be reached first. It fails for any item
+that the one-pass matcher does not support, and also if the amount of work
+becomes too large, which can happen with many optional items in alternatives.
+
+Arguments:
+  code         points to the first item
+  set          the set
+  re           the compiled pattern
+  countptr     points to a counter of remaining work
+
+Returns:       TRUE if the set is complete; FALSE if it is unknown
+*/
+
+static BOOL
+op_follow(PCRE2_SPTR code, op_set *set, const pcre2_real_code *re,
+  int *countptr)
+{
+#ifdef SUPPORT_UNICODE
+BOOL utf = (re->overall_options & PCRE2_UTF) != 0;
+#else
+BOOL utf = FALSE;
+#endif
+
+for (;;)
+  {
+  char_item item;
+  PCRE2_SPTR next;
+
+  if ((*countptr)-- <= 0) return FALSE;
+
+  switch(*code)
+    {
+    /* At the end of a branch, carry on after the end of the group. */
+
+    case OP_ALT:
+    do code += GET(code, 1); while (*code == OP_ALT);
+    break;
+
+    case OP_KET:
+    code += 1 + LINK_SIZE;
+    break;
+
+    case OP_END:
+    set->end = TRUE;
+    return TRUE;
+
+    case OP_DOLL:
+    case OP_EODN:
+    set->dollar = TRUE;
+    return TRUE;
+
+    /* \z fails everywhere except at the end of the subject. */
+
+    case OP_EOD:
+    return TRUE;
+
+    /* Each branch of a group carries on after the group. */
+
+    case OP_BRA:
+    case OP_CBRA:
+    next = code;
+    do
+      {
+      if (!op_follow(next + ((next == code)? PRIV(OP_lengths)[*next] :
+          1 + LINK_SIZE), set, re, countptr))
+        return FALSE;
+      next += GET(next, 1);
+      }
+    while (*next == OP_ALT);
+    return TRUE;
+
+    /* An optional group may be skipped. */
+
+    case OP_BRAZERO:
+    code++;
+    if (*code != OP_BRA && *code != OP_CBRA) return FALSE;
+    if (!op_follow(code, set, re, countptr)) return FALSE;
+    do code += GET(code, 1); while (*code == OP_ALT);
+    code += 1 + LINK_SIZE;
+    break;
+
+    default:
+    next = decode_char_item(code, &item, utf);
+    if (next == NULL) return FALSE;
+    op_add_item(&item, set, re);
+    if (item.min > 0) return TRUE;
+    code = next;
+    break;
+    }
+  }
+}
+
+
+
+/*************************************************
+*   Check a choice for one-pass matching         *
+*************************************************/
+
+/* A choice between continuing with an item or a group and carrying on with
+the rest of the pattern is deterministic if the characters that the item can
+match cannot be matched first by the rest of the pattern, and the rest of the
+pattern cannot succeed, or match an end of line assertion at a character that
+the item matches, without matching any characters. Under these conditions,
+backtracking into the choice always fails.
+
+Arguments:
+  take         the characters that continue the item or group
+  code         the rest of the pattern
+  re           the compiled pattern
+  countptr     points to a counter of remaining work
+
+Returns:       TRUE if the choice is deterministic
+*/
+
+static BOOL
+op_check_choice(const op_set *take, PCRE2_SPTR code, const pcre2_real_code *re,
+  int *countptr)
+{
+op_set follow;
+uint32_t i;
+
+memset(&follow, 0, sizeof(op_set));
+if (!op_follow(code, &follow, re, countptr)) return FALSE;
+if (follow.end || (take->high && follow.high) ||
+    (follow.dollar && take->newline))
+  return FALSE;
+for (i = 0; i < 32; i++)
+  if ((take->bits[i] & follow.bits[i]) != 0) return FALSE;
+return TRUE;
+}
+
+
+
+/*************************************************
+*   Find the first characters of a branch        *
+*************************************************/
+
+/* This function adds to a set the characters that can start a branch of a
+group that the one-pass matcher chooses by looking at the next character. The
+branch must start with an item that matches a single character at least once,
+possibly inside groups that are not optional.
+
+Arguments:
+  code         points to the start of the branch
+  set          the set
+  re           the compiled pattern
+
+Returns:       TRUE if the branch is suitable
+*/
+
+static BOOL
+op_add_first(PCRE2_SPTR code, op_set *set, const pcre2_real_code *re)
+{
+char_item item;
+#ifdef SUPPORT_UNICODE
+BOOL utf = (re->overall_options & PCRE2_UTF) != 0;
+#else
+BOOL utf = FALSE;
+#endif
+
+if (*code == OP_BRA || *code == OP_CBRA)
+  {
+  PCRE2_SPTR branch = code;
+  do
+    {
+    if (!op_add_first(branch + ((branch == code)? PRIV(OP_lengths)[*branch] :
+        1 + LINK_SIZE), set, re))
+      return FALSE;
+    branch += GET(branch, 1);
+    }
+  while (*branch == OP_ALT);
+  return TRUE;
+  }
+
+if (decode_char_item(code, &item, utf) == NULL || item.min == 0) return FALSE;
+op_add_item(&item, set, re);
+return TRUE;
+}
+
+
+
+/*************************************************
+*   Check a group's branches for one-pass match  *
+*************************************************/
+
+/* When a group has more than one branch, or is optional, no character may be
+matched first by more than one branch. The one-pass matcher chooses a branch by
+looking at the next character.
+
+Arguments:
+  code         points to the start of the group
+  take         where to return the characters that start the branches
+  re           the compiled pattern
+
+Returns:       TRUE if the branches are suitable
+*/
+
+static BOOL
+op_check_branches(PCRE2_SPTR code, op_set *take, const pcre2_real_code *re)
+{
+PCRE2_SPTR branch = code;
+
+memset(take, 0, sizeof(op_set));
+
+do
+  {
+  op_set first;
+  uint32_t i;
+
+  memset(&first, 0, sizeof(op_set));
+  if (!op_add_first(branch + ((branch == code)? PRIV(OP_lengths)[*branch] :
+      1 + LINK_SIZE), &first, re))
+    return FALSE;
+
+  if (first.high && take->high) return FALSE;
+  for (i = 0; i < 32; i++)
+    {
+    if ((first.bits[i] & take->bits[i]) != 0) return FALSE;
+    take->bits[i] |= first.bits[i];
+    }
+  take->high |= first.high;
+  take->newline |= first.newline;
+  branch += GET(branch, 1);
+  }
+while (*branch == OP_ALT);
+
+return TRUE;
+}
+
+
+
+/*************************************************
+*    Check whether a pattern is one-pass         *
+*************************************************/
+
+/* This function is called at the end of compiling a pattern when
+PCRE2_EXTRA_ONEPASS is set. It checks whether an anchored match of the pattern
+can be found in a single forward scan, with no backtracking. This is so if the
+pattern contains only items that match one character, possibly repeated,
+non-repeated groups (which may be optional), and simple assertions, and every
+choice that backtracking could revisit is decided by the next character. The
+choices are whether to repeat an item again, which branch of a group to follow,
+and whether to enter an optional group. Possessive repeats involve no choice,
+and the auto-possessification of repeats has already settled many others.
+
+Argument:
+  re       points to the compiled expression
+
+Returns:   TRUE if the pattern can be matched by the one-pass matcher
+*/
+
+BOOL
+PRIV(study_onepass)(const pcre2_real_code *re)
+{
+PCRE2_SPTR code = (PCRE2_SPTR)((const uint8_t *)re + re->code_start);
+int count = 10000;
+#ifdef SUPPORT_UNICODE
+BOOL utf = (re->overall_options & PCRE2_UTF) != 0;
+#else
+BOOL utf = FALSE;
+#endif
+
+for (;;)
+  {
+  op_set take;
+  char_item item;
+  PCRE2_SPTR next;
+  PCRE2_SPTR ket;
+
+  switch(*code)
+    {
+    case OP_END:
+    return TRUE;
+
+    case OP_CIRC:
+    case OP_SOD:
+    case OP_SOM:
+    case OP_DOLL:
+    case OP_EOD:
+    case OP_EODN:
+    code++;
+    break;
+
+    /* An optional group is entered if its first character matches. */
+
+    case OP_BRAZERO:
+    code++;
+    if (*code != OP_BRA && *code != OP_CBRA) return FALSE;
+    ket = code;
+    do ket += GET(ket, 1); while (*ket == OP_ALT);
+    if (*ket != OP_KET ||
+        !op_check_branches(code, &take, re) ||
+        !op_check_choice(&take, ket + 1 + LINK_SIZE, re, &count))
+      return FALSE;
+    code += PRIV(OP_lengths)[*code];
+    break;
+
+    case OP_BRA:
+    case OP_CBRA:
+    ket = code;
+    do ket += GET(ket, 1); while (*ket == OP_ALT);
+    if (*ket != OP_KET) return FALSE;
+    if (code[GET(code, 1)] == OP_ALT && !op_check_branches(code, &take, re))
+      return FALSE;
+    code += PRIV(OP_lengths)[*code];
+    break;
+
+    case OP_ALT:
+    case OP_KET:
+    code += 1 + LINK_SIZE;
+    break;
+
+    /* An item whose repeat is neither fixed nor possessive involves a choice
+    after its minimum number of characters. */
+
+    default:
+    next = decode_char_item(code, &item, utf);
+    if (next == NULL) return FALSE;
+    if (item.min != item.max && !item.possessive)
+      {
+      memset(&take, 0, sizeof(op_set));
+      op_add_item(&item, &take, re);
+      if (!op_check_choice(&take, next, re, &count)) return FALSE;
+      }
+    code = next;
+    break;
+    }
+  }
+}
+
 /* End of pcre2_study.c */
@@ -44,6 +44,7 @@ POSSIBILITY OF SUCH DAMAGE.
 
 
 #define PTR_STACK_SIZE 20
+#define REPLACEMENT_STACK_SIZE 1024
 
 #define SUBSTITUTE_OPTIONS \
   (PCRE2_SUBSTITUTE_EXTENDED|PCRE2_SUBSTITUTE_GLOBAL| \
@@ -382,10 +383,10 @@ while (input < input_end)
 #endif
   if (MAX_255(ch))
     {
-    if (((code->tables + cbits_offset +
+    if (((CODE_TABLES(code) + cbits_offset +
         (next_to_upper? cbit_upper:cbit_lower)
         )[ch/8] & (1u << (ch%8))) == 0)
-      ch = (code->tables + fcc_offset)[ch];
+      ch = (CODE_TABLES(code) + fcc_offset)[ch];
     }
 
 #ifdef SUPPORT_UNICODE
@@ -605,6 +606,924 @@ return rc + rc2;
 }
 
 
+/*************************************************
+*          Compile a replacement string          *
+*************************************************/
+
+/* Types of item in a compiled replacement. */
+
+enum { REPL_LITERAL,    /* Literal run */
+       REPL_GROUP,      /* $n, ${name}, \g<name>, etc. */
+       REPL_COND,       /* ${n:+text1:text2} or ${n:-text1} */
+       REPL_CASE,       /* \U, \L, \u, \l, \E */
+       REPL_MARK,       /* ${*MARK} */
+       REPL_BEFORE,     /* $` */
+       REPL_AFTER,      /* $' */
+       REPL_SUBJECT,    /* $_ */
+       REPL_LAST,       /* $+ */
+       REPL_ERROR };    /* An error, given when the item is reached */
+
+/* These options affect the interpretation of a replacement string, so they are
+fixed when it is compiled. */
+
+#define REPLACEMENT_COMPILE_OPTIONS \
+  (PCRE2_SUBSTITUTE_EXTENDED|PCRE2_SUBSTITUTE_LITERAL| \
+   PCRE2_SUBSTITUTE_UNKNOWN_UNSET)
+
+/* Data used while compiling a replacement. The replacement is compiled twice:
+the first time the vectors are NULL and the items, group list entries, and
+literal code units are just counted; the second time they are filled in. An
+error is compiled as a REPL_ERROR item, so that it is given only when a
+substitution reaches it; the first one that is not in the text of a conditional
+substitution is also remembered, because every substitution reaches it. */
+
+typedef struct replacement_block {
+  const pcre2_real_code *code;   /* The pattern */
+  PCRE2_SPTR replacement;        /* Start of the replacement string */
+  replacement_item *items;       /* Item vector, or NULL when counting */
+  uint32_t *groups;              /* Group list, or NULL when counting */
+  PCRE2_UCHAR *literals;         /* Literal buffer, or NULL when counting */
+  replacement_item dummy_item;   /* Item written when counting */
+  PCRE2_SIZE item_count;         /* Items so far */
+  PCRE2_SIZE group_count;        /* Group list entries so far */
+  PCRE2_SIZE literal_count;      /* Literal code units so far */
+  PCRE2_SIZE erroroffset;        /* Offset of the first unconditional error */
+  int error;                     /* The first unconditional error, or 0 */
+  uint32_t options;              /* Substitute options */
+  BOOL utf;                      /* UTF replacement */
+  BOOL escaped_literal;          /* Inside \Q...\E */
+} replacement_block;
+
+#define NO_LITERAL_ITEM (~(PCRE2_SIZE)0)
+
+/* Add an item to a compiled replacement. When counting, a dummy item is
+returned so that the caller can fill it in regardless. */
+
+static replacement_item *
+add_replacement_item(replacement_block *rb, int type, PCRE2_SPTR ptr)
+{
+replacement_item *item = (rb->items == NULL)? &rb->dummy_item :
+  rb->items + rb->item_count;
+memset(item, 0, sizeof(replacement_item));
+item->type = type;
+item->offset = ptr - rb->replacement;
+rb->item_count++;
+return item;
+}
+
+/* Add literal code units to a compiled replacement. Adjacent literals are
+coalesced into a single item; *litptr is the index of the current literal item,
+or NO_LITERAL_ITEM if the previous item was not a literal. */
+
+static void
+add_replacement_literal(replacement_block *rb, PCRE2_SPTR text,
+  PCRE2_SIZE length, PCRE2_SPTR ptr, PCRE2_SIZE *litptr)
+{
+if (*litptr == NO_LITERAL_ITEM)
+  {
+  replacement_item *item = add_replacement_item(rb, REPL_LITERAL, ptr);
+  item->start = rb->literal_count;
+  *litptr = rb->item_count - 1;
+  }
+if (rb->items != NULL)
+  {
+  rb->items[*litptr].length += length;
+  memcpy(rb->literals + rb->literal_count, text, CU2BYTES(length));
+  }
+rb->literal_count += length;
+}
+
+/* Set the group for a group or conditional item. A group that is identified by
+name is resolved to its number; if the name is duplicated, the candidate
+numbers are saved in the group list, so that the first one that is set can be
+chosen when substituting.
+
+Arguments:
+  rb          the compile data
+  item        the item
+  group       the group number, or -1 for a name
+  name        the zero-terminated name
+
+Returns:      0 or a negative error code
+*/
+
+static int
+set_replacement_group(replacement_block *rb, replacement_item *item,
+  int group, PCRE2_SPTR name)
+{
+const pcre2_real_code *code = rb->code;
+PCRE2_SPTR first, last, entry;
+int rc;
+
+/* A numbered group that does not exist is diagnosed here; the error item
+that replaces the group item has the offset at which it would be found when
+the item is substituted. */
+
+if (group >= 0)
+  {
+  if ((uint32_t)group > code->top_bracket &&
+      (rb->options & PCRE2_SUBSTITUTE_UNKNOWN_UNSET) == 0)
+    return PCRE2_ERROR_NOSUBSTRING;
+  item->group = group;
+  return 0;
+  }
+
+rc = pcre2_substring_nametable_scan((const pcre2_code *)code, name, &first,
+  &last);
+if (rc == PCRE2_ERROR_NOSUBSTRING &&
+    (rb->options & PCRE2_SUBSTITUTE_UNKNOWN_UNSET) != 0)
+  {
+  item->group = code->top_bracket + 1;
+  return 0;
+  }
+if (rc < 0) return rc;
+
+if (first == last)
+  {
+  item->group = GET2(first, 0);
+  return 0;
+  }
+
+item->group = (uint32_t)rb->group_count;
+for (entry = first; entry <= last; entry += rc)
+  {
+  if (rb->groups != NULL) rb->groups[rb->group_count] = GET2(entry, 0);
+  rb->group_count++;
+  item->group_count++;
+  }
+return 0;
+}
+
+/* This function compiles a replacement text: the whole replacement or one of
+the texts in a conditional substitution. When an error is found, an error item
+ends the text, because an item that follows could never be reached.
+
+Arguments:
+  rb          the compile data
+  ptr         start of the text
+  repend      end of the text
+  depth       nesting depth of conditional substitutions
+
+Returns:      nothing
+*/
+
+static void
+compile_replacement_text(replacement_block *rb, PCRE2_SPTR ptr,
+  PCRE2_SPTR repend, uint32_t depth)
+{
+const pcre2_real_code *code = rb->code;
+const pcre2_code *pcode = (const pcre2_code *)code;
+BOOL utf = rb->utf;
+PCRE2_SIZE lit = NO_LITERAL_ITEM;
+PCRE2_UCHAR temp[6];
+int rc;
+
+while (ptr < repend)
+  {
+  uint32_t ch;
+  unsigned int chlen;
+  int group;
+  uint32_t special;
+  replacement_item *item;
+  PCRE2_SPTR text1_start = NULL;
+  PCRE2_SPTR text1_end = NULL;
+  PCRE2_SPTR text2_start = NULL;
+  PCRE2_SPTR text2_end = NULL;
+  PCRE2_UCHAR name[MAX_NAME_SIZE + 1];
+
+  if (rb->escaped_literal)
+    {
+    if (ptr[0] == CHAR_BACKSLASH && ptr < repend - 1 && ptr[1] == CHAR_E)
+      {
+      rb->escaped_literal = FALSE;
+      ptr += 2;
+      continue;
+      }
+    goto LOADLITERAL;
+    }
+
+  /* Not in literal mode. */
+
+  if (*ptr == CHAR_DOLLAR_SIGN)
+    {
+    BOOL inparens;
+    BOOL inangle;
+    BOOL star;
+    PCRE2_UCHAR next;
+
+    if (++ptr >= repend) goto BAD;
+    if ((next = *ptr) == CHAR_DOLLAR_SIGN) goto LOADLITERAL;
+
+    special = 0;
+    group = -1;
+    inparens = FALSE;
+    inangle = FALSE;
+    star = FALSE;
+
+    /* Special $ sequences, as supported by Perl, JavaScript, .NET and others. */
+
+    if (next == CHAR_AMPERSAND)
+      {
+      ++ptr;
+      group = 0;
+      goto GROUP_SUBSTITUTE;
+      }
+    if (next == CHAR_GRAVE_ACCENT || next == CHAR_APOSTROPHE ||
+        next == CHAR_UNDERSCORE)
+      {
+      ++ptr;
+      (void)add_replacement_item(rb, (next == CHAR_GRAVE_ACCENT)? REPL_BEFORE :
+        (next == CHAR_APOSTROPHE)? REPL_AFTER : REPL_SUBJECT, ptr);
+      lit = NO_LITERAL_ITEM;
+      continue;
+      }
+    if (next == CHAR_PLUS &&
+        !(ptr+1 < repend && ptr[1] == CHAR_LEFT_CURLY_BRACKET))
+      {
+      ++ptr;
+      if (code->top_bracket == 0 &&
+          (rb->options & PCRE2_SUBSTITUTE_UNKNOWN_UNSET) == 0)
+        {
+        rc = PCRE2_ERROR_NOSUBSTRING;
+        goto PTREXIT;
+        }
+      (void)add_replacement_item(rb, REPL_LAST, ptr);
+      lit = NO_LITERAL_ITEM;
+      continue;
+      }
+
+    if (next == CHAR_LEFT_CURLY_BRACKET)
+      {
+      if (++ptr >= repend) goto BAD;
+      next = *ptr;
+      inparens = TRUE;
+      }
+    else if (next == CHAR_LESS_THAN_SIGN)
+      {
+      if (++ptr >= repend) goto BAD;
+      next = *ptr;
+      inangle = TRUE;
+      }
+
+    if (!inangle && next == CHAR_ASTERISK)
+      {
+      if (++ptr >= repend) goto BAD;
+      next = *ptr;
+      star = TRUE;
+      }
+
+    if (!star && !inangle && next >= CHAR_0 && next <= CHAR_9)
+      {
+      group = next - CHAR_0;
+      while (++ptr < repend)
+        {
+        next = *ptr;
+        if (next < CHAR_0 || next > CHAR_9) break;
+        group = group * 10 + (next - CHAR_0);
+        if (group > code->top_bracket)
+          {
+          if ((rb->options & PCRE2_SUBSTITUTE_UNKNOWN_UNSET) != 0)
+            {
+            while (++ptr < repend && *ptr >= CHAR_0 && *ptr <= CHAR_9);
+            break;
+            }
+          else
+            {
+            rc = PCRE2_ERROR_NOSUBSTRING;
+            goto PTREXIT;
+            }
+          }
+        }
+      }
+    else
+      {
+      PCRE2_SIZE name_len;
+      PCRE2_SPTR name_start = ptr;
+      if (!read_name_subst(&ptr, repend, utf, CODE_TABLES(code) + ctypes_offset))
+        goto BAD;
+      name_len = ptr - name_start;
+      memcpy(name, name_start, CU2BYTES(name_len));
+      name[name_len] = 0;
+      }
+
+    /* In extended mode we recognize ${name:+set text:unset text} and
+    ${name:-default text}. */
+
+    if (inparens)
+      {
+      if ((rb->options & PCRE2_SUBSTITUTE_EXTENDED) != 0 &&
+           !star && ptr < repend - 2 && *ptr == CHAR_COLON)
+        {
+        special = *(++ptr);
+        if (special != CHAR_PLUS && special != CHAR_MINUS)
+          {
+          rc = PCRE2_ERROR_BADSUBSTITUTION;
+          goto PTREXIT;
+          }
+
+        text1_start = ++ptr;
+        rc = find_text_end(pcode, &ptr, repend, special == CHAR_MINUS);
+        if (rc != 0) goto PTREXIT;
+        text1_end = ptr;
+
+        if (special == CHAR_PLUS && *ptr == CHAR_COLON)
+          {
+          text2_start = ++ptr;
+          rc = find_text_end(pcode, &ptr, repend, TRUE);
+          if (rc != 0) goto PTREXIT;
+          text2_end = ptr;
+          }
+        }
+
+      else
+        {
+        if (ptr >= repend || *ptr != CHAR_RIGHT_CURLY_BRACKET)
+          {
+          rc = PCRE2_ERROR_REPMISSINGBRACE;
+          goto PTREXIT;
+          }
+        }
+
+      ptr++;
+      }
+
+    if (inangle)
+      {
+      if (ptr >= repend || *ptr != CHAR_GREATER_THAN_SIGN)
+        goto BAD;
+      ptr++;
+      }
+
+    /* Only *MARK is currently recognized. */
+
+    if (star)
+      {
+      if (PRIV(strcmp_c8)(name, STRING_MARK) != 0) goto BAD;
+      (void)add_replacement_item(rb, REPL_MARK, ptr);
+      lit = NO_LITERAL_ITEM;
+      continue;
+      }
+
+    /* Add a group item; for a conditional substitution, compile its texts,
+    which follow the item. */
+
+    GROUP_SUBSTITUTE:
+    item = add_replacement_item(rb, (special == 0)? REPL_GROUP : REPL_COND,
+      ptr);
+    lit = NO_LITERAL_ITEM;
+    rc = set_replacement_group(rb, item, group, name);
+    if (rc < 0)
+      {
+      rb->item_count--;      /* The error item replaces the group item */
+      goto PTREXIT;
+      }
+
+    /* The texts of a conditional substitution that is nested too deeply are
+    not compiled; substituting it gives an error if a text is needed. */
+
+    if (special != 0)
+      {
+      PCRE2_SIZE index = rb->item_count - 1;
+      PCRE2_SIZE text1_items = 0;
+      PCRE2_SIZE text2_items = 0;
+
+      item->special = special;
+      if (depth < PTR_STACK_SIZE/2)
+        {
+        compile_replacement_text(rb, text1_start, text1_end, depth + 1);
+        text1_items = rb->item_count - index - 1;
+        if (text2_start != NULL)
+          compile_replacement_text(rb, text2_start, text2_end, depth + 1);
+        text2_items = rb->item_count - index - 1 - text1_items;
+        }
+
+      if (rb->items != NULL)
+        {
+        rb->items[index].text1_items = text1_items;
+        rb->items[index].text2_items = text2_items;
+        }
+      }
+    }   /* End of $ processing */
+
+  /* Handle an escape sequence in extended mode. */
+
+  else if ((rb->options & PCRE2_SUBSTITUTE_EXTENDED) != 0 &&
+            *ptr == CHAR_BACKSLASH)
+    {
+    int errorcode;
+    case_state new_forcecase = { PCRE2_SUBSTITUTE_CASE_NONE, FALSE };
+
+    if (ptr < repend - 1) switch (ptr[1])
+      {
+      case CHAR_L:
+      new_forcecase.to_case = PCRE2_SUBSTITUTE_CASE_LOWER;
+      new_forcecase.single_char = FALSE;
+      ptr += 2;
+      break;
+
+      case CHAR_l:
+      new_forcecase.to_case = PCRE2_SUBSTITUTE_CASE_LOWER;
+      new_forcecase.single_char = TRUE;
+      ptr += 2;
+      if (ptr + 2 < repend && ptr[0] == CHAR_BACKSLASH && ptr[1] == CHAR_U)
+        {
+        new_forcecase.to_case = PCRE2_SUBSTITUTE_CASE_REVERSE_TITLE_FIRST;
+        new_forcecase.single_char = FALSE;
+        ptr += 2;
+        }
+      break;
+
+      case CHAR_U:
+      new_forcecase.to_case = PCRE2_SUBSTITUTE_CASE_UPPER;
+      new_forcecase.single_char = FALSE;
+      ptr += 2;
+      break;
+
+      case CHAR_u:
+      new_forcecase.to_case = PCRE2_SUBSTITUTE_CASE_TITLE_FIRST;
+      new_forcecase.single_char = TRUE;
+      ptr += 2;
+      if (ptr + 2 < repend && ptr[0] == CHAR_BACKSLASH && ptr[1] == CHAR_L)
+        {
+        new_forcecase.to_case = PCRE2_SUBSTITUTE_CASE_TITLE_FIRST;
+        new_forcecase.single_char = FALSE;
+        ptr += 2;
+        }
+      break;
+
+      default:
+      break;
+      }
+
+    if (new_forcecase.to_case != PCRE2_SUBSTITUTE_CASE_NONE)
+      {
+      SETFORCECASE:
+      item = add_replacement_item(rb, REPL_CASE, ptr);
+      item->to_case = (uint8_t)new_forcecase.to_case;
+      item->single_char = (uint8_t)new_forcecase.single_char;
+      lit = NO_LITERAL_ITEM;
+      continue;
+      }
+
+    ptr++;  /* Point after \ */
+    rc = PRIV(check_escape)(&ptr, repend, &ch, &errorcode,
+      code->overall_options, code->extra_options, code->top_bracket, FALSE, NULL);
+    if (errorcode != 0) goto BADESCAPE;
+
+    switch(rc)
+      {
+      case ESC_E:
+      goto SETFORCECASE;
+
+      case ESC_Q:
+      rb->escaped_literal = TRUE;
+      continue;
+
+      case 0:      /* Data character */
+      case ESC_b:  /* \b is backspace in a substitution */
+      case ESC_v:  /* \v is vertical tab in a substitution */
+
+      if (rc == ESC_b) ch = CHAR_BS;
+      if (rc == ESC_v) ch = CHAR_VT;
+
+#ifdef SUPPORT_UNICODE
+      if (utf) chlen = PRIV(ord2utf)(ch, temp); else
+#endif
+        {
+        temp[0] = ch;
+        chlen = 1;
+        }
+
+      add_replacement_literal(rb, temp, chlen, ptr, &lit);
+      continue;
+
+      case ESC_g:
+        {
+        PCRE2_SIZE name_len;
+        PCRE2_SPTR name_start;
+
+        /* Parse the \g<name> form (\g<number> already handled by check_escape) */
+        if (ptr >= repend || *ptr != CHAR_LESS_THAN_SIGN)
+          goto BADESCAPE;
+        ++ptr;
+
+        name_start = ptr;
+        if (!read_name_subst(&ptr, repend, utf, CODE_TABLES(code) + ctypes_offset))
+          goto BADESCAPE;
+        name_len = ptr - name_start;
+
+        if (ptr >= repend || *ptr != CHAR_GREATER_THAN_SIGN)
+          goto BADESCAPE;
+        ++ptr;
+
+        special = 0;
+        group = -1;
+        memcpy(name, name_start, CU2BYTES(name_len));
+        name[name_len] = 0;
+        goto GROUP_SUBSTITUTE;
+        }
+
+      default:
+      if (rc < 0)
+        {
+        special = 0;
+        group = -rc - 1;
+        goto GROUP_SUBSTITUTE;
+        }
+      goto BADESCAPE;
+      }
+    }   /* End of backslash processing */
+
+  /* Handle a literal code unit */
+
+  else
+    {
+    PCRE2_SPTR ch_start;
+
+    LOADLITERAL:
+    ch_start = ptr;
+    GETCHARINCTEST(ch, ptr);    /* Get character value, increment pointer */
+    (void) ch;
+    add_replacement_literal(rb, ch_start, ptr - ch_start, ptr, &lit);
+    }
+  }
+
+return;
+
+BAD:
+rc = PCRE2_ERROR_BADREPLACEMENT;
+goto PTREXIT;
+
+BADESCAPE:
+rc = PCRE2_ERROR_BADREPESCAPE;
+
+/* The error item ends the text, which therefore does not end in \Q mode. */
+
+PTREXIT:
+add_replacement_item(rb, REPL_ERROR, ptr)->group = (uint32_t)(-rc);
+rb->escaped_literal = FALSE;
+if (depth == 0 && rb->error == 0)
+  {
+  rb->error = rc;
+  rb->erroroffset = (PCRE2_SIZE)(ptr - rb->replacement);
+  }
+}
+
+/* This function compiles both item programs of a replacement: the second is
+compiled only if the first ends inside an unterminated \Q, so that a following
+substitution starts in literal mode, as in pcre2_substitute(). A LITERAL
+replacement is a single literal run.
+
+Arguments:
+  rb          the compile data
+  rep         the replacement being filled in, or NULL when counting
+  replacement the replacement string
+  rlength     its length
+
+Returns:      nothing
+*/
+
+static void
+compile_replacement_programs(replacement_block *rb,
+  pcre2_real_replacement *rep, PCRE2_SPTR replacement, PCRE2_SIZE rlength)
+{
+int i;
+
+for (i = 0; i < 2; i++)
+  {
+  PCRE2_SIZE start = rb->item_count;
+  BOOL ends_literal = FALSE;
+
+  if ((rb->options & PCRE2_SUBSTITUTE_LITERAL) != 0)
+    {
+    PCRE2_SIZE lit = NO_LITERAL_ITEM;
+    if (rlength > 0)
+      add_replacement_literal(rb, replacement, rlength, replacement, &lit);
+    }
+  else
+    {
+    rb->escaped_literal = (i > 0);
+    compile_replacement_text(rb, replacement, replacement + rlength, 0);
+    ends_literal = rb->escaped_literal;
+    }
+
+  if (rep != NULL)
+    {
+    rep->program_start[i] = start;
+    rep->program_items[i] = rb->item_count - start;
+    rep->ends_literal[i] = ends_literal;
+    }
+
+  if (i == 0 && !ends_literal)
+    {
+    if (rep != NULL)
+      {
+      rep->program_start[1] = start;
+      rep->program_items[1] = rb->item_count - start;
+      rep->ends_literal[1] = FALSE;
+      }
+    break;
+    }
+  }
+}
+
+/* This function compiles a replacement for pcre2_replacement_compile(), and
+for pcre2_substitute(), which compiles its replacement when the first match is
+found. The replacement is counted, and then compiled into memory obtained from
+memctl, or into the caller's vector if it is big enough. The UTF validity of
+the replacement must already have been checked.
+
+Arguments:
+  rb          the compile data, set up by this function
+  code        the compiled pattern
+  replacement the replacement string
+  rlength     its length
+  options     the substitute options
+  memctl      the memory control block
+  vector      a vector to use if it is big enough, or NULL
+  vsize       size of the vector
+
+Returns:      pointer to the compiled replacement, or NULL if there is not
+              enough memory or, when vector is NULL, if there is an error
+              that every substitution would give, in which case rb->error
+              and rb->erroroffset are set
+*/
+
+static pcre2_real_replacement *
+compile_replacement(replacement_block *rb, const pcre2_real_code *code,
+  PCRE2_SPTR replacement, PCRE2_SIZE rlength, uint32_t options,
+  pcre2_memctl *memctl, void *vector, PCRE2_SIZE vsize)
+{
+pcre2_real_replacement *rep;
+PCRE2_SIZE max_items, size, groups_offset, literals_offset;
+
+rb->code = code;
+rb->replacement = replacement;
+rb->options = options & REPLACEMENT_COMPILE_OPTIONS;
+rb->utf = (code->overall_options & PCRE2_UTF) != 0;
+rb->error = 0;
+
+/* Count, then allocate and fill in. */
+
+rb->items = NULL;
+rb->groups = NULL;
+rb->literals = NULL;
+rb->item_count = rb->group_count = rb->literal_count = 0;
+
+compile_replacement_programs(rb, NULL, replacement, rlength);
+if (rb->error != 0 && vector == NULL) return NULL;
+
+max_items = (~(PCRE2_SIZE)0 - sizeof(pcre2_real_replacement)) / 2 /
+  sizeof(replacement_item);
+if (rb->item_count > max_items || rb->group_count > max_items ||
+    rb->literal_count > max_items)
+  {
+  rb->error = PCRE2_ERROR_NOMEMORY;
+  rb->erroroffset = PCRE2_UNSET;
+  return NULL;
+  }
+
+groups_offset = sizeof(pcre2_real_replacement) +
+  rb->item_count * sizeof(replacement_item);
+literals_offset = groups_offset + rb->group_count * sizeof(uint32_t);
+size = literals_offset + CU2BYTES(rb->literal_count);
+
+if (size <= vsize) rep = vector; else
+  {
+  rep = PRIV(memctl_malloc)(size, memctl);
+  if (rep == NULL)
+    {
+    rb->error = PCRE2_ERROR_NOMEMORY;
+    rb->erroroffset = PCRE2_UNSET;
+    return NULL;
+    }
+  }
+
+rep->code = code;
+rep->options = rb->options;
+rep->items = (replacement_item *)((uint8_t *)rep + sizeof(pcre2_real_replacement));
+rep->groups = (uint32_t *)((uint8_t *)rep + groups_offset);
+rep->literals = (PCRE2_SPTR)((uint8_t *)rep + literals_offset);
+
+rb->items = rep->items;
+rb->groups = rep->groups;
+rb->literals = (PCRE2_UCHAR *)rep->literals;
+rb->item_count = rb->group_count = rb->literal_count = 0;
+
+compile_replacement_programs(rb, rep, replacement, rlength);
+return rep;
+}
+
+/* This function parses a replacement string once, so that it can then be
+used for any number of substitutions by pcre2_substitute_compiled() without
+being interpreted again. Group names are resolved to numbers, runs of literal
+characters and escapes are coalesced, and case forcing escapes are decoded.
+
+Arguments:
+  code            points to the compiled pattern
+  replacement     points to the replacement string
+  rlength         length of replacement string
+  options         option bits
+  errorptr        where to put an error code
+  erroroffset     where to put an offset in the replacement
+  gcontext        points to a general context, or is NULL
+
+Returns:          pointer to the compiled replacement, or NULL on error
+*/
+
+PCRE2_EXP_DEFN pcre2_replacement * PCRE2_CALL_CONVENTION
+pcre2_replacement_compile(const pcre2_code *code, PCRE2_SPTR replacement,
+  PCRE2_SIZE rlength, uint32_t options, int *errorptr, PCRE2_SIZE *erroroffset,
+  pcre2_general_context *gcontext)
+{
+pcre2_real_replacement *rep;
+replacement_block rb;
+PCRE2_UCHAR null_str[1] = { 0xcd };
+
+if (errorptr == NULL || erroroffset == NULL) return NULL;
+*erroroffset = PCRE2_UNSET;
+
+if (code == NULL || (replacement == NULL && rlength != 0))
+  {
+  *errorptr = PCRE2_ERROR_NULL;
+  return NULL;
+  }
+
+if ((options & ~(REPLACEMENT_COMPILE_OPTIONS|PCRE2_NO_UTF_CHECK)) != 0)
+  {
+  *errorptr = PCRE2_ERROR_BADOPTION;
+  return NULL;
+  }
+
+if (replacement == NULL) replacement = null_str;
+if (rlength == PCRE2_ZERO_TERMINATED) rlength = PRIV(strlen)(replacement);
+
+/* Check UTF replacement string if necessary. */
+
+#ifdef SUPPORT_UNICODE
+if ((((const pcre2_real_code *)code)->overall_options & PCRE2_UTF) != 0 &&
+    (options & PCRE2_NO_UTF_CHECK) == 0)
+  {
+  int rc = PRIV(valid_utf)(replacement, rlength, erroroffset);
+  if (rc != 0)
+    {
+    *errorptr = rc;
+    return NULL;
+    }
+  }
+#endif  /* SUPPORT_UNICODE */
+
+if (gcontext == NULL)
+  gcontext = (pcre2_general_context *)CODE_MEMCTL(code);
+rep = compile_replacement(&rb, (const pcre2_real_code *)code, replacement,
+  rlength, options, (pcre2_memctl *)gcontext, NULL, 0);
+if (rep == NULL)
+  {
+  *errorptr = rb.error;
+  *erroroffset = rb.erroroffset;
+  return NULL;
+  }
+
+*errorptr = 0;
+return rep;
+}
+
+
+
+/*************************************************
+*          Free a compiled replacement           *
+*************************************************/
+
+PCRE2_EXP_DEFN void PCRE2_CALL_CONVENTION
+pcre2_replacement_free(pcre2_replacement *replacement)
+{
+if (replacement != NULL)
+  replacement->memctl.free(replacement, replacement->memctl.memory_data);
+}
+
+
+/*************************************************
+*        Search for a literal string pattern     *
+*************************************************/
+
+/* When pcre2_compile() has found that a pattern is a plain literal string
+(PCRE2_LITERALPAT), the second and subsequent matches of a global substitution
+are found by searching for its first code unit and comparing the rest in place,
+instead of calling pcre2_match(). The search uses memchr() in the 8-bit library
+and PRIV(memchr2)() in the others. The first match is always found by
+pcre2_match(), which checks the subject and the options. The compiled pattern
+is a single bracket containing only OP_CHAR items.
+
+The first function returns the length of the literal in code units.
+
+Argument:   the compiled pattern
+Returns:    the length
+*/
+
+static PCRE2_SIZE
+literal_length(const pcre2_real_code *re)
+{
+BOOL utf = (re->overall_options & PCRE2_UTF) != 0;
+PCRE2_SPTR cc = (PCRE2_SPTR)((const uint8_t *)re + re->code_start) +
+  1 + LINK_SIZE;
+PCRE2_SIZE len = 0;
+
+while (*cc == OP_CHAR)
+  {
+  cc += 2;
+  len++;
+#ifdef SUPPORT_UNICODE
+  if (utf && HAS_EXTRALEN(cc[-1]))
+    {
+    uint32_t extra = GET_EXTRALEN(cc[-1]);
+    cc += extra;
+    len += extra;
+    }
+#else
+  (void)utf;
+#endif
+  }
+
+return len;
+}
+
+/* The second function searches for the literal. When it is found, the match
+data is updated as pcre2_match() would have done.
+
+Arguments:
+  re              the compiled pattern
+  subject         the subject string
+  length          the length of the subject
+  start_offset    where to start the search
+  litlength       the length of the literal
+  match_data      the match data block
+
+Returns:          1 for a match, or PCRE2_ERROR_NOMATCH
+*/
+
+static int
+literal_match(const pcre2_real_code *re, PCRE2_SPTR subject,
+  PCRE2_SIZE length, PCRE2_SIZE start_offset, PCRE2_SIZE litlength,
+  pcre2_match_data *match_data)
+{
+PCRE2_SPTR code = (PCRE2_SPTR)((const uint8_t *)re + re->code_start) +
+  1 + LINK_SIZE;
+PCRE2_SPTR p = subject + start_offset;
+PCRE2_SPTR last;
+PCRE2_UCHAR fcu = code[1];
+
+match_data->start_offset = start_offset;
+match_data->mark = NULL;
+
+if (length - start_offset < litlength)
+  return match_data->rc = PCRE2_ERROR_NOMATCH;
+last = subject + length - litlength;
+
+for (; p <= last; p++)
+  {
+  PCRE2_SPTR cc = code;
+  PCRE2_SPTR s;
+  BOOL matched = TRUE;
+
+#if PCRE2_CODE_UNIT_WIDTH == 8
+  p = memchr(p, fcu, last - p + 1);
+  if (p == NULL) break;
+#else
+  p = PRIV(memchr2)(p, last + 1, fcu, fcu);
+  if (p > last) break;
+#endif
+
+  /* Compare the code units of each OP_CHAR item, skipping the opcodes. */
+
+  for (s = p; matched && *cc == OP_CHAR; )
+    {
+    cc++;
+    if (*s++ != *cc++) matched = FALSE;
+#ifdef SUPPORT_UNICODE
+    else if ((re->overall_options & PCRE2_UTF) != 0 && HAS_EXTRALEN(cc[-1]))
+      {
+      uint32_t extra = GET_EXTRALEN(cc[-1]);
+      if (memcmp(s, cc, CU2BYTES(extra)) != 0) matched = FALSE;
+      s += extra;
+      cc += extra;
+      }
+#endif
+    }
+
+  if (matched)
+    {
+    match_data->ovector[0] = match_data->startchar = match_data->leftchar =
+      p - subject;
+    match_data->ovector[1] = match_data->rightchar = s - subject;
+    return match_data->rc = 1;
+    }
+  }
+
+return match_data->rc = PCRE2_ERROR_NOMATCH;
+}
+
+
+
 /*************************************************
 *              Match and substitute              *
 *************************************************/
@@ -631,13 +1550,57 @@ Returns:          >= 0 number of substitutions made
                   PCRE2_ERROR_BADREPLACEMENT means invalid use of $
 */
 
+/* These macros are used when there is an output function. The first passes a
+piece of output to the function; the second passes what has been collected in
+the buffer, and then empties it. A negative return from the function ends the
+substitution, with that value as the result. */
+
+#define EMITOUTPUT(from, length_) \
+  do {    \
+     PCRE2_SIZE emit_length = length_; \
+     int emit_rc; \
+     if (emit_length > ~(PCRE2_SIZE)0 - output_total)  /* Integer overflow */ \
+       goto TOOLARGEREPLACE; \
+     emit_rc = substitute_output(from, emit_length, substitute_output_data); \
+     if (emit_rc < 0) \
+       {  \
+       rc = emit_rc; \
+       goto EXIT; \
+       }  \
+     output_total += emit_length; \
+     }    \
+  while (0)
+
+#define FLUSHOUTPUT() \
+  do {    \
+     if (buff_offset > 0) \
+       {  \
+       EMITOUTPUT(buffer, buff_offset); \
+       buff_offset = 0; \
+       lengthleft = buff_length; \
+       }  \
+     }    \
+  while (0)
+
 /* This macro checks for space in the buffer before copying into it. On
 overflow, either give an error immediately, or keep on, accumulating the
-length. */
+length. When there is an output function, and nothing in the buffer has to be
+kept, the buffer is flushed instead; a piece that is still too big is passed
+directly to the function without being copied. */
 
 #define CHECKMEMCPY(from, length_) \
   do {    \
      PCRE2_SIZE chkmc_length = length_; \
+     if (substitute_output != NULL && !hold_output && \
+         lengthleft < chkmc_length) \
+       {  \
+       FLUSHOUTPUT(); \
+       if (lengthleft < chkmc_length) \
+         { \
+         EMITOUTPUT(from, chkmc_length); \
+         break; \
+         } \
+       }  \
      if (overflowed) \
        {  \
        if (chkmc_length > ~(PCRE2_SIZE)0 - extra_needed)  /* Integer overflow */ \
@@ -660,7 +1623,9 @@ length. */
   while (0)
 
 /* This macro checks for space and copies characters with casing modifications.
-On overflow, it behaves as for CHECKMEMCPY().
+On overflow, it behaves as for CHECKMEMCPY(), except that when there is an
+output function and nothing in the buffer has to be kept, the characters are
+transformed one at a time via casetemp, and copied by CHECKMEMCPY().
 
 When substitute_case_callout is NULL, the source and destination buffers must
 not overlap, because our default handler does not support this. */
@@ -686,10 +1651,34 @@ not overlap, because our default handler does not support this. */
 
 #define CHECKCASECPY_DEFAULT(from, length_) \
   CHECKCASECPY_BASE(length_, { \
+    case_state chkcc_state = forcecase; \
     chkcc_rc = default_substitute_case_callout(from, chkcc_length,         \
                                                buffer + buff_offset,       \
                                                overflowed? 0 : lengthleft, \
                                                &forcecase, code);          \
+    if (substitute_output != NULL && !hold_output && chkcc_rc > lengthleft) \
+      { \
+      PCRE2_SPTR chkcc_ptr = from; \
+      PCRE2_SPTR chkcc_end = chkcc_ptr + chkcc_length; \
+      forcecase = chkcc_state; \
+      while (chkcc_ptr < chkcc_end) \
+        { \
+        uint32_t chkcc_ch; \
+        PCRE2_SPTR chkcc_start = chkcc_ptr; \
+        if (forcecase.to_case == PCRE2_SUBSTITUTE_CASE_NONE) \
+          { \
+          CHECKMEMCPY(chkcc_ptr, chkcc_end - chkcc_ptr); \
+          break; \
+          } \
+        GETCHARINCTEST(chkcc_ch, chkcc_ptr); \
+        (void)chkcc_ch; \
+        chkcc_rc = default_substitute_case_callout(chkcc_start, \
+          chkcc_ptr - chkcc_start, casetemp, \
+          sizeof(casetemp)/sizeof(PCRE2_UCHAR), &forcecase, code); \
+        CHECKMEMCPY(casetemp, chkcc_rc); \
+        } \
+      break; \
+      } \
     if (overflowed) \
       { \
       if (chkcc_rc > ~(PCRE2_SIZE)0 - extra_needed)  /* Integer overflow */ \
@@ -737,13 +1726,16 @@ a case-forcing callout. */
   while (0)
 
 
-/* Here's the function */
+/* Here's the function that does the work for pcre2_substitute() and
+pcre2_substitute_compiled(). When rep is not NULL, the replacement has been
+compiled, and replacement and rlength are not used; otherwise the replacement
+is compiled here. */
 
-PCRE2_EXP_DEFN int PCRE2_CALL_CONVENTION
-pcre2_substitute(const pcre2_code *code, PCRE2_SPTR subject, PCRE2_SIZE length,
+static int
+substitute(const pcre2_code *code, PCRE2_SPTR subject, PCRE2_SIZE length,
   PCRE2_SIZE start_offset, uint32_t options, pcre2_match_data *match_data,
   pcre2_match_context *mcontext, PCRE2_SPTR replacement, PCRE2_SIZE rlength,
-  PCRE2_UCHAR *buffer, PCRE2_SIZE *blength)
+  const pcre2_real_replacement *rep, PCRE2_UCHAR *buffer, PCRE2_SIZE *blength)
 {
 int rc;
 int subs;
@@ -758,19 +1750,29 @@ BOOL replacement_only;
 BOOL utf = (code->overall_options & PCRE2_UTF) != 0;
 BOOL partial = (options & (PCRE2_PARTIAL_HARD|PCRE2_PARTIAL_SOFT)) != 0;
 PCRE2_UCHAR temp[6];
+PCRE2_UCHAR casetemp[6];
 PCRE2_UCHAR null_str[1] = { 0xcd };
 PCRE2_SPTR original_subject = subject;
-PCRE2_SPTR ptr;
-PCRE2_SPTR repend = NULL;
+BOOL hold_output = FALSE;
 PCRE2_SIZE extra_needed = 0;
+PCRE2_SIZE output_total = 0;
+PCRE2_SIZE litlength = 0;
 PCRE2_SIZE buff_offset, buff_length, lengthleft, fraglength;
 PCRE2_SIZE *ovector;
 PCRE2_SIZE ovecsave[2] = { 0, 0 };
 pcre2_substitute_callout_block scb;
 PCRE2_SIZE sub_start_extra_needed;
+const replacement_item *item = NULL;
+pcre2_real_replacement *internal_rep = NULL;
+union {
+  pcre2_real_replacement rep;
+  uint8_t vector[REPLACEMENT_STACK_SIZE];
+  } stack_replacement;
 PCRE2_SIZE (*substitute_case_callout)(PCRE2_SPTR, PCRE2_SIZE, PCRE2_UCHAR *,
                                       PCRE2_SIZE, int, void *) = NULL;
 void *substitute_case_callout_data = NULL;
+int (*substitute_output)(PCRE2_SPTR, PCRE2_SIZE, void *) = NULL;
+void *substitute_output_data = NULL;
 
 /* General initialization */
 
@@ -782,6 +1784,8 @@ if (mcontext != NULL)
   {
   substitute_case_callout = mcontext->substitute_case_callout;
   substitute_case_callout_data = mcontext->substitute_case_callout_data;
+  substitute_output = mcontext->substitute_output;
+  substitute_output_data = mcontext->substitute_output_data;
   }
 
 /* Partial matching is supported, with limitations. We allow matching in partial
@@ -796,18 +1800,32 @@ offset in the replacement. */
 if (partial && (options & PCRE2_SUBSTITUTE_REPLACEMENT_ONLY) == 0)
   return PCRE2_ERROR_BADOPTION;
 
+/* When there is an output function, the output is passed to it as it is
+created, so computing the length of a buffer that would be needed makes no
+sense. */
+
+if (substitute_output != NULL &&
+    (options & PCRE2_SUBSTITUTE_OVERFLOW_LENGTH) != 0)
+  return PCRE2_ERROR_BADOPTION;
+
+/* The replacement may refer to captured substrings, so they must be kept. */
+
+if ((options & PCRE2_NO_CAPTURES) != 0) return PCRE2_ERROR_BADOPTION;
+
 /* Validate length and find the end of the replacement. A NULL replacement of
 zero length is interpreted as an empty string. */
 
-if (replacement == NULL)
-  {
-  if (rlength != 0) return PCRE2_ERROR_NULL;
-  replacement = null_str;
+if (rep == NULL)
+  {
+  if (replacement == NULL)
+    {
+    if (rlength != 0) return PCRE2_ERROR_NULL;
+    replacement = null_str;
+    }
+
+  if (rlength == PCRE2_ZERO_TERMINATED) rlength = PRIV(strlen)(replacement);
   }
 
-if (rlength == PCRE2_ZERO_TERMINATED) rlength = PRIV(strlen)(replacement);
-repend = replacement + rlength;
-
 /* A NULL subject of zero length is treated as an empty string. */
 
 if (subject == NULL)
@@ -932,10 +1950,11 @@ scb.input = subject;
 scb.output = (PCRE2_SPTR)buffer;
 scb.ovector = ovector;
 
-/* Check UTF replacement string if necessary. */
+/* Check UTF replacement string if necessary. A compiled replacement was
+checked when it was compiled. */
 
 #ifdef SUPPORT_UNICODE
-if (utf && (options & PCRE2_NO_UTF_CHECK) == 0)
+if (utf && rep == NULL && (options & PCRE2_NO_UTF_CHECK) == 0)
   {
   rc = PRIV(valid_utf)(replacement, rlength, &(match_data->startchar));
   if (rc != 0)
@@ -960,6 +1979,20 @@ if (start_offset > length)
   goto EXIT;
   }
 
+/* For a plain literal pattern, matches after the first are found by a simple
+search, unless there are options that restrict where it may match, or unless
+the matches are being profiled, which needs every match to be found by
+pcre2_match(). */
+
+if ((code->flags & PCRE2_LITERALPAT) != 0 &&
+#ifdef SUPPORT_PROFILE
+    (mcontext == NULL ||
+      ((pcre2_real_match_context *)mcontext)->profile_size == 0) &&
+#endif
+    (options & (PCRE2_ANCHORED|PCRE2_ENDANCHORED|PCRE2_PARTIAL_HARD|
+      PCRE2_PARTIAL_SOFT)) == 0)
+  litlength = literal_length(code);
+
 /* Copy up to the start offset, unless only the replacement is required. */
 
 if (!replacement_only) CHECKMEMCPY(subject, start_offset);
@@ -970,8 +2003,10 @@ match is taken from the match_data that was passed in. */
 subs = 0;
 for (;;)
   {
-  PCRE2_SPTR ptrstack[PTR_STACK_SIZE];
-  uint32_t ptrstackptr = 0;
+  const replacement_item *itemend;
+  const replacement_item *itemstack[PTR_STACK_SIZE];
+  uint32_t itemstackptr = 0;
+  int program;
   case_state forcecase = { PCRE2_SUBSTITUTE_CASE_NONE, FALSE };
   PCRE2_SIZE casestart_offset = 0;
   PCRE2_SIZE casestart_extra_needed = 0;
@@ -981,6 +2016,9 @@ for (;;)
     rc = match_data->rc;
     use_existing_match = FALSE;
     }
+  else if (litlength > 0 && subs > 0 && goptions == 0)
+    rc = literal_match(code, subject, length, start_offset, litlength,
+      match_data);
   else rc = pcre2_match(code, subject, length, start_offset, options|goptions,
     match_data, mcontext);
 
@@ -1043,593 +2081,293 @@ for (;;)
   if (rc == 0) rc = ovector_count;
   fraglength = ovector[0] - start_offset;
   if (!replacement_only) CHECKMEMCPY(subject + start_offset, fraglength);
+
+  /* When there is an output function, the buffer may be flushed when it is
+  full, except that if there is a substitute callout, the whole of the new
+  text must be in the buffer when it is called, and if there is a case
+  callout, case forcing is done in place after the text has been collected.
+  In these cases the buffer is emptied before the new text is started. */
+
+  hold_output = substitute_output != NULL &&
+    (mcontext->substitute_callout != NULL || substitute_case_callout != NULL);
+  if (hold_output)
+    {
+    hold_output = FALSE;
+    FLUSHOUTPUT();
+    hold_output = TRUE;
+    }
+
   scb.output_offsets[0] = buff_offset;
   scb.oveccount = rc;
   sub_start_extra_needed = extra_needed;
 
-  /* Process the replacement string. If the entire replacement is literal, just
-  copy it with length check. */
+  /* A replacement string is compiled when the first match is found, in a
+  vector on the stack if it is small enough. Errors in the replacement are
+  compiled as error items, so they are given only when a substitution reaches
+  them, and a replacement that is never used is never faulted. */
 
-  ptr = replacement;
-  if ((suboptions & PCRE2_SUBSTITUTE_LITERAL) != 0)
+  if (rep == NULL)
     {
-    CHECKMEMCPY(ptr, rlength);
+    replacement_block rb;
+    rep = internal_rep = compile_replacement(&rb,
+      (const pcre2_real_code *)code, replacement, rlength, suboptions,
+      (mcontext == NULL)? &(((pcre2_real_code *)code)->memctl) :
+        &(((pcre2_real_match_context *)mcontext)->memctl),
+      &stack_replacement, sizeof(stack_replacement));
+    if (rep == NULL)
+      {
+      rc = rb.error;
+      goto EXIT;
+      }
     }
 
-  /* Within a non-literal replacement, which must be scanned character by
-  character, local literal mode can be set by \Q, but only in extended mode
-  when backslashes are being interpreted. In extended mode we must handle
-  nested substrings that are to be reprocessed. */
+  /* Process the replacement. A compiled replacement is a sequence of items.
+  Each conditional item is followed by the items of its two texts; the one that
+  is used is processed with the position after the conditional and the current
+  end saved on a stack. */
 
-  else for (;;)
+  program = escaped_literal? 1 : 0;
+  item = rep->items + rep->program_start[program];
+  itemend = item + rep->program_items[program];
+  escaped_literal = rep->ends_literal[program];
+
+  for (;;)
     {
-    uint32_t ch;
-    unsigned int chlen;
     int group;
-    uint32_t special;
-    PCRE2_SPTR text1_start = NULL;
-    PCRE2_SPTR text1_end = NULL;
-    PCRE2_SPTR text2_start = NULL;
-    PCRE2_SPTR text2_end = NULL;
-    PCRE2_UCHAR name[MAX_NAME_SIZE + 1];
+    PCRE2_SIZE sublength;
+    PCRE2_SPTR subptr = NULL;
+    PCRE2_SPTR subptrend = NULL;
+    const replacement_item *next = item + 1;
 
-    /* If at the end of a nested substring, pop the stack. */
+    /* If at the end of a conditional text, pop the stack. */
 
-    if (ptr >= repend)
+    if (item >= itemend)
       {
-      if (ptrstackptr == 0) break;       /* End of replacement string */
-      repend = ptrstack[--ptrstackptr];
-      ptr = ptrstack[--ptrstackptr];
+      if (itemstackptr == 0) break;       /* End of replacement */
+      itemend = itemstack[--itemstackptr];
+      item = itemstack[--itemstackptr];
       continue;
       }
 
-    /* Handle the next character */
-
-    if (escaped_literal)
-      {
-      if (ptr[0] == CHAR_BACKSLASH && ptr < repend - 1 && ptr[1] == CHAR_E)
-        {
-        escaped_literal = FALSE;
-        ptr += 2;
-        continue;
-        }
-      goto LOADLITERAL;
-      }
-
-    /* Not in literal mode. */
-
-    if (*ptr == CHAR_DOLLAR_SIGN)
+    switch (item->type)
       {
-      BOOL inparens;
-      BOOL inangle;
-      BOOL star;
-      PCRE2_SIZE sublength;
-      PCRE2_UCHAR next;
-      PCRE2_SPTR subptr, subptrend;
-
-      if (++ptr >= repend) goto BAD;
-      if ((next = *ptr) == CHAR_DOLLAR_SIGN) goto LOADLITERAL;
-
-      special = 0;
-      text1_start = NULL;
-      text1_end = NULL;
-      text2_start = NULL;
-      text2_end = NULL;
-      group = -1;
-      inparens = FALSE;
-      inangle = FALSE;
-      star = FALSE;
-      subptr = NULL;
-      subptrend = NULL;
-
-      /* Special $ sequences, as supported by Perl, JavaScript, .NET and others. */
-      if (next == CHAR_AMPERSAND)
-        {
-        ++ptr;
-        group = 0;
-        goto GROUP_SUBSTITUTE;
-        }
-      if (next == CHAR_GRAVE_ACCENT || next == CHAR_APOSTROPHE)
+      case REPL_LITERAL:
+      subptr = rep->literals + item->start;
+      subptrend = subptr + item->length;
+
+      /* A run is copied character by character, as when the replacement is
+      interpreted, if case forcing is done here, or if it does not fit and
+      there is no output function. This keeps overflow and length
+      computations the same. */
+
+      if (!overflowed &&
+          ((forcecase.to_case != PCRE2_SUBSTITUTE_CASE_NONE &&
+            substitute_case_callout == NULL) ||
+           (item->length > lengthleft && substitute_output == NULL)))
         {
-        ++ptr;
-
-        /* (Sanity-check ovector before reading from it.) */
-        rc = pcre2_substring_length_bynumber(match_data, 0, &sublength);
-        /* LCOV_EXCL_START */
-        if (rc < 0)
+        while (subptr < subptrend)
           {
-          PCRE2_DEBUG_UNREACHABLE();
-          goto PTREXIT;
-          }
-        /* LCOV_EXCL_STOP */
+          uint32_t ch;
+          PCRE2_SPTR ch_start = subptr;
 
-        if (next == CHAR_GRAVE_ACCENT)
-          {
-          subptr = subject;
-          subptrend = subject + ovector[0];
-          }
-        else
-          {
-          if (partial)
-            {
-            rc = PCRE2_ERROR_PARTIALSUBS;
-            goto PTREXIT;
-            }
+          GETCHARINCTEST(ch, subptr);
+          (void) ch;
 
-          subptr = subject + ovector[1];
-          subptrend = subject + length;
+          if (forcecase.to_case != PCRE2_SUBSTITUTE_CASE_NONE &&
+              substitute_case_callout == NULL)
+            CHECKCASECPY_DEFAULT(ch_start, subptr - ch_start);
+          else
+            CHECKMEMCPY(ch_start, subptr - ch_start);
           }
-
-        goto SUBPTR_SUBSTITUTE;
+        subptr = NULL;
         }
-      if (next == CHAR_UNDERSCORE)
-        {
-        /* Java, .NET support $_ for "entire input string". */
-        ++ptr;
+      break;
 
-        if (partial)
-          {
-          rc = PCRE2_ERROR_PARTIALSUBS;
-          goto PTREXIT;
-          }
+      case REPL_CASE:
+      if (substitute_case_callout != NULL &&
+          forcecase.to_case != PCRE2_SUBSTITUTE_CASE_NONE)
+        DELAYEDFORCECASE();
 
-        subptr = subject;
-        subptrend = subject + length;
-        goto SUBPTR_SUBSTITUTE;
-        }
-      if (next == CHAR_PLUS &&
-          !(ptr+1 < repend && ptr[1] == CHAR_LEFT_CURLY_BRACKET))
+      forcecase.to_case = item->to_case;
+      forcecase.single_char = item->single_char;
+      casestart_offset = buff_offset;
+      casestart_extra_needed = extra_needed;
+      break;
+
+      case REPL_MARK:
         {
-        /* Perl supports $+ for "highest captured group" (not the same as $^N
-        which is mainly only useful inside Perl's match callbacks). We also
-        don't accept "$+{..." since that's Perl syntax for our ${name}. */
-        ++ptr;
-        if (code->top_bracket == 0)
-          {
-          /* Treat either as "no such group" or "all groups unset" based on the
-          PCRE2_SUBSTITUTE_UNKNOWN_UNSET option. */
-          if ((suboptions & PCRE2_SUBSTITUTE_UNKNOWN_UNSET) == 0)
-            {
-            rc = PCRE2_ERROR_NOSUBSTRING;
-            goto PTREXIT;
-            }
-          group = 0;
-          }
-        else
-          {
-          /* If we have any capture groups, then the ovector needs to be large
-          enough for all of them, or the result won't be accurate. */
-          if (match_data->oveccount < code->top_bracket + 1)
-            {
-            rc = PCRE2_ERROR_UNAVAILABLE;
-            goto PTREXIT;
-            }
-          for (group = code->top_bracket; group > 0; group--)
-            if (ovector[2*group] != PCRE2_UNSET) break;
-          }
-        if (group == 0)
+        PCRE2_SPTR mark = pcre2_get_mark(match_data);
+        if (mark != NULL)
           {
-          if ((suboptions & PCRE2_SUBSTITUTE_UNSET_EMPTY) != 0) continue;
-          rc = PCRE2_ERROR_UNSET;
-          goto PTREXIT;
+          subptr = mark;
+          subptrend = mark + mark[-1];
           }
-        goto GROUP_SUBSTITUTE;
         }
+      break;
 
-      if (next == CHAR_LEFT_CURLY_BRACKET)
+      case REPL_BEFORE:
+      case REPL_AFTER:
+      /* (Sanity-check ovector before reading from it.) */
+      rc = pcre2_substring_length_bynumber(match_data, 0, &sublength);
+      /* LCOV_EXCL_START */
+      if (rc < 0)
         {
-        if (++ptr >= repend) goto BAD;
-        next = *ptr;
-        inparens = TRUE;
-        }
-      else if (next == CHAR_LESS_THAN_SIGN)
-        {
-        /* JavaScript compatibility syntax, $<name>. Processes only named
-        groups (not numbered) and does not support extensions such as star
-        (you can do ${name} and ${*name}, but not $<*name>). */
-        if (++ptr >= repend) goto BAD;
-        next = *ptr;
-        inangle = TRUE;
+        PCRE2_DEBUG_UNREACHABLE();
+        goto ITEMEXIT;
         }
+      /* LCOV_EXCL_STOP */
 
-      if (!inangle && next == CHAR_ASTERISK)
+      if (item->type == REPL_BEFORE)
         {
-        if (++ptr >= repend) goto BAD;
-        next = *ptr;
-        star = TRUE;
+        subptr = subject;
+        subptrend = subject + ovector[0];
         }
-
-      if (!star && !inangle && next >= CHAR_0 && next <= CHAR_9)
+      else
         {
-        group = next - CHAR_0;
-        while (++ptr < repend)
+        if (partial)
           {
-          next = *ptr;
-          if (next < CHAR_0 || next > CHAR_9) break;
-          group = group * 10 + (next - CHAR_0);
-
-          /* A check for a number greater than the hightest captured group
-          is sufficient here; no need for a separate overflow check. If unknown
-          groups are to be treated as unset, just skip over any remaining
-          digits and carry on. */
-
-          if (group > code->top_bracket)
-            {
-            if ((suboptions & PCRE2_SUBSTITUTE_UNKNOWN_UNSET) != 0)
-              {
-              while (++ptr < repend && *ptr >= CHAR_0 && *ptr <= CHAR_9);
-              break;
-              }
-            else
-              {
-              rc = PCRE2_ERROR_NOSUBSTRING;
-              goto PTREXIT;
-              }
-            }
+          rc = PCRE2_ERROR_PARTIALSUBS;
+          goto ITEMEXIT;
           }
+        subptr = subject + ovector[1];
+        subptrend = subject + length;
         }
-      else
+      break;
+
+      case REPL_SUBJECT:
+      if (partial)
         {
-        PCRE2_SIZE name_len;
-        PCRE2_SPTR name_start = ptr;
-        if (!read_name_subst(&ptr, repend, utf, code->tables + ctypes_offset))
-          goto BAD;
-        name_len = ptr - name_start;
-        memcpy(name, name_start, CU2BYTES(name_len));
-        name[name_len] = 0;
+        rc = PCRE2_ERROR_PARTIALSUBS;
+        goto ITEMEXIT;
         }
+      subptr = subject;
+      subptrend = subject + length;
+      break;
 
-      next = 0; /* not used or updated after this point */
-      (void)next;
-
-      /* In extended mode we recognize ${name:+set text:unset text} and
-      ${name:-default text}. */
-
-      if (inparens)
+      case REPL_LAST:
+      group = 0;     /* No groups is a compile error unless UNKNOWN_UNSET */
+      if (code->top_bracket != 0)
         {
-        if ((suboptions & PCRE2_SUBSTITUTE_EXTENDED) != 0 &&
-             !star && ptr < repend - 2 && *ptr == CHAR_COLON)
-          {
-          special = *(++ptr);
-          if (special != CHAR_PLUS && special != CHAR_MINUS)
-            {
-            rc = PCRE2_ERROR_BADSUBSTITUTION;
-            goto PTREXIT;
-            }
-
-          text1_start = ++ptr;
-          rc = find_text_end(code, &ptr, repend, special == CHAR_MINUS);
-          if (rc != 0) goto PTREXIT;
-          text1_end = ptr;
-
-          if (special == CHAR_PLUS && *ptr == CHAR_COLON)
-            {
-            text2_start = ++ptr;
-            rc = find_text_end(code, &ptr, repend, TRUE);
-            if (rc != 0) goto PTREXIT;
-            text2_end = ptr;
-            }
-          }
-
-        else
+        if (match_data->oveccount < code->top_bracket + 1)
           {
-          if (ptr >= repend || *ptr != CHAR_RIGHT_CURLY_BRACKET)
-            {
-            rc = PCRE2_ERROR_REPMISSINGBRACE;
-            goto PTREXIT;
-            }
+          rc = PCRE2_ERROR_UNAVAILABLE;
+          goto ITEMEXIT;
           }
-
-        ptr++;
+        for (group = code->top_bracket; group > 0; group--)
+          if (ovector[2*group] != PCRE2_UNSET) break;
         }
-
-      if (inangle)
+      if (group == 0)
         {
-        if (ptr >= repend || *ptr != CHAR_GREATER_THAN_SIGN)
-          goto BAD;
-        ptr++;
+        if ((suboptions & PCRE2_SUBSTITUTE_UNSET_EMPTY) != 0) break;
+        rc = PCRE2_ERROR_UNSET;
+        goto ITEMEXIT;
         }
+      subptr = subject + ovector[group*2];
+      subptrend = subject + ovector[group*2 + 1];
+      break;
 
-      /* Have found a syntactically correct group number or name, or *name.
-      Only *MARK is currently recognized. */
-
-      if (star)
-        {
-        if (PRIV(strcmp_c8)(name, STRING_MARK) == 0)
-          {
-          PCRE2_SPTR mark = pcre2_get_mark(match_data);
-          if (mark != NULL)
-            {
-            /* Peek backwards one code unit to obtain the length of the mark.
-            It can (theoretically) contain an embedded NUL. */
-            fraglength = mark[-1];
-            if (forcecase.to_case != PCRE2_SUBSTITUTE_CASE_NONE &&
-                substitute_case_callout == NULL)
-              CHECKCASECPY_DEFAULT(mark, fraglength);
-            else
-              CHECKMEMCPY(mark, fraglength);
-            }
-          }
-        else goto BAD;
-        }
+      case REPL_GROUP:
+      case REPL_COND:
 
-      /* Substitute the contents of a group. We don't use substring_copy
-      functions any more, in order to support case forcing. */
+      /* For a duplicate name, choose the first group that is set. */
 
-      else
+      if (item->group_count == 0) group = item->group; else
         {
-        GROUP_SUBSTITUTE:
-        /* Find a number for a named group. In case there are duplicate names,
-        search for the first one that is set. If the name is not found when
-        PCRE2_SUBSTITUTE_UNKNOWN_EMPTY is set, set the group number to a
-        non-existent group. */
+        const uint32_t *groups = rep->groups + item->group;
+        uint32_t i;
 
-        if (group < 0)
+        group = -1;
+        for (i = 0; i < item->group_count; i++)
           {
-          PCRE2_SPTR first, last, entry;
-          rc = pcre2_substring_nametable_scan(code, name, &first, &last);
-          if (rc == PCRE2_ERROR_NOSUBSTRING &&
-              (suboptions & PCRE2_SUBSTITUTE_UNKNOWN_UNSET) != 0)
-            {
-            group = code->top_bracket + 1;
-            }
-          else
+          uint32_t ng = groups[i];
+          if (ng < ovector_count)
             {
-            if (rc < 0) goto PTREXIT;
-            for (entry = first; entry <= last; entry += rc)
+            if (group < 0) group = ng;          /* First in ovector */
+            if (ovector[ng*2] != PCRE2_UNSET)
               {
-              uint32_t ng = GET2(entry, 0);
-              if (ng < ovector_count)
-                {
-                if (group < 0) group = ng;          /* First in ovector */
-                if (ovector[ng*2] != PCRE2_UNSET)
-                  {
-                  group = ng;                       /* First that is set */
-                  break;
-                  }
-                }
+              group = ng;                       /* First that is set */
+              break;
               }
-
-            /* If group is still negative, it means we did not find a group
-            that is in the ovector. Just set the first group. */
-
-            if (group < 0) group = GET2(first, 0);
-            }
-          }
-
-        /* We now have a group that is identified by number. Find the length of
-        the captured string. If a group in a non-special substitution is unset
-        when PCRE2_SUBSTITUTE_UNSET_EMPTY is set, substitute nothing. */
-
-        rc = pcre2_substring_length_bynumber(match_data, group, &sublength);
-        if (rc < 0)
-          {
-          if (rc == PCRE2_ERROR_NOSUBSTRING &&
-              (suboptions & PCRE2_SUBSTITUTE_UNKNOWN_UNSET) != 0)
-            {
-            rc = PCRE2_ERROR_UNSET;
-            }
-          if (rc != PCRE2_ERROR_UNSET) goto PTREXIT;  /* Non-unset errors */
-          if (special == 0)                           /* Plain substitution */
-            {
-            if ((suboptions & PCRE2_SUBSTITUTE_UNSET_EMPTY) != 0) continue;
-            goto PTREXIT;                             /* Else error */
-            }
-          }
-
-        /* If special is '+' we have a 'set' and possibly an 'unset' text,
-        both of which are reprocessed when used. If special is '-' we have a
-        default text for when the group is unset; it must be reprocessed. */
-
-        if (special != 0)
-          {
-          if (special == CHAR_MINUS)
-            {
-            if (rc == 0) goto LITERAL_SUBSTITUTE;
-            text2_start = text1_start;
-            text2_end = text1_end;
-            }
-
-          if (ptrstackptr >= PTR_STACK_SIZE) goto BAD;
-          ptrstack[ptrstackptr++] = ptr;
-          ptrstack[ptrstackptr++] = repend;
-
-          if (rc == 0)
-            {
-            ptr = text1_start;
-            repend = text1_end;
-            }
-          else
-            {
-            ptr = text2_start;
-            repend = text2_end;
             }
-          continue;
           }
-
-        /* Otherwise we have a literal substitution of a group's contents. */
-
-        LITERAL_SUBSTITUTE:
-        subptr = subject + ovector[group*2];
-        subptrend = subject + ovector[group*2 + 1];
-
-        /* Substitute a literal string, possibly forcing alphabetic case. */
-
-        SUBPTR_SUBSTITUTE:
-        if (forcecase.to_case != PCRE2_SUBSTITUTE_CASE_NONE &&
-            substitute_case_callout == NULL)
-          CHECKCASECPY_DEFAULT(subptr, subptrend - subptr);
-        else
-          CHECKMEMCPY(subptr, subptrend - subptr);
+        if (group < 0) group = groups[0];
         }
-      }   /* End of $ processing */
-
-    /* Handle an escape sequence in extended mode. We can use check_escape()
-    to process \Q, \E, \c, \o, \x and \ followed by non-alphanumerics, but
-    the case-forcing escapes are not supported in pcre2_compile() so must be
-    recognized here. */
-
-    else if ((suboptions & PCRE2_SUBSTITUTE_EXTENDED) != 0 &&
-              *ptr == CHAR_BACKSLASH)
-      {
-      int errorcode;
-      case_state new_forcecase = { PCRE2_SUBSTITUTE_CASE_NONE, FALSE };
 
-      if (ptr < repend - 1) switch (ptr[1])
+      rc = pcre2_substring_length_bynumber(match_data, group, &sublength);
+      if (rc < 0)
         {
-        case CHAR_L:
-        new_forcecase.to_case = PCRE2_SUBSTITUTE_CASE_LOWER;
-        new_forcecase.single_char = FALSE;
-        ptr += 2;
-        break;
-
-        case CHAR_l:
-        new_forcecase.to_case = PCRE2_SUBSTITUTE_CASE_LOWER;
-        new_forcecase.single_char = TRUE;
-        ptr += 2;
-        if (ptr + 2 < repend && ptr[0] == CHAR_BACKSLASH && ptr[1] == CHAR_U)
+        if (rc == PCRE2_ERROR_NOSUBSTRING &&
+            (suboptions & PCRE2_SUBSTITUTE_UNKNOWN_UNSET) != 0)
           {
-          /* Perl reverse-title-casing feature for \l\U */
-          new_forcecase.to_case = PCRE2_SUBSTITUTE_CASE_REVERSE_TITLE_FIRST;
-          new_forcecase.single_char = FALSE;
-          ptr += 2;
+          rc = PCRE2_ERROR_UNSET;
           }
-        break;
-
-        case CHAR_U:
-        new_forcecase.to_case = PCRE2_SUBSTITUTE_CASE_UPPER;
-        new_forcecase.single_char = FALSE;
-        ptr += 2;
-        break;
-
-        case CHAR_u:
-        new_forcecase.to_case = PCRE2_SUBSTITUTE_CASE_TITLE_FIRST;
-        new_forcecase.single_char = TRUE;
-        ptr += 2;
-        if (ptr + 2 < repend && ptr[0] == CHAR_BACKSLASH && ptr[1] == CHAR_L)
+        if (rc != PCRE2_ERROR_UNSET) goto ITEMEXIT;  /* Non-unset errors */
+        if (item->type == REPL_GROUP)                /* Plain substitution */
           {
-          /* Perl title-casing feature for \u\L */
-          new_forcecase.to_case = PCRE2_SUBSTITUTE_CASE_TITLE_FIRST;
-          new_forcecase.single_char = FALSE;
-          ptr += 2;
+          if ((suboptions & PCRE2_SUBSTITUTE_UNSET_EMPTY) != 0) break;
+          goto ITEMEXIT;                             /* Else error */
           }
-        break;
-
-        default:
-        break;
-        }
-
-      if (new_forcecase.to_case != PCRE2_SUBSTITUTE_CASE_NONE)
-        {
-        SETFORCECASE:
-
-        /* If the substitute_case_callout is unset, our case-forcing is done
-        immediately. If there is a callout however, then its action is delayed
-        until all the characters have been collected.
-
-        Apply the callout now, before we set the new casing mode. */
-
-        if (substitute_case_callout != NULL &&
-            forcecase.to_case != PCRE2_SUBSTITUTE_CASE_NONE)
-          DELAYEDFORCECASE();
-
-        forcecase = new_forcecase;
-        casestart_offset = buff_offset;
-        casestart_extra_needed = extra_needed;
-        continue;
         }
 
-      ptr++;  /* Point after \ */
-      rc = PRIV(check_escape)(&ptr, repend, &ch, &errorcode,
-        code->overall_options, code->extra_options, code->top_bracket, FALSE, NULL);
-      if (errorcode != 0) goto BADESCAPE;
-
-      switch(rc)
+      if (item->type == REPL_COND)
         {
-        case ESC_E:
-        goto SETFORCECASE;
-
-        case ESC_Q:
-        escaped_literal = TRUE;
-        continue;
-
-        case 0:      /* Data character */
-        case ESC_b:  /* \b is backspace in a substitution */
-        case ESC_v:  /* \v is vertical tab in a substitution */
+        const replacement_item *text1 = item + 1;
+        const replacement_item *text2 = text1 + item->text1_items;
 
-        if (rc == ESC_b) ch = CHAR_BS;
-        if (rc == ESC_v) ch = CHAR_VT;
+        next = text2 + item->text2_items;
+        if (item->special == CHAR_MINUS && rc == 0) goto GROUPCOPY;
 
-#ifdef SUPPORT_UNICODE
-        if (utf) chlen = PRIV(ord2utf)(ch, temp); else
-#endif
+        if (itemstackptr >= PTR_STACK_SIZE)
           {
-          temp[0] = ch;
-          chlen = 1;
+          rc = PCRE2_ERROR_BADREPLACEMENT;
+          goto ITEMEXIT;
           }
+        itemstack[itemstackptr++] = next;
+        itemstack[itemstackptr++] = itemend;
 
-        if (forcecase.to_case != PCRE2_SUBSTITUTE_CASE_NONE &&
-            substitute_case_callout == NULL)
-          CHECKCASECPY_DEFAULT(temp, chlen);
-        else
-          CHECKMEMCPY(temp, chlen);
-        continue;
-
-        case ESC_g:
+        if (item->special == CHAR_MINUS || rc == 0)
           {
-          PCRE2_SIZE name_len;
-          PCRE2_SPTR name_start;
-
-          /* Parse the \g<name> form (\g<number> already handled by check_escape) */
-          if (ptr >= repend || *ptr != CHAR_LESS_THAN_SIGN)
-            goto BADESCAPE;
-          ++ptr;
-
-          name_start = ptr;
-          if (!read_name_subst(&ptr, repend, utf, code->tables + ctypes_offset))
-            goto BADESCAPE;
-          name_len = ptr - name_start;
-
-          if (ptr >= repend || *ptr != CHAR_GREATER_THAN_SIGN)
-            goto BADESCAPE;
-          ++ptr;
-
-          special = 0;
-          group = -1;
-          memcpy(name, name_start, CU2BYTES(name_len));
-          name[name_len] = 0;
-          goto GROUP_SUBSTITUTE;
+          item = text1;
+          itemend = text2;
           }
-
-        default:
-        if (rc < 0)
+        else
           {
-          special = 0;
-          group = -rc - 1;
-          goto GROUP_SUBSTITUTE;
+          item = text2;
+          itemend = next;
           }
-        goto BADESCAPE;
+        continue;
         }
-      }   /* End of backslash processing */
 
-    /* Handle a literal code unit */
+      GROUPCOPY:
+      subptr = subject + ovector[group*2];
+      subptrend = subject + ovector[group*2 + 1];
+      break;
 
-    else
-      {
-      PCRE2_SPTR ch_start;
+      case REPL_ERROR:
+      rc = -(int)item->group;
+      goto ITEMEXIT;
+
+      /* LCOV_EXCL_START */
+      default:
+      PCRE2_DEBUG_UNREACHABLE();
+      break;
+      /* LCOV_EXCL_STOP */
+      }
 
-      LOADLITERAL:
-      ch_start = ptr;
-      GETCHARINCTEST(ch, ptr);    /* Get character value, increment pointer */
-      (void) ch;
+    /* Copy a literal run or substituted string, possibly forcing alphabetic
+    case. */
 
+    if (subptr != NULL)
+      {
       if (forcecase.to_case != PCRE2_SUBSTITUTE_CASE_NONE &&
           substitute_case_callout == NULL)
-        CHECKCASECPY_DEFAULT(ch_start, ptr - ch_start);
+        CHECKCASECPY_DEFAULT(subptr, subptrend - subptr);
       else
-        CHECKMEMCPY(ch_start, ptr - ch_start);
-      } /* End handling a literal code unit */
-    }   /* End of loop for scanning the replacement. */
+        CHECKMEMCPY(subptr, subptrend - subptr);
+      }
+
+    item = next;
+    }
 
   /* If the substitute_case_callout is unset, our case-forcing is done
   immediately. If there is a callout however, then its action is delayed
@@ -1666,6 +2404,7 @@ for (;;)
 
         buff_offset -= newlength;
         lengthleft += newlength;
+        hold_output = FALSE;
         if (!replacement_only) CHECKMEMCPY(subject + ovector[0], oldlength);
 
         /* A negative return means do not do any more. */
@@ -1709,6 +2448,8 @@ for (;;)
       }
     }
 
+  hold_output = FALSE;
+
   /* Exit the global loop if we are not in global mode, or if pcre2_next_match()
   indicates we have reached the end of the subject. */
 
@@ -1730,7 +2471,9 @@ for (;;)
   }  /* End of global loop */
 
 /* Copy the rest of the subject unless not required, and terminate the output
-with a binary zero. */
+with a binary zero. When there is an output function, the remaining output is
+passed to it instead, without a terminating zero, and the total length of the
+output is returned. */
 
 if (!replacement_only)
   {
@@ -1738,6 +2481,14 @@ if (!replacement_only)
   CHECKMEMCPY(subject + start_offset, fraglength);
   }
 
+if (substitute_output != NULL)
+  {
+  FLUSHOUTPUT();
+  rc = subs;
+  *blength = output_total;
+  goto EXIT;
+  }
+
 temp[0] = 0;
 CHECKMEMCPY(temp, 1);
 
@@ -1766,6 +2517,8 @@ else
 EXIT:
 if (internal_match_data != NULL) pcre2_match_data_free(internal_match_data);
   else match_data->rc = rc;
+if (internal_rep != NULL && internal_rep != &stack_replacement.rep)
+  internal_rep->memctl.free(internal_rep, internal_rep->memctl.memory_data);
 return rc;
 
 NOROOM:
@@ -1780,16 +2533,61 @@ TOOLARGEREPLACE:
 rc = PCRE2_ERROR_TOOLARGEREPLACE;
 goto EXIT;
 
-BAD:
-rc = PCRE2_ERROR_BADREPLACEMENT;
-goto PTREXIT;
+ITEMEXIT:
+*blength = item->offset;
+goto EXIT;
+}
 
-BADESCAPE:
-rc = PCRE2_ERROR_BADREPESCAPE;
 
-PTREXIT:
-*blength = (PCRE2_SIZE)(ptr - replacement);
-goto EXIT;
+/* These are the external functions. For pcre2_substitute() the replacement is
+compiled when the first match is found. */
+
+PCRE2_EXP_DEFN int PCRE2_CALL_CONVENTION
+pcre2_substitute(const pcre2_code *code, PCRE2_SPTR subject, PCRE2_SIZE length,
+  PCRE2_SIZE start_offset, uint32_t options, pcre2_match_data *match_data,
+  pcre2_match_context *mcontext, PCRE2_SPTR replacement, PCRE2_SIZE rlength,
+  PCRE2_UCHAR *buffer, PCRE2_SIZE *blength)
+{
+return substitute(code, subject, length, start_offset, options, match_data,
+  mcontext, replacement, rlength, NULL, buffer, blength);
+}
+
+
+/* This function is the same as pcre2_substitute(), except that the
+replacement has been compiled by pcre2_replacement_compile(), which also
+determined the pattern. The options that affect the interpretation of the
+replacement were fixed when it was compiled; any given here are ignored.
+
+Arguments:
+  replacement     points to the compiled replacement
+  subject         points to the subject string
+  length          length of subject string (may contain binary zeros)
+  start_offset    where to start in the subject string
+  options         option bits
+  match_data      points to a match_data block, or is NULL
+  context         points a PCRE2 context
+  buffer          where to put the substituted string
+  blength         points to length of buffer; updated to length of string
+
+Returns:          >= 0 number of substitutions made
+                  < 0 an error code
+*/
+
+PCRE2_EXP_DEFN int PCRE2_CALL_CONVENTION
+pcre2_substitute_compiled(const pcre2_replacement *replacement,
+  PCRE2_SPTR subject, PCRE2_SIZE length, PCRE2_SIZE start_offset,
+  uint32_t options, pcre2_match_data *match_data,
+  pcre2_match_context *mcontext, PCRE2_UCHAR *buffer, PCRE2_SIZE *blength)
+{
+if (replacement == NULL)
+  {
+  *blength = PCRE2_UNSET;
+  return PCRE2_ERROR_NULL;
+  }
+options = (options & ~REPLACEMENT_COMPILE_OPTIONS) | replacement->options;
+return substitute((const pcre2_code *)replacement->code, subject, length,
+  start_offset, options, match_data, mcontext, NULL, 0, replacement, buffer,
+  blength);
 }
 
 /* End of pcre2_substitute.c */
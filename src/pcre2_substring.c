@@ -328,7 +328,8 @@ if (match_data->matchedby != PCRE2_MATCHEDBY_DFA_INTERPRETER)
     return PCRE2_ERROR_NOSUBSTRING;
   if (stringnumber >= match_data->oveccount)
     return PCRE2_ERROR_UNAVAILABLE;
-  if (match_data->ovector[stringnumber*2] == PCRE2_UNSET)
+  if (match_data->ovector[stringnumber*2] == PCRE2_UNSET ||
+      (stringnumber > 0 && (match_data->options & PCRE2_NO_CAPTURES) != 0))
     return PCRE2_ERROR_UNSET;
   }
 else  /* Matched using pcre2_dfa_match() */
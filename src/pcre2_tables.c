@@ -196,6 +196,9 @@ are implementing).
    has to deal with checking for previous adjoining RIs.
 
 9. Otherwise, break everywhere.
+
+The interpreters use a table of state transitions in pcre2_extuni.c that is
+derived from this table and rules 7 and 8; it must be kept in step.
 */
 
 #define ESZ (1<<ucp_gbExtend)|(1<<ucp_gbSpacingMark)|(1<<ucp_gbZWJ)
@@ -72,12 +72,14 @@ compilers barf at that. Instead, just supply some small dummy tables. */
 const ucd_record PRIV(ucd_records)[] = {{0,0,0,0,0,0,0}};
 const uint16_t PRIV(ucd_stage1)[] = {0};
 const uint16_t PRIV(ucd_stage2)[] = {0};
+const uint32_t PRIV(ucd_propbits)[] = {0};
+const uint8_t PRIV(ucd_propbits_ascii)[] = {0};
 const uint32_t PRIV(ucd_caseless_sets)[] = {0};
 const uint32_t PRIV(ucd_nocase_ranges)[] = {0};
 const uint32_t PRIV(ucd_nocase_ranges_size) = 0;
 #else
 
-/* Total size: 116548 bytes, block size: 128. */
+/* Total size: 141668 bytes, block size: 128. */
 
 const char *PRIV(unicode_version) = "17.0.0";
 
@@ -5813,6 +5815,2229 @@ const uint16_t PRIV(ucd_stage2)[] = { /* 80384 bytes, block = 128 */
 1031,1031,1031,1031,1031,1031,1031,1031,1031,1031,1031,1031,1031,1031,1039,1039,
 };
 
+/* This table contains bitsets for some frequently used properties, so that
+they can be tested without looking at a character's record. It is indexed by
+the same block number as ucd_stage2, that is, by the value from ucd_stage1.
+For each block there are UCD_PROPBITS_COUNT bitsets of UCD_BLOCK_SIZE bits,
+in the order of the UCD_PROPBITS_xxx values in pcre2_internal.h. */
+
+const uint32_t PRIV(ucd_propbits)[] = { /* 25120 bytes */
+
+/* block 0 */
+  0x00000000u, 0x00000000u, 0x07fffffeu, 0x07fffffeu, /* L */
+  0x00000000u, 0x03ff0000u, 0x00000000u, 0x00000000u, /* Nd */
+  0x00000000u, 0x03ff0000u, 0x07fffffeu, 0x07fffffeu, /* Alnum */
+  0x00003e00u, 0x00000001u, 0x00000000u, 0x00000000u, /* Space */
+  0x00000000u, 0x03ff0000u, 0x87fffffeu, 0x07fffffeu, /* Word */
+
+/* block 1 */
+  0x00000000u, 0x04200400u, 0xff7fffffu, 0xff7fffffu, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0x00000000u, 0x762c0400u, 0xff7fffffu, 0xff7fffffu, /* Alnum */
+  0x00000020u, 0x00000001u, 0x00000000u, 0x00000000u, /* Space */
+  0x00000000u, 0x762c0400u, 0xff7fffffu, 0xff7fffffu, /* Word */
+
+/* block 2 */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu, /* Word */
+
+/* block 3 */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu, /* Word */
+
+/* block 4 */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu, /* Word */
+
+/* block 5 */
+  0xffffffffu, 0xffffffffu, 0x0003ffc3u, 0x0000501fu, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0xffffffffu, 0xffffffffu, 0x0003ffc3u, 0x0000501fu, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xffffffffu, 0xffffffffu, 0x0003ffc3u, 0x0000501fu, /* Word */
+
+/* block 6 */
+  0x00000000u, 0x00000000u, 0x00000000u, 0xbcdf0000u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0x00000000u, 0x00000000u, 0x00000000u, 0xbcdf0000u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0xbcdfffffu, /* Word */
+
+/* block 7 */
+  0xffffd740u, 0xfffffffbu, 0xffffffffu, 0xffbfffffu, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0xffffd740u, 0xfffffffbu, 0xffffffffu, 0xffbfffffu, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xffffd740u, 0xfffffffbu, 0xffffffffu, 0xffbfffffu, /* Word */
+
+/* block 8 */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu, /* Word */
+
+/* block 9 */
+  0xfffffc03u, 0xffffffffu, 0xffffffffu, 0xffffffffu, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0xfffffc03u, 0xffffffffu, 0xffffffffu, 0xffffffffu, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xfffffcfbu, 0xffffffffu, 0xffffffffu, 0xffffffffu, /* Word */
+
+/* block 10 */
+  0xffffffffu, 0xfffeffffu, 0x027fffffu, 0xffffffffu, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0xffffffffu, 0xfffeffffu, 0x027fffffu, 0xffffffffu, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xffffffffu, 0xfffeffffu, 0x027fffffu, 0xffffffffu, /* Word */
+
+/* block 11 */
+  0x000001ffu, 0x00000000u, 0xffff0000u, 0x000787ffu, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0x000001ffu, 0x00000000u, 0xffff0000u, 0x000787ffu, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xfffe01ffu, 0xbfffffffu, 0xffff00b6u, 0x000787ffu, /* Word */
+
+/* block 12 */
+  0x00000000u, 0xffffffffu, 0x000007ffu, 0xfffec000u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x000003ffu, /* Nd */
+  0x00000000u, 0xffffffffu, 0x000007ffu, 0xfffec3ffu, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0x07ff0000u, 0xffffffffu, 0xffffffffu, 0xffffc3ffu, /* Word */
+
+/* block 13 */
+  0xffffffffu, 0xffffffffu, 0x002fffffu, 0x9c00c060u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x03ff0000u, /* Nd */
+  0xffffffffu, 0xffffffffu, 0x002fffffu, 0x9fffc060u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xffffffffu, 0xffffffffu, 0x9fefffffu, 0x9ffffdffu, /* Word */
+
+/* block 14 */
+  0xfffd0000u, 0x0000ffffu, 0xffffe000u, 0xffffffffu, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0xfffd0000u, 0x0000ffffu, 0xffffe000u, 0xffffffffu, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xffff0000u, 0xffffffffu, 0xffffe7ffu, 0xffffffffu, /* Word */
+
+/* block 15 */
+  0xffffffffu, 0x0002003fu, 0xfffffc00u, 0x043007ffu, /* L */
+  0x00000000u, 0x00000000u, 0x000003ffu, 0x00000000u, /* Nd */
+  0xffffffffu, 0x0002003fu, 0xffffffffu, 0x043007ffu, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xffffffffu, 0x0003ffffu, 0xffffffffu, 0x243fffffu, /* Word */
+
+/* block 16 */
+  0x043fffffu, 0x00000110u, 0x01ffffffu, 0xffff07ffu, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0x043fffffu, 0x00000110u, 0x01ffffffu, 0xffff07ffu, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xffffffffu, 0x00003fffu, 0x0fffffffu, 0xffff07ffu, /* Word */
+
+/* block 17 */
+  0x0000feffu, 0xffffffffu, 0x000003ffu, 0x00000000u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0x0000feffu, 0xffffffffu, 0x000003ffu, 0x00000000u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xff80feffu, 0xffffffffu, 0xffffffffu, 0xfffffffbu, /* Word */
+
+/* block 18 */
+  0xfffffff0u, 0x23ffffffu, 0xff010000u, 0xfffe0003u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x0000ffc0u, /* Nd */
+  0xfffffff0u, 0x23ffffffu, 0xff010000u, 0xfffeffc3u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xfffffff7u, 0x37ffffffu, 0xffff21feu, 0xfffeffcfu, /* Word */
+
+/* block 19 */
+  0xfff99fe1u, 0x23c5fdffu, 0xb0004000u, 0x10030003u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x0000ffc0u, /* Nd */
+  0xfff99fe1u, 0x23c5fdffu, 0xb0004000u, 0x13f3ffc3u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xfff99fe3u, 0x33c5fdffu, 0xb000601eu, 0x53f3ffcfu, /* Word */
+
+/* block 20 */
+  0xfff987e0u, 0x036dfdffu, 0x5e000000u, 0x001c0000u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x0000ffc0u, /* Nd */
+  0xfff987e0u, 0x036dfdffu, 0x5e000000u, 0x001cffc0u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xfff987e6u, 0x136dfdffu, 0x5e023986u, 0x003fffc0u, /* Word */
+
+/* block 21 */
+  0xfffbbfe0u, 0x23edfdffu, 0x00010000u, 0x02000003u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x0000ffc0u, /* Nd */
+  0xfffbbfe0u, 0x23edfdffu, 0x00010000u, 0x0200ffc3u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xfffbbfe6u, 0x33edfdffu, 0x000121beu, 0xfe00ffcfu, /* Word */
+
+/* block 22 */
+  0xfff99fe0u, 0x23edfdffu, 0xb0000000u, 0x00020003u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x0000ffc0u, /* Nd */
+  0xfff99fe0u, 0x23edfdffu, 0xb0000000u, 0x00feffc3u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xfff99fe2u, 0xb3edfdffu, 0xb060201eu, 0x00feffcfu, /* Word */
+
+/* block 23 */
+  0xd63dc7e8u, 0x03ffc718u, 0x00010000u, 0x00000000u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x0000ffc0u, /* Nd */
+  0xd63dc7e8u, 0x03ffc718u, 0x00010000u, 0x0007ffc0u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xd63dc7ecu, 0x03ffc718u, 0x00012001u, 0x0007ffc0u, /* Word */
+
+/* block 24 */
+  0xfffddfe0u, 0x23fffdffu, 0x37000000u, 0x00000003u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x0000ffc0u, /* Nd */
+  0xfffddfe0u, 0x23fffdffu, 0x37000000u, 0x7f00ffc3u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xfffddff1u, 0xf3fffdffu, 0x37603dc1u, 0x7f00ffcfu, /* Word */
+
+/* block 25 */
+  0xfffddfe1u, 0x23effdffu, 0x70000000u, 0x00060003u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x0000ffc0u, /* Nd */
+  0xfffddfe1u, 0x23effdffu, 0x70000000u, 0x0006ffc3u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xfffddfe3u, 0xb3effdffu, 0x70003040u, 0x0006ffcfu, /* Word */
+
+/* block 26 */
+  0xfffddff0u, 0x27ffffffu, 0x80704000u, 0xfc000003u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x0000ffc0u, /* Nd */
+  0xfffddff0u, 0x27ffffffu, 0xff704000u, 0xfdffffc3u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xfffddff3u, 0x3fffffffu, 0xff70601eu, 0xfdffffcfu, /* Word */
+
+/* block 27 */
+  0xfc7fffe0u, 0x2ffbffffu, 0x0000007fu, 0x00000000u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x0000ffc0u, /* Nd */
+  0xfc7fffe0u, 0x2ffbffffu, 0x0000007fu, 0x0000ffc0u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xfc7fffe2u, 0x2ffbffffu, 0x005c047fu, 0x0000ffc0u, /* Word */
+
+/* block 28 */
+  0xfffffffeu, 0x000dffffu, 0x0000007fu, 0x00000000u, /* L */
+  0x00000000u, 0x00000000u, 0x03ff0000u, 0x00000000u, /* Nd */
+  0xfffffffeu, 0x000dffffu, 0x03ff007fu, 0x00000000u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xfffffffeu, 0x07ffffffu, 0x03ff7fffu, 0x00000000u, /* Word */
+
+/* block 29 */
+  0xfffff7d6u, 0x200dffafu, 0xf000005fu, 0x00000000u, /* L */
+  0x00000000u, 0x00000000u, 0x03ff0000u, 0x00000000u, /* Nd */
+  0xfffff7d6u, 0x200dffafu, 0xf3ff005fu, 0x00000000u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xfffff7d6u, 0x3fffffafu, 0xf3ff7f5fu, 0x00000000u, /* Word */
+
+/* block 30 */
+  0x00000001u, 0x00000000u, 0xfffffeffu, 0x00001fffu, /* L */
+  0x00000000u, 0x000003ffu, 0x00000000u, 0x00000000u, /* Nd */
+  0x00000001u, 0x000fffffu, 0xfffffeffu, 0x00001fffu, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0x03000001u, 0x02afffffu, 0xfffffeffu, 0x7ffe1fffu, /* Word */
+
+/* block 31 */
+  0x00001f00u, 0x00000000u, 0x00000000u, 0x00000000u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0x00001f00u, 0x00000000u, 0x00000000u, 0x00000000u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xfeffffdfu, 0x1fffffffu, 0x00000040u, 0x00000000u, /* Word */
+
+/* block 32 */
+  0xffffffffu, 0x800007ffu, 0x3c3f0000u, 0xffe1c062u, /* L */
+  0x00000000u, 0x00000000u, 0x000003ffu, 0x00000000u, /* Nd */
+  0xffffffffu, 0x800007ffu, 0x3c3f03ffu, 0xffe1c062u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xffffffffu, 0xe6fde7ffu, 0xff3f03ffu, 0xffffc063u, /* Word */
+
+/* block 33 */
+  0x00004003u, 0xffffffffu, 0xffff20bfu, 0xf7ffffffu, /* L */
+  0x03ff0000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0x03ff4003u, 0xffffffffu, 0xffff20bfu, 0xf7ffffffu, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0x23ff6067u, 0xffffffffu, 0xffff20bfu, 0xf7ffffffu, /* Word */
+
+/* block 34 */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu, /* Word */
+
+/* block 35 */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu, /* Word */
+
+/* block 36 */
+  0xffffffffu, 0xffffffffu, 0x3d7f3dffu, 0xffffffffu, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0xffffffffu, 0xffffffffu, 0x3d7f3dffu, 0xffffffffu, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xffffffffu, 0xffffffffu, 0x3d7f3dffu, 0xffffffffu, /* Word */
+
+/* block 37 */
+  0xffff3dffu, 0x7f3dffffu, 0xff7fff3du, 0xffffffffu, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0xffff3dffu, 0x7f3dffffu, 0xff7fff3du, 0xffffffffu, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xffff3dffu, 0x7f3dffffu, 0xff7fff3du, 0xffffffffu, /* Word */
+
+/* block 38 */
+  0xff3dffffu, 0xffffffffu, 0x07ffffffu, 0x00000000u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0xff3dffffu, 0xffffffffu, 0x07ffffffu, 0x1ffffe00u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xff3dffffu, 0xffffffffu, 0xe7ffffffu, 0x1ffffe00u, /* Word */
+
+/* block 39 */
+  0x0000ffffu, 0xffffffffu, 0xffffffffu, 0x3f3fffffu, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0x0000ffffu, 0xffffffffu, 0xffffffffu, 0x3f3fffffu, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0x0000ffffu, 0xffffffffu, 0xffffffffu, 0x3f3fffffu, /* Word */
+
+/* block 40 */
+  0xfffffffeu, 0xffffffffu, 0xffffffffu, 0xffffffffu, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0xfffffffeu, 0xffffffffu, 0xffffffffu, 0xffffffffu, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xfffffffeu, 0xffffffffu, 0xffffffffu, 0xffffffffu, /* Word */
+
+/* block 41 */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu, /* Word */
+
+/* block 42 */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffff9fffu, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffff9fffu, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffff9fffu, /* Word */
+
+/* block 43 */
+  0x07fffffeu, 0xffffffffu, 0xffffffffu, 0x01fe07ffu, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0x07fffffeu, 0xffffffffu, 0xffffffffu, 0x01ffc7ffu, /* Alnum */
+  0x00000001u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0x07fffffeu, 0xffffffffu, 0xffffffffu, 0x01ffc7ffu, /* Word */
+
+/* block 44 */
+  0x8003ffffu, 0x0003ffffu, 0x0003ffffu, 0x0001dfffu, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0x8003ffffu, 0x0003ffffu, 0x0003ffffu, 0x0001dfffu, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0x801fffffu, 0x000fffffu, 0x000fffffu, 0x000ddfffu, /* Word */
+
+/* block 45 */
+  0xffffffffu, 0x000fffffu, 0x10800000u, 0x00000000u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x000003ffu, /* Nd */
+  0xffffffffu, 0x000fffffu, 0x10800000u, 0x03ff03ffu, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xffffffffu, 0x3fbfffffu, 0x308ffe40u, 0x03ff03ffu, /* Word */
+
+/* block 46 */
+  0x00000000u, 0xffffffffu, 0xffffffffu, 0x01ffffffu, /* L */
+  0x03ff0000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0x03ff0000u, 0xffffffffu, 0xffffffffu, 0x01ffffffu, /* Alnum */
+  0x00004000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0x03ffb800u, 0xffffffffu, 0xffffffffu, 0x01ffffffu, /* Word */
+
+/* block 47 */
+  0xffffff9fu, 0xffff05ffu, 0xffffffffu, 0x003fffffu, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0xffffff9fu, 0xffff05ffu, 0xffffffffu, 0x003fffffu, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xffffffffu, 0xffff07ffu, 0xffffffffu, 0x003fffffu, /* Word */
+
+/* block 48 */
+  0x7fffffffu, 0x00000000u, 0xffff0000u, 0x001f3fffu, /* L */
+  0x00000000u, 0x00000000u, 0x0000ffc0u, 0x00000000u, /* Nd */
+  0x7fffffffu, 0x00000000u, 0xffffffc0u, 0x001f3fffu, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0x7fffffffu, 0x0e040187u, 0xffffffc0u, 0x001f3fffu, /* Word */
+
+/* block 49 */
+  0xffffffffu, 0xffff0fffu, 0x000003ffu, 0x00000000u, /* L */
+  0x00000000u, 0x00000000u, 0x03ff0000u, 0x00000000u, /* Nd */
+  0xffffffffu, 0xffff0fffu, 0x07ff03ffu, 0x00000000u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xffffffffu, 0xffff0fffu, 0x07ff03ffu, 0x00000000u, /* Word */
+
+/* block 50 */
+  0x007fffffu, 0xffffffffu, 0x001fffffu, 0x00000000u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0x007fffffu, 0xffffffffu, 0x001fffffu, 0x00000000u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0x09ffffffu, 0xffffffffu, 0x7f5fffffu, 0x9ff81fe5u, /* Word */
+
+/* block 51 */
+  0x00000000u, 0x00000080u, 0x00000000u, 0x00000000u, /* L */
+  0x03ff03ffu, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0x03ff03ffu, 0x00000080u, 0x00000000u, 0x00000000u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0x03ff03ffu, 0xbfff0080u, 0x3fffffffu, 0x00000fffu, /* Word */
+
+/* block 52 */
+  0xffffffe0u, 0x000fffffu, 0x00001fe0u, 0x00000000u, /* L */
+  0x00000000u, 0x00000000u, 0x03ff0000u, 0x00000000u, /* Nd */
+  0xffffffe0u, 0x000fffffu, 0x03ff1fe0u, 0x00000000u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xffffffefu, 0x17dfffffu, 0x03ff1fe4u, 0x000ff800u, /* Word */
+
+/* block 53 */
+  0xfffffff8u, 0xfc00c001u, 0xffffffffu, 0x0000003fu, /* L */
+  0x00000000u, 0x03ff0000u, 0x00000000u, 0x00000000u, /* Nd */
+  0xfffffff8u, 0xffffc001u, 0xffffffffu, 0x0000003fu, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xfffffffbu, 0xfffffb3du, 0xffffffffu, 0x0003a37fu, /* Word */
+
+/* block 54 */
+  0xffffffffu, 0x0000000fu, 0xfc00e000u, 0x3fffffffu, /* L */
+  0x00000000u, 0x00000000u, 0x03ff03ffu, 0x00000000u, /* Nd */
+  0xffffffffu, 0x0000000fu, 0xffffe3ffu, 0x3fffffffu, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xffffffffu, 0x00cff00fu, 0xffffe3ffu, 0x3fffffffu, /* Word */
+
+/* block 55 */
+  0xffff07ffu, 0xe7ffffffu, 0x00000000u, 0x046fde00u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0xffff07ffu, 0xe7ffffffu, 0x00000000u, 0x046fde00u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xffff07ffu, 0xe7ffffffu, 0xfff70000u, 0x077ffffdu, /* Word */
+
+/* block 56 */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu, /* Word */
+
+/* block 57 */
+  0xffffffffu, 0xffffffffu, 0x00000000u, 0x00000000u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0xffffffffu, 0xffffffffu, 0x00000000u, 0x00000000u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu, /* Word */
+
+/* block 58 */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu, /* Word */
+
+/* block 59 */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu, /* Word */
+
+/* block 60 */
+  0x3f3fffffu, 0xffffffffu, 0xaaff3f3fu, 0x3fffffffu, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0x3f3fffffu, 0xffffffffu, 0xaaff3f3fu, 0x3fffffffu, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0x3f3fffffu, 0xffffffffu, 0xaaff3f3fu, 0x3fffffffu, /* Word */
+
+/* block 61 */
+  0xffffffffu, 0x5fdfffffu, 0x0fcf1fdcu, 0x1fdc1fffu, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0xffffffffu, 0x5fdfffffu, 0x0fcf1fdcu, 0x1fdc1fffu, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xffffffffu, 0x5fdfffffu, 0x0fcf1fdcu, 0x1fdc1fffu, /* Word */
+
+/* block 62 */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x80020000u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x83f30000u, /* Alnum */
+  0x000007ffu, 0x00008300u, 0x80000000u, 0x00000000u, /* Space */
+  0x00000000u, 0x80000000u, 0x00100001u, 0x83f30000u, /* Word */
+
+/* block 63 */
+  0x1fff0000u, 0x00000000u, 0x00000000u, 0x00000000u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0x1fff03ffu, 0x00000000u, 0x00000000u, 0x00000000u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0x1fff03ffu, 0x00000000u, 0x1fff0000u, 0x0001ffe2u, /* Word */
+
+/* block 64 */
+  0x3e2ffc84u, 0xf3ffbd50u, 0x000043e0u, 0x00000000u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0x3e2ffc84u, 0xf3ffbd50u, 0xffff43e0u, 0xffffffffu, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0x3e2ffc84u, 0xf3ffbd50u, 0xffff43e0u, 0xffffffffu, /* Word */
+
+/* block 65 */
+  0x00000018u, 0x00000000u, 0x00000000u, 0x00000000u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0x000003ffu, 0x00000000u, 0x00000000u, 0x00000000u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0x000003ffu, 0x00000000u, 0x00000000u, 0x00000000u, /* Word */
+
+/* block 66 */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Word */
+
+/* block 67 */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Word */
+
+/* block 68 */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Word */
+
+/* block 69 */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Word */
+
+/* block 70 */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0x00000000u, 0x00000000u, 0x00000000u, 0xffffffffu, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0x00000000u, 0x00000000u, 0x00000000u, 0xffffffffu, /* Word */
+
+/* block 71 */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0x0fffffffu, 0x00000000u, 0x00000000u, 0xfffffc00u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0x0fffffffu, 0x00000000u, 0x00000000u, 0xfffffc00u, /* Word */
+
+/* block 72 */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Word */
+
+/* block 73 */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Word */
+
+/* block 74 */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Word */
+
+/* block 75 */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Word */
+
+/* block 76 */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0x00000000u, 0x00000000u, 0x00000000u, 0xffc00000u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0x00000000u, 0x00000000u, 0x00000000u, 0xffc00000u, /* Word */
+
+/* block 77 */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0x000fffffu, 0x00000000u, 0x00000000u, 0x00000000u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0x000fffffu, 0x00000000u, 0x00000000u, 0x00000000u, /* Word */
+
+/* block 78 */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Word */
+
+/* block 79 */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Word */
+
+/* block 80 */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Word */
+
+/* block 81 */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Word */
+
+/* block 82 */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Word */
+
+/* block 83 */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Word */
+
+/* block 84 */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Word */
+
+/* block 85 */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu, /* Word */
+
+/* block 86 */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0x000c781fu, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0x200c781fu, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0x200ff81fu, /* Word */
+
+/* block 87 */
+  0xffffffffu, 0xffff20bfu, 0xffffffffu, 0x000080ffu, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0xffffffffu, 0xffff20bfu, 0xffffffffu, 0x000080ffu, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xffffffffu, 0xffff20bfu, 0xffffffffu, 0x800080ffu, /* Word */
+
+/* block 88 */
+  0x007fffffu, 0x7f7f7f7fu, 0x7f7f7f7fu, 0x00000000u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0x007fffffu, 0x7f7f7f7fu, 0x7f7f7f7fu, 0x00000000u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0x007fffffu, 0x7f7f7f7fu, 0x7f7f7f7fu, 0xffffffffu, /* Word */
+
+/* block 89 */
+  0x00000000u, 0x00008000u, 0x00000000u, 0x00000000u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0x00000000u, 0x00008000u, 0x00000000u, 0x00000000u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0x00000000u, 0x00008000u, 0x00000000u, 0x00000000u, /* Word */
+
+/* block 90 */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Word */
+
+/* block 91 */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Word */
+
+/* block 92 */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Word */
+
+/* block 93 */
+  0x00000060u, 0x183e0000u, 0xfffffffeu, 0xffffffffu, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0x000000e0u, 0x1f3e03feu, 0xfffffffeu, 0xffffffffu, /* Alnum */
+  0x00000001u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0x000000e0u, 0x1f3e3ffeu, 0xfffffffeu, 0xffffffffu, /* Word */
+
+/* block 94 */
+  0xe07fffffu, 0xfffffffeu, 0xffffffffu, 0xf7ffffffu, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0xe07fffffu, 0xfffffffeu, 0xffffffffu, 0xf7ffffffu, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xe67fffffu, 0xfffffffeu, 0xffffffffu, 0xf7ffffffu, /* Word */
+
+/* block 95 */
+  0xffffffe0u, 0xfffeffffu, 0xffffffffu, 0xffffffffu, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0xffffffe0u, 0xfffeffffu, 0xffffffffu, 0xffffffffu, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xffffffe0u, 0xfffeffffu, 0xffffffffu, 0xffffffffu, /* Word */
+
+/* block 96 */
+  0x00007fffu, 0xffffffffu, 0x00000000u, 0xffff0000u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0x003c7fffu, 0xffffffffu, 0x00000000u, 0xffff0000u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0x003c7fffu, 0xffffffffu, 0x00000000u, 0xffff0000u, /* Word */
+
+/* block 97 */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0x00000000u, 0x000003ffu, 0xfffeff00u, 0x00000000u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0x00000000u, 0x000003ffu, 0xfffeff00u, 0x00000000u, /* Word */
+
+/* block 98 */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0x000003ffu, 0xfffe0000u, 0x00000000u, 0x00000000u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0x000003ffu, 0xfffe0000u, 0x00000000u, 0x00000000u, /* Word */
+
+/* block 99 */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Word */
+
+/* block 100 */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Word */
+
+/* block 101 */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu, /* Word */
+
+/* block 102 */
+  0xffffffffu, 0xffffffffu, 0x00000000u, 0x00000000u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0xffffffffu, 0xffffffffu, 0x00000000u, 0x00000000u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xffffffffu, 0xffffffffu, 0x00000000u, 0x00000000u, /* Word */
+
+/* block 103 */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu, /* Word */
+
+/* block 104 */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu, /* Word */
+
+/* block 105 */
+  0x00001fffu, 0x00000000u, 0xffff0000u, 0x3fffffffu, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0x00001fffu, 0x00000000u, 0xffff0000u, 0x3fffffffu, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0x00001fffu, 0x00000000u, 0xffff0000u, 0x3fffffffu, /* Word */
+
+/* block 106 */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu, /* Word */
+
+/* block 107 */
+  0xffff1fffu, 0x00000c00u, 0xffffffffu, 0x80007fffu, /* L */
+  0x00000000u, 0x000003ffu, 0x00000000u, 0x00000000u, /* Nd */
+  0xffff1fffu, 0x00000fffu, 0xffffffffu, 0x80007fffu, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xffff1fffu, 0x00000fffu, 0xffffffffu, 0xbff0ffffu, /* Word */
+
+/* block 108 */
+  0x3fffffffu, 0xffffffffu, 0xffffffffu, 0x0000003fu, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0x3fffffffu, 0xffffffffu, 0xffffffffu, 0x0000ffffu, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0x0003ffffu, /* Word */
+
+/* block 109 */
+  0xff800000u, 0xfffffffcu, 0xffffffffu, 0xffffffffu, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0xff800000u, 0xfffffffcu, 0xffffffffu, 0xffffffffu, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xff800000u, 0xfffffffcu, 0xffffffffu, 0xffffffffu, /* Word */
+
+/* block 110 */
+  0xfffff9ffu, 0xffffffffu, 0x1fffffffu, 0xfffe0000u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0xfffff9ffu, 0xffffffffu, 0x1fffffffu, 0xfffe0000u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xfffff9ffu, 0xffffffffu, 0x1fffffffu, 0xfffe0000u, /* Word */
+
+/* block 111 */
+  0xfffff7bbu, 0x00000007u, 0xffffffffu, 0x000fffffu, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0xfffff7bbu, 0x003f0007u, 0xffffffffu, 0x000fffffu, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xffffffffu, 0x003f1067u, 0xffffffffu, 0x000fffffu, /* Word */
+
+/* block 112 */
+  0xfffffffcu, 0x000fffffu, 0x00000000u, 0x68fc0000u, /* L */
+  0x00000000u, 0x00000000u, 0x03ff0000u, 0x00000000u, /* Nd */
+  0xfffffffcu, 0x000fffffu, 0x03ff0000u, 0x68fc0000u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xfffffffcu, 0x000fffffu, 0x03ff0030u, 0xe8ffffffu, /* Word */
+
+/* block 113 */
+  0xfffffc00u, 0xffff003fu, 0x0000007fu, 0x1fffffffu, /* L */
+  0x000003ffu, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0xffffffffu, 0xffff003fu, 0x0000007fu, 0x1fffffffu, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xffffffffu, 0xffff3fffu, 0x0003ffffu, 0x1fffffffu, /* Word */
+
+/* block 114 */
+  0xfffffff0u, 0x0007ffffu, 0x00008000u, 0x7c00ffdfu, /* L */
+  0x00000000u, 0x00000000u, 0x03ff0000u, 0x03ff0000u, /* Nd */
+  0xfffffff0u, 0x0007ffffu, 0x03ff8000u, 0x7fffffdfu, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xfffffff7u, 0x33cfffffu, 0x03ff8000u, 0x7fffffffu, /* Word */
+
+/* block 115 */
+  0xffffffffu, 0x000001ffu, 0x00000ff7u, 0xc47fffffu, /* L */
+  0x00000000u, 0x00000000u, 0x03ff0000u, 0x00000000u, /* Nd */
+  0xffffffffu, 0x000001ffu, 0x03ff0ff7u, 0xc47fffffu, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xffffffffu, 0x00667fffu, 0x03ff1fffu, 0xd47fffffu, /* Word */
+
+/* block 116 */
+  0xffffffffu, 0x3e62ffffu, 0x38000005u, 0x001c07ffu, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0xffffffffu, 0x3e62ffffu, 0x38000005u, 0x001c07ffu, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xffffffffu, 0xffffffffu, 0x38000007u, 0x005c37ffu, /* Word */
+
+/* block 117 */
+  0x007e7e7eu, 0xffff7f7fu, 0xf7ffffffu, 0xffff03ffu, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0x007e7e7eu, 0xffff7f7fu, 0xf7ffffffu, 0xffff03ffu, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0x007e7e7eu, 0xffff7f7fu, 0xf7ffffffu, 0xffff03ffu, /* Word */
+
+/* block 118 */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0x00000007u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x03ff0000u, /* Nd */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0x03ff0007u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0x03ff2127u, /* Word */
+
+/* block 119 */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu, /* Word */
+
+/* block 120 */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu, /* Word */
+
+/* block 121 */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu, /* Word */
+
+/* block 122 */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu, /* Word */
+
+/* block 123 */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu, /* Word */
+
+/* block 124 */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu, /* Word */
+
+/* block 125 */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu, /* Word */
+
+/* block 126 */
+  0xffffffffu, 0xffff000fu, 0xfffff87fu, 0x0fffffffu, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0xffffffffu, 0xffff000fu, 0xfffff87fu, 0x0fffffffu, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xffffffffu, 0xffff000fu, 0xfffff87fu, 0x0fffffffu, /* Word */
+
+/* block 127 */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Word */
+
+/* block 128 */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Word */
+
+/* block 129 */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu, /* Word */
+
+/* block 130 */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffff3fffu, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffff3fffu, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffff3fffu, /* Word */
+
+/* block 131 */
+  0xffffffffu, 0xffffffffu, 0x03ffffffu, 0x00000000u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0xffffffffu, 0xffffffffu, 0x03ffffffu, 0x00000000u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xffffffffu, 0xffffffffu, 0x03ffffffu, 0x00000000u, /* Word */
+
+/* block 132 */
+  0xa0f8007fu, 0x5f7ffdffu, 0xffffffdbu, 0xffffffffu, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0xa0f8007fu, 0x5f7ffdffu, 0xffffffdbu, 0xffffffffu, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xe0f8007fu, 0x5f7ffdffu, 0xffffffdbu, 0xffffffffu, /* Word */
+
+/* block 133 */
+  0xffffffffu, 0x0003ffffu, 0xfff80000u, 0xffffffffu, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0xffffffffu, 0x0003ffffu, 0xfff80000u, 0xffffffffu, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xffffffffu, 0x0003ffffu, 0xfff80000u, 0xffffffffu, /* Word */
+
+/* block 134 */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu, /* Word */
+
+/* block 135 */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu, /* Word */
+
+/* block 136 */
+  0xffffffffu, 0x3fffffffu, 0xffff0000u, 0xffffffffu, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0xffffffffu, 0x3fffffffu, 0xffff0000u, 0xffffffffu, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xffffffffu, 0x3fffffffu, 0xffff0000u, 0xffffffffu, /* Word */
+
+/* block 137 */
+  0xfffcffffu, 0xffffffffu, 0x000000ffu, 0x0fff0000u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0xfffcffffu, 0xffffffffu, 0x000000ffu, 0x0fff0000u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xfffcffffu, 0xffffffffu, 0x000000ffu, 0x0fff0000u, /* Word */
+
+/* block 138 */
+  0x00000000u, 0x00000000u, 0x00000000u, 0xffdf0000u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0x00000000u, 0x00000000u, 0x00000000u, 0xffdf0000u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0x0000ffffu, 0x0018ffffu, 0x0000e000u, 0xffdf0000u, /* Word */
+
+/* block 139 */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0x1fffffffu, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0x1fffffffu, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0x1fffffffu, /* Word */
+
+/* block 140 */
+  0x00000000u, 0x07fffffeu, 0x07fffffeu, 0xffffffc0u, /* L */
+  0x03ff0000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0x03ff0000u, 0x07fffffeu, 0x07fffffeu, 0xffffffc0u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0x03ff0000u, 0x87fffffeu, 0x07fffffeu, 0xffffffc0u, /* Word */
+
+/* block 141 */
+  0xffffffffu, 0x7fffffffu, 0x1cfcfcfcu, 0x00000000u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0xffffffffu, 0x7fffffffu, 0x1cfcfcfcu, 0x00000000u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xffffffffu, 0x7fffffffu, 0x1cfcfcfcu, 0x00000000u, /* Word */
+
+/* block 142 */
+  0xffffefffu, 0xb7ffff7fu, 0x3fff3fffu, 0x00000000u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0xffffefffu, 0xb7ffff7fu, 0x3fff3fffu, 0x00000000u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xffffefffu, 0xb7ffff7fu, 0x3fff3fffu, 0x00000000u, /* Word */
+
+/* block 143 */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0x07ffffffu, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0x07ffffffu, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0x07ffffffu, /* Word */
+
+/* block 144 */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0xffffff80u, 0x000fffffu, 0xffffffffu, 0x01ffffffu, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xffffff80u, 0x000fffffu, 0xffffffffu, 0x01ffffffu, /* Word */
+
+/* block 145 */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0x00000c00u, 0x00000000u, 0x00000000u, 0x00000000u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0x00000c00u, 0x00000000u, 0x00000000u, 0x20000000u, /* Word */
+
+/* block 146 */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Word */
+
+/* block 147 */
+  0x1fffffffu, 0xffffffffu, 0x0001ffffu, 0x00000000u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0x1fffffffu, 0xffffffffu, 0x0001ffffu, 0x0ffffffeu, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0x1fffffffu, 0xffffffffu, 0x0001ffffu, 0x0fffffffu, /* Word */
+
+/* block 148 */
+  0xffffffffu, 0xffffe000u, 0xffff03fdu, 0x003fffffu, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0xffffffffu, 0xffffe00fu, 0xffff07ffu, 0x003fffffu, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xffffffffu, 0xffffe00fu, 0xffff07ffu, 0x07ffffffu, /* Word */
+
+/* block 149 */
+  0x3fffffffu, 0xffffffffu, 0x0000ff0fu, 0x00000000u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0x3fffffffu, 0xffffffffu, 0x003eff0fu, 0x00000000u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0x3fffffffu, 0xffffffffu, 0x003eff0fu, 0x00000000u, /* Word */
+
+/* block 150 */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu, /* Word */
+
+/* block 151 */
+  0x3fffffffu, 0xffff0000u, 0xff0fffffu, 0x0fffffffu, /* L */
+  0x00000000u, 0x000003ffu, 0x00000000u, 0x00000000u, /* Nd */
+  0x3fffffffu, 0xffff03ffu, 0xff0fffffu, 0x0fffffffu, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0x3fffffffu, 0xffff03ffu, 0xff0fffffu, 0x0fffffffu, /* Word */
+
+/* block 152 */
+  0xffffffffu, 0xffff00ffu, 0xffffffffu, 0xf7ff000fu, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0xffffffffu, 0xffff00ffu, 0xffffffffu, 0xf7ff000fu, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xffffffffu, 0xffff00ffu, 0xffffffffu, 0xf7ff000fu, /* Word */
+
+/* block 153 */
+  0xffb7f7ffu, 0x1bfbfffbu, 0xffffffffu, 0x000fffffu, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0xffb7f7ffu, 0x1bfbfffbu, 0xffffffffu, 0x000fffffu, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xffb7f7ffu, 0x1bfbfffbu, 0xffffffffu, 0x000fffffu, /* Word */
+
+/* block 154 */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu, /* Word */
+
+/* block 155 */
+  0xffffffffu, 0x007fffffu, 0x003fffffu, 0x000000ffu, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0xffffffffu, 0x007fffffu, 0x003fffffu, 0x000000ffu, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xffffffffu, 0x007fffffu, 0x003fffffu, 0x000000ffu, /* Word */
+
+/* block 156 */
+  0xffffffbfu, 0x07fdffffu, 0x00000000u, 0x00000000u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0xffffffbfu, 0x07fdffffu, 0x00000000u, 0x00000000u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xffffffbfu, 0x07fdffffu, 0x00000000u, 0x00000000u, /* Word */
+
+/* block 157 */
+  0xfffffd3fu, 0x91bfffffu, 0x003fffffu, 0x007fffffu, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0xfffffd3fu, 0x91bfffffu, 0xff3fffffu, 0xfe7fffffu, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xfffffd3fu, 0x91bfffffu, 0xff3fffffu, 0xfe7fffffu, /* Word */
+
+/* block 158 */
+  0x7fffffffu, 0x00000000u, 0x00000000u, 0x0037ffffu, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0x7fffffffu, 0x0000ff80u, 0x00000000u, 0xf837ffffu, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0x7fffffffu, 0x0000ff80u, 0x00000000u, 0xf837ffffu, /* Word */
+
+/* block 159 */
+  0x003fffffu, 0x03ffffffu, 0x03ffffffu, 0x00000000u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0x0fffffffu, 0x03ffffffu, 0x03ffffffu, 0x00000000u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0x0fffffffu, 0x03ffffffu, 0x03ffffffu, 0x00000000u, /* Word */
+
+/* block 160 */
+  0xffffffffu, 0xc0ffffffu, 0x00000000u, 0x00000000u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0xffffffffu, 0xf0ffffffu, 0xfffcffffu, 0xffffffffu, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xffffffffu, 0xf0ffffffu, 0xfffcffffu, 0xffffffffu, /* Word */
+
+/* block 161 */
+  0xfeef0001u, 0x003fffffu, 0x00000000u, 0x1fffffffu, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0xfeef0001u, 0x003fffffu, 0x000001ffu, 0x7fffffffu, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xfeeff06fu, 0x873fffffu, 0x000001ffu, 0x7fffffffu, /* Word */
+
+/* block 162 */
+  0x1fffffffu, 0x00000000u, 0xfffffeffu, 0x0000001fu, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0xffffffffu, 0x00000000u, 0xfffffeffu, 0x0000f81fu, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xffffffffu, 0x00000000u, 0xfffffeffu, 0x0000f87fu, /* Word */
+
+/* block 163 */
+  0xffffffffu, 0x003fffffu, 0x003fffffu, 0x0007ffffu, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0xffffffffu, 0x003fffffu, 0xff3fffffu, 0xff07ffffu, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xffffffffu, 0x003fffffu, 0xff3fffffu, 0xff07ffffu, /* Word */
+
+/* block 164 */
+  0x0003ffffu, 0x00000000u, 0x00000000u, 0x00000000u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0x0003ffffu, 0x0000fe00u, 0x00000000u, 0x00000000u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0x0003ffffu, 0x0000fe00u, 0x00000000u, 0x00000000u, /* Word */
+
+/* block 165 */
+  0xffffffffu, 0xffffffffu, 0x000001ffu, 0x00000000u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0xffffffffu, 0xffffffffu, 0x000001ffu, 0x00000000u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xffffffffu, 0xffffffffu, 0x000001ffu, 0x00000000u, /* Word */
+
+/* block 166 */
+  0xffffffffu, 0x0007ffffu, 0xffffffffu, 0x0007ffffu, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0xffffffffu, 0x0007ffffu, 0xffffffffu, 0xfc07ffffu, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xffffffffu, 0x0007ffffu, 0xffffffffu, 0xfc07ffffu, /* Word */
+
+/* block 167 */
+  0xffffffffu, 0x0000000fu, 0xfffffc00u, 0xffff803fu, /* L */
+  0x00000000u, 0x03ff0000u, 0x000003ffu, 0x00000000u, /* Nd */
+  0xffffffffu, 0x03ff000fu, 0xffffffffu, 0xffff803fu, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xffffffffu, 0x03ff00ffu, 0xffffffffu, 0xffffbe3fu, /* Word */
+
+/* block 168 */
+  0x0000003fu, 0x00000000u, 0x00000000u, 0x00000000u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0x0000003fu, 0x00000000u, 0x00000000u, 0x00000000u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0x0000003fu, 0x00000000u, 0x00000000u, 0x00000000u, /* Word */
+
+/* block 169 */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x7fffffffu, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x7fffffffu, /* Word */
+
+/* block 170 */
+  0xffffffffu, 0x000303ffu, 0x000000fcu, 0x00000000u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0xffffffffu, 0x000303ffu, 0x000000fcu, 0x00000000u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xffffffffu, 0x00031bffu, 0x000000fcu, 0xfc000000u, /* Word */
+
+/* block 171 */
+  0x1fffffffu, 0xffff0080u, 0x0000003fu, 0xffff0000u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0xffffffffu, 0xffff00ffu, 0x001e003fu, 0xffff0000u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xffffffffu, 0xffff00ffu, 0x001fffffu, 0xffff0000u, /* Word */
+
+/* block 172 */
+  0x00000003u, 0xffff0000u, 0x0000001fu, 0x007fffffu, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0x00000003u, 0xffff0000u, 0x00000fffu, 0x007fffffu, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0x0000003fu, 0xffff0000u, 0x00000fffu, 0x007fffffu, /* Word */
+
+/* block 173 */
+  0xfffffff8u, 0x00ffffffu, 0x00000000u, 0x00260000u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x0000ffc0u, /* Nd */
+  0xfffffff8u, 0x00ffffffu, 0xfffc0000u, 0x0026ffffu, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xfffffffau, 0xffffffffu, 0xfffc007fu, 0x803fffffu, /* Word */
+
+/* block 174 */
+  0xfffffff8u, 0x0000ffffu, 0xffff0000u, 0x000001ffu, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x03ff0000u, /* Nd */
+  0xfffffff8u, 0x0000ffffu, 0xffff0000u, 0x03ff01ffu, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xfffffffbu, 0x0678ffffu, 0xffff0004u, 0x03ff01ffu, /* Word */
+
+/* block 175 */
+  0xfffffff8u, 0x0000007fu, 0xffff0090u, 0x0047ffffu, /* L */
+  0x00000000u, 0xffc00000u, 0x00000000u, 0x00000000u, /* Nd */
+  0xfffffff8u, 0xffc0007fu, 0xffff0090u, 0x0047ffffu, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xffffffffu, 0xffdfefffu, 0xffff0090u, 0x004fffffu, /* Word */
+
+/* block 176 */
+  0xfffffff8u, 0x0007ffffu, 0x1400001eu, 0x00000000u, /* L */
+  0x00000000u, 0x00000000u, 0x03ff0000u, 0x00000000u, /* Nd */
+  0xfffffff8u, 0x0007ffffu, 0x17ff001eu, 0x001ffffeu, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xfffffffbu, 0x7fc7ffffu, 0x17ff9e1eu, 0x001ffffeu, /* Word */
+
+/* block 177 */
+  0xfffbffffu, 0x80000fffu, 0x00000001u, 0x00000000u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0xfffbffffu, 0x80000fffu, 0x00000001u, 0x00000000u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xfffbffffu, 0xc0d38fffu, 0x00000003u, 0x00000000u, /* Word */
+
+/* block 178 */
+  0xbfffbd7fu, 0xffff01ffu, 0x7fffffffu, 0x00000000u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x03ff0000u, /* Nd */
+  0xbfffbd7fu, 0xffff01ffu, 0x7fffffffu, 0x03ff0000u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xbfffbd7fu, 0xffff01ffu, 0xffffffffu, 0x03ff07f8u, /* Word */
+
+/* block 179 */
+  0xfff99fe0u, 0x23edfdffu, 0xe0010000u, 0x00000003u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0xfff99fe0u, 0x23edfdffu, 0xe0010000u, 0x00000003u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xfff99fe3u, 0x3bedfdffu, 0xe0010001u, 0x001f1fc3u, /* Word */
+
+/* block 180 */
+  0xffff4bffu, 0x00bfffffu, 0x000a0000u, 0x00000000u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0xffff4bffu, 0x00bfffffu, 0x000a0000u, 0x00000000u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xffff4bffu, 0xf8bfffffu, 0x000f4001u, 0x00000006u, /* Word */
+
+/* block 181 */
+  0xffffffffu, 0x001fffffu, 0x80000780u, 0x00000003u, /* L */
+  0x00000000u, 0x00000000u, 0x03ff0000u, 0x00000000u, /* Nd */
+  0xffffffffu, 0x001fffffu, 0x83ff0780u, 0x00000003u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xffffffffu, 0xff1fffffu, 0xc3ff07dcu, 0x00000003u, /* Word */
+
+/* block 182 */
+  0xffffffffu, 0x0000ffffu, 0x000000b0u, 0x00000000u, /* L */
+  0x00000000u, 0x00000000u, 0x03ff0000u, 0x00000000u, /* Nd */
+  0xffffffffu, 0x0000ffffu, 0x03ff00b0u, 0x00000000u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xffffffffu, 0x85f8ffffu, 0x03ff00bdu, 0x00000000u, /* Word */
+
+/* block 183 */
+  0xffffffffu, 0x00007fffu, 0x0f000000u, 0x00000000u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0xffffffffu, 0x00007fffu, 0x0f000000u, 0x00000000u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xffffffffu, 0xb03c7fffu, 0x3f000001u, 0x00000000u, /* Word */
+
+/* block 184 */
+  0xffffffffu, 0x0000ffffu, 0x00000010u, 0x00000000u, /* L */
+  0x00000000u, 0x00000000u, 0x03ff0000u, 0x00000000u, /* Nd */
+  0xffffffffu, 0x0000ffffu, 0x03ff0010u, 0x00000000u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xffffffffu, 0xa7f8ffffu, 0x03ff0011u, 0x00000000u, /* Word */
+
+/* block 185 */
+  0xffffffffu, 0x010007ffu, 0x00000000u, 0x00000000u, /* L */
+  0x00000000u, 0x00000000u, 0xffff03ffu, 0x0000000fu, /* Nd */
+  0xffffffffu, 0x010007ffu, 0xffff03ffu, 0x0000000fu, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xffffffffu, 0x01bf2fffu, 0xffff03ffu, 0x0000000fu, /* Word */
+
+/* block 186 */
+  0x07ffffffu, 0x00000000u, 0x0000007fu, 0x00000000u, /* L */
+  0x00000000u, 0x03ff0000u, 0x00000000u, 0x00000000u, /* Nd */
+  0x07ffffffu, 0x0fff0000u, 0x0000007fu, 0x00000000u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xa7ffffffu, 0x0fff0fbcu, 0x0000007fu, 0x00000000u, /* Word */
+
+/* block 187 */
+  0xffffffffu, 0x00000fffu, 0x00000000u, 0x00000000u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0xffffffffu, 0x00000fffu, 0x00000000u, 0x00000000u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xffffffffu, 0x06ff8fffu, 0x00000000u, 0x00000000u, /* Word */
+
+/* block 188 */
+  0x00000000u, 0xffffffffu, 0xffffffffu, 0x80000000u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x000003ffu, /* Nd */
+  0x00000000u, 0xffffffffu, 0xffffffffu, 0x8007ffffu, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0x00000000u, 0xffffffffu, 0xffffffffu, 0x8007ffffu, /* Word */
+
+/* block 189 */
+  0xff6ff27fu, 0x8000ffffu, 0x00000002u, 0x00000000u, /* L */
+  0x00000000u, 0x00000000u, 0x03ff0000u, 0x00000000u, /* Nd */
+  0xff6ff27fu, 0x8000ffffu, 0x03ff0002u, 0x00000000u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xff6ff27fu, 0xd800ffffu, 0x03ff000au, 0x00000000u, /* Word */
+
+/* block 190 */
+  0x00000000u, 0xfffffcffu, 0x0001ffffu, 0x0000000au, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0x00000000u, 0xfffffcffu, 0x0001ffffu, 0x0000000au, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0x00000000u, 0xfffffcffu, 0x0cf1ffffu, 0x0000000bu, /* Word */
+
+/* block 191 */
+  0xfffff801u, 0x0407ffffu, 0xf0010000u, 0xffffffffu, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0xfffff801u, 0x0407ffffu, 0xf0010000u, 0xffffffffu, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xffffffffu, 0x7dffffffu, 0xfe7f0080u, 0xffffffffu, /* Word */
+
+/* block 192 */
+  0x200003ffu, 0xffff0000u, 0xffffffffu, 0x01ffffffu, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0x200003ffu, 0xffff0000u, 0xffffffffu, 0x01ffffffu, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0x237fffffu, 0xffff0000u, 0xffffffffu, 0x01ffffffu, /* Word */
+
+/* block 193 */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x0000005du, /* Word */
+
+/* block 194 */
+  0x00000000u, 0x00000000u, 0xffffffffu, 0x00000001u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x03ff0000u, /* Nd */
+  0x00000000u, 0x00000000u, 0xffffffffu, 0x03ff0001u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0x00000000u, 0x00000000u, 0xffffffffu, 0x03ff0001u, /* Word */
+
+/* block 195 */
+  0xfffffdffu, 0x00007fffu, 0x00000001u, 0xfffc0000u, /* L */
+  0x00000000u, 0x00000000u, 0x03ff0000u, 0x00000000u, /* Nd */
+  0xfffffdffu, 0x00007fffu, 0xffff0001u, 0xfffc1fffu, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xfffffdffu, 0xbf7f7fffu, 0xffff0001u, 0xfffc1fffu, /* Word */
+
+/* block 196 */
+  0x0000ffffu, 0x00000000u, 0x00000000u, 0x00000000u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0x0000ffffu, 0x00000000u, 0x00000000u, 0x00000000u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xfffcffffu, 0x006dfcffu, 0x00000000u, 0x00000000u, /* Word */
+
+/* block 197 */
+  0xfffffb7fu, 0x0001ffffu, 0x00000040u, 0xfffffdbfu, /* L */
+  0x00000000u, 0x00000000u, 0x03ff0000u, 0x00000000u, /* Nd */
+  0xfffffb7fu, 0x0001ffffu, 0x03ff0040u, 0xfffffdbfu, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xfffffb7fu, 0xb47fffffu, 0x03ff00ffu, 0xfffffdbfu, /* Word */
+
+/* block 198 */
+  0x010003ffu, 0xffff0000u, 0x0fffffffu, 0x00000000u, /* L */
+  0x00000000u, 0x000003ffu, 0x00000000u, 0x000003ffu, /* Nd */
+  0x010003ffu, 0xffff03ffu, 0x0fffffffu, 0x000003ffu, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0x01a303ffu, 0xffff03ffu, 0x0fffffffu, 0x000003ffu, /* Word */
+
+/* block 199 */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x0007ffffu, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x0007ffffu, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x001fffffu, /* Word */
+
+/* block 200 */
+  0xfffdfff4u, 0x000fffffu, 0x00000000u, 0x00000000u, /* L */
+  0x00000000u, 0x00000000u, 0x03ff0000u, 0x00000000u, /* Nd */
+  0xfffdfff4u, 0x000fffffu, 0x03ff0000u, 0x00000000u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xfffdfff7u, 0x07cfffffu, 0x07ff0005u, 0x00000000u, /* Word */
+
+/* block 201 */
+  0x00000000u, 0x00010000u, 0x00000000u, 0x00000000u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0x00000000u, 0x00010000u, 0x001fffffu, 0x00000000u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0x00000000u, 0x00010000u, 0x001fffffu, 0x00000000u, /* Word */
+
+/* block 202 */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu, /* Word */
+
+/* block 203 */
+  0x03ffffffu, 0x00000000u, 0x00000000u, 0x00000000u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0x03ffffffu, 0x00000000u, 0x00000000u, 0x00000000u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0x03ffffffu, 0x00000000u, 0x00000000u, 0x00000000u, /* Word */
+
+/* block 204 */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0x00007fffu, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0x00007fffu, /* Word */
+
+/* block 205 */
+  0xffffffffu, 0xffffffffu, 0x0000000fu, 0x00000000u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0xffffffffu, 0xffffffffu, 0x0000000fu, 0x00000000u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xffffffffu, 0xffffffffu, 0x0000000fu, 0x00000000u, /* Word */
+
+/* block 206 */
+  0xffff0000u, 0xffffffffu, 0xffffffffu, 0x0001ffffu, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0xffff0000u, 0xffffffffu, 0xffffffffu, 0x0001ffffu, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xffff0000u, 0xffffffffu, 0xffffffffu, 0x0001ffffu, /* Word */
+
+/* block 207 */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu, /* Word */
+
+/* block 208 */
+  0xffffffffu, 0x0000ffffu, 0x0000007eu, 0xffffffffu, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0xffffffffu, 0x0000ffffu, 0x0000007eu, 0xffffffffu, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xffffffffu, 0x0000ffffu, 0x003fffffu, 0xffffffffu, /* Word */
+
+/* block 209 */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0x07ffffffu, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0x07ffffffu, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0x07ffffffu, /* Word */
+
+/* block 210 */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu, /* Word */
+
+/* block 211 */
+  0xffffffffu, 0xffffffffu, 0x0000007fu, 0x00000000u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0xffffffffu, 0xffffffffu, 0x0000007fu, 0x00000000u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xffffffffu, 0xffffffffu, 0x0000007fu, 0x00000000u, /* Word */
+
+/* block 212 */
+  0x3fffffffu, 0x00000000u, 0x00000000u, 0x00000000u, /* L */
+  0x00000000u, 0x03ff0000u, 0x00000000u, 0x00000000u, /* Nd */
+  0x3fffffffu, 0x03ff0000u, 0x00000000u, 0x00000000u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xffffffffu, 0x03ffe3ffu, 0x00000000u, 0x00000000u, /* Word */
+
+/* block 213 */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu, /* Word */
+
+/* block 214 */
+  0xffffffffu, 0x01ffffffu, 0x7fffffffu, 0xffff0000u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x000003ffu, /* Nd */
+  0xffffffffu, 0x01ffffffu, 0x7fffffffu, 0xffff03ffu, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xffffffffu, 0x01ffffffu, 0x7fffffffu, 0xffff03ffu, /* Word */
+
+/* block 215 */
+  0xffffffffu, 0x7fffffffu, 0xffff0000u, 0x00003fffu, /* L */
+  0x00000000u, 0x00000000u, 0x000003ffu, 0x00000000u, /* Nd */
+  0xffffffffu, 0x7fffffffu, 0xffff03ffu, 0x00003fffu, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xffffffffu, 0x7fffffffu, 0xffff03ffu, 0x001f3fffu, /* Word */
+
+/* block 216 */
+  0xffffffffu, 0x0000ffffu, 0x0000000fu, 0xe0fffff8u, /* L */
+  0x00000000u, 0x00000000u, 0x03ff0000u, 0x00000000u, /* Nd */
+  0xffffffffu, 0x0000ffffu, 0xfbff000fu, 0xe0fffffbu, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xffffffffu, 0x007fffffu, 0xfbff000fu, 0xe0fffffbu, /* Word */
+
+/* block 217 */
+  0x0000ffffu, 0x00000000u, 0x00000000u, 0x00000000u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0x0000ffffu, 0x00000000u, 0x00000000u, 0x00000000u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0x0000ffffu, 0x00000000u, 0x00000000u, 0x00000000u, /* Word */
+
+/* block 218 */
+  0x00000000u, 0x00000000u, 0xffffffffu, 0x00001fffu, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x03ff0000u, /* Nd */
+  0x00000000u, 0x00000000u, 0xffffffffu, 0x03ff1fffu, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0x00000000u, 0x00000000u, 0xffffffffu, 0x03ff1fffu, /* Word */
+
+/* block 219 */
+  0x00000000u, 0x00000000u, 0xffffffffu, 0xffffffffu, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0x00000000u, 0x00000000u, 0xffffffffu, 0xffffffffu, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0x00000000u, 0x00000000u, 0xffffffffu, 0xffffffffu, /* Word */
+
+/* block 220 */
+  0x00000000u, 0xf9ffffffu, 0x000fffffu, 0x00000000u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0x007fffffu, 0xf9ffffffu, 0x000fffffu, 0x00000000u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0x007fffffu, 0xf9ffffffu, 0x000fffffu, 0x00000000u, /* Word */
+
+/* block 221 */
+  0xffffffffu, 0xffffffffu, 0x000107ffu, 0x00000000u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0xffffffffu, 0xffffffffu, 0x000107ffu, 0x00000000u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xffffffffu, 0xffffffffu, 0x000187ffu, 0x00000000u, /* Word */
+
+/* block 222 */
+  0xfff80000u, 0x00000000u, 0x00000000u, 0x000c000bu, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0xfff80000u, 0x00000000u, 0x00000000u, 0x007c000bu, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xffff8000u, 0x00000000u, 0x00000000u, 0x007c001bu, /* Word */
+
+/* block 223 */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu, /* Word */
+
+/* block 224 */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu, /* Word */
+
+/* block 225 */
+  0xffffffffu, 0xffffffffu, 0x003fffffu, 0x80000000u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0xffffffffu, 0xffffffffu, 0x003fffffu, 0x80000000u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xffffffffu, 0xffffffffu, 0x003fffffu, 0x80000000u, /* Word */
+
+/* block 226 */
+  0x7fffffffu, 0x00000000u, 0x00000000u, 0x00000000u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0x7fffffffu, 0x00000000u, 0x00000000u, 0x00000000u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0x7fffffffu, 0x00000000u, 0x00000000u, 0x00000000u, /* Word */
+
+/* block 227 */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0x0007ffffu, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0x0007ffffu, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0x0007ffffu, /* Word */
+
+/* block 228 */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x6fef0000u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x6fef0000u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x6fef0000u, /* Word */
+
+/* block 229 */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu, /* Word */
+
+/* block 230 */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu, /* Word */
+
+/* block 231 */
+  0xffffffffu, 0x00040007u, 0x00270000u, 0xffff00f0u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0xffffffffu, 0x00040007u, 0x00270000u, 0xffff00f0u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xffffffffu, 0x00040007u, 0x00270000u, 0xffff00f0u, /* Word */
+
+/* block 232 */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu, /* Word */
+
+/* block 233 */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0x0fffffffu, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0x0fffffffu, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0x0fffffffu, /* Word */
+
+/* block 234 */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0x1fff07ffu, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0x1fff07ffu, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0x1fff07ffu, /* Word */
+
+/* block 235 */
+  0x03ff01ffu, 0x00000000u, 0x00000000u, 0x00000000u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0x03ff01ffu, 0x00000000u, 0x00000000u, 0x00000000u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0x63ff01ffu, 0x00000000u, 0x00000000u, 0x00000000u, /* Word */
+
+/* block 236 */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Word */
+
+/* block 237 */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x03ff0000u, /* Nd */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x03ff0000u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x03ff0000u, /* Word */
+
+/* block 238 */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Word */
+
+/* block 239 */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xffffffffu, 0xffff3fffu, 0x0000007fu, 0x00000000u, /* Word */
+
+/* block 240 */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Word */
+
+/* block 241 */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Word */
+
+/* block 242 */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Word */
+
+/* block 243 */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0x00000000u, 0x00000000u, 0x00000000u, 0xf8000380u, /* Word */
+
+/* block 244 */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0x00000fe7u, 0x00003c00u, 0x00000000u, 0x00000000u, /* Word */
+
+/* block 245 */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0x00000000u, 0x00000000u, 0x0000001cu, 0x00000000u, /* Word */
+
+/* block 246 */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0x00000000u, 0x00000000u, 0x000fffffu, 0x000fffffu, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0x00000000u, 0x00000000u, 0x000fffffu, 0x000fffffu, /* Word */
+
+/* block 247 */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x01ffffffu, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x01ffffffu, /* Word */
+
+/* block 248 */
+  0xffffffffu, 0xffffffffu, 0xffdfffffu, 0xffffffffu, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0xffffffffu, 0xffffffffu, 0xffdfffffu, 0xffffffffu, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xffffffffu, 0xffffffffu, 0xffdfffffu, 0xffffffffu, /* Word */
+
+/* block 249 */
+  0xdfffffffu, 0xebffde64u, 0xffffffefu, 0xffffffffu, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0xdfffffffu, 0xebffde64u, 0xffffffefu, 0xffffffffu, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xdfffffffu, 0xebffde64u, 0xffffffefu, 0xffffffffu, /* Word */
+
+/* block 250 */
+  0xdfdfe7bfu, 0x7bffffffu, 0xfffdfc5fu, 0xffffffffu, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0xdfdfe7bfu, 0x7bffffffu, 0xfffdfc5fu, 0xffffffffu, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xdfdfe7bfu, 0x7bffffffu, 0xfffdfc5fu, 0xffffffffu, /* Word */
+
+/* block 251 */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu, /* Word */
+
+/* block 252 */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu, /* Word */
+
+/* block 253 */
+  0xffffffffu, 0xffffff3fu, 0xf7fffffdu, 0xf7ffffffu, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0xffffffffu, 0xffffff3fu, 0xf7fffffdu, 0xf7ffffffu, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xffffffffu, 0xffffff3fu, 0xf7fffffdu, 0xf7ffffffu, /* Word */
+
+/* block 254 */
+  0xffdfffffu, 0xffdfffffu, 0xffff7fffu, 0xffff7fffu, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0xffdfffffu, 0xffdfffffu, 0xffff7fffu, 0xffff7fffu, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xffdfffffu, 0xffdfffffu, 0xffff7fffu, 0xffff7fffu, /* Word */
+
+/* block 255 */
+  0xfffffdffu, 0xfffffdffu, 0x00000ff7u, 0x00000000u, /* L */
+  0x00000000u, 0x00000000u, 0xffffc000u, 0xffffffffu, /* Nd */
+  0xfffffdffu, 0xfffffdffu, 0xffffcff7u, 0xffffffffu, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xfffffdffu, 0xfffffdffu, 0xffffcff7u, 0xffffffffu, /* Word */
+
+/* block 256 */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Word */
+
+/* block 257 */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xffffffffu, 0xf87fffffu, 0xffffffffu, 0x00201fffu, /* Word */
+
+/* block 258 */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xf8000010u, 0x0000fffeu, 0x00000000u, 0x00000000u, /* Word */
+
+/* block 259 */
+  0x7fffffffu, 0x000007e0u, 0x00000000u, 0x00000000u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0x7fffffffu, 0x000007e0u, 0x00000000u, 0x00000000u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0x7fffffffu, 0x000007e0u, 0x00000000u, 0x00000000u, /* Word */
+
+/* block 260 */
+  0x00000000u, 0xffff0000u, 0xffffffffu, 0x00003fffu, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0x00000000u, 0xffff0000u, 0xffffffffu, 0x00003fffu, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xf9ffff7fu, 0xffff07dbu, 0xffffffffu, 0x00003fffu, /* Word */
+
+/* block 261 */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0x00008000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Word */
+
+/* block 262 */
+  0xffffffffu, 0x3f801fffu, 0x00004000u, 0x00000000u, /* L */
+  0x00000000u, 0x00000000u, 0x000003ffu, 0x00000000u, /* Nd */
+  0xffffffffu, 0x3f801fffu, 0x000043ffu, 0x00000000u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xffffffffu, 0x3fff1fffu, 0x000043ffu, 0x00000000u, /* Word */
+
+/* block 263 */
+  0xffff0000u, 0x00003fffu, 0xffffffffu, 0x00000fffu, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x03ff0000u, /* Nd */
+  0xffff0000u, 0x00003fffu, 0xffffffffu, 0x03ff0fffu, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xffff0000u, 0x00007fffu, 0xffffffffu, 0x03ffffffu, /* Word */
+
+/* block 264 */
+  0x00000000u, 0x00000000u, 0xffff0000u, 0x00000fffu, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x03ff0000u, /* Nd */
+  0x00000000u, 0x00000000u, 0xffff0000u, 0x03ff0fffu, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0x00000000u, 0x00000000u, 0xffff0000u, 0x03ffffffu, /* Word */
+
+/* block 265 */
+  0x00000000u, 0x00000000u, 0xffff0000u, 0x00013fffu, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x07fe0000u, /* Nd */
+  0x00000000u, 0x00000000u, 0xffff0000u, 0x07ff3fffu, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0x00000000u, 0x00000000u, 0xffff0000u, 0x07ffffffu, /* Word */
+
+/* block 266 */
+  0x00000000u, 0x00000000u, 0x7fffffffu, 0xc01f3fb7u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0x00000000u, 0x00000000u, 0x7fffffffu, 0xc01f3fb7u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0x00000000u, 0x00000000u, 0x7fffffffu, 0xc03fffffu, /* Word */
+
+/* block 267 */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x7fff6f7fu, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x7fff6f7fu, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x7fff6f7fu, /* Word */
+
+/* block 268 */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu, /* Word */
+
+/* block 269 */
+  0xffffffffu, 0xffffffffu, 0x0000001fu, 0x00000000u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0xffffffffu, 0xffffffffu, 0x0000ff9fu, 0x00000000u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xffffffffu, 0xffffffffu, 0x007fff9fu, 0x00000000u, /* Word */
+
+/* block 270 */
+  0xffffffffu, 0xffffffffu, 0x0000080fu, 0x00000000u, /* L */
+  0x00000000u, 0x00000000u, 0x03ff0000u, 0x00000000u, /* Nd */
+  0xffffffffu, 0xffffffffu, 0x03ff080fu, 0x00000000u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xffffffffu, 0xffffffffu, 0x03ff0fffu, 0x00000000u, /* Word */
+
+/* block 271 */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Word */
+
+/* block 272 */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0x00000000u, 0x00000000u, 0x00000000u, 0xfffe0000u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0x00000000u, 0x00000000u, 0x00000000u, 0xfffe0000u, /* Word */
+
+/* block 273 */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0xffffffffu, 0x001eefffu, 0x00000000u, 0x00000000u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xffffffffu, 0x001eefffu, 0x00000000u, 0x00000000u, /* Word */
+
+/* block 274 */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0xfffffffeu, 0x3fffbfffu, 0x00000000u, 0x00000000u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xfffffffeu, 0x3fffbfffu, 0x00000000u, 0x00000000u, /* Word */
+
+/* block 275 */
+  0xffffffefu, 0x0af7fe96u, 0xaa96ea84u, 0x5ef7f796u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0xffffffefu, 0x0af7fe96u, 0xaa96ea84u, 0x5ef7f796u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xffffffefu, 0x0af7fe96u, 0xaa96ea84u, 0x5ef7f796u, /* Word */
+
+/* block 276 */
+  0x0ffffbffu, 0x0ffffbeeu, 0x00000000u, 0x00000000u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0x0ffffbffu, 0x0ffffbeeu, 0x00000000u, 0x00000000u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0x0ffffbffu, 0x0ffffbeeu, 0x00000000u, 0x00000000u, /* Word */
+
+/* block 277 */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Word */
+
+/* block 278 */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Word */
+
+/* block 279 */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0x00001fffu, 0x00000000u, 0x00000000u, 0x00000000u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0x00001fffu, 0x00000000u, 0x00000000u, 0x00000000u, /* Word */
+
+/* block 280 */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Word */
+
+/* block 281 */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Word */
+
+/* block 282 */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Word */
+
+/* block 283 */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Word */
+
+/* block 284 */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Word */
+
+/* block 285 */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Word */
+
+/* block 286 */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Word */
+
+/* block 287 */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Word */
+
+/* block 288 */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Word */
+
+/* block 289 */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Word */
+
+/* block 290 */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Word */
+
+/* block 291 */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Word */
+
+/* block 292 */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Word */
+
+/* block 293 */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Word */
+
+/* block 294 */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Word */
+
+/* block 295 */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Word */
+
+/* block 296 */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Word */
+
+/* block 297 */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Word */
+
+/* block 298 */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x03ff0000u, /* Nd */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x03ff0000u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x03ff0000u, /* Word */
+
+/* block 299 */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Word */
+
+/* block 300 */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0x00000000u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0x00000000u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0x00000000u, /* Word */
+
+/* block 301 */
+  0x3fffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0x3fffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0x3fffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu, /* Word */
+
+/* block 302 */
+  0xffffffffu, 0xffff3fffu, 0xffffffffu, 0xffffffffu, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0xffffffffu, 0xffff3fffu, 0xffffffffu, 0xffffffffu, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xffffffffu, 0xffff3fffu, 0xffffffffu, 0xffffffffu, /* Word */
+
+/* block 303 */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffff0001u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffff0001u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffff0001u, /* Word */
+
+/* block 304 */
+  0xffffffffu, 0xffffffffu, 0x3fffffffu, 0x00000000u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0xffffffffu, 0xffffffffu, 0x3fffffffu, 0x00000000u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xffffffffu, 0xffffffffu, 0x3fffffffu, 0x00000000u, /* Word */
+
+/* block 305 */
+  0x3fffffffu, 0x00000000u, 0x00000000u, 0x00000000u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0x3fffffffu, 0x00000000u, 0x00000000u, 0x00000000u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0x3fffffffu, 0x00000000u, 0x00000000u, 0x00000000u, /* Word */
+
+/* block 306 */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Word */
+
+/* block 307 */
+  0xffffffffu, 0xffffffffu, 0xffff07ffu, 0xffffffffu, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0xffffffffu, 0xffffffffu, 0xffff07ffu, 0xffffffffu, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xffffffffu, 0xffffffffu, 0xffff07ffu, 0xffffffffu, /* Word */
+
+/* block 308 */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0x03ffffffu, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0x03ffffffu, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0x03ffffffu, /* Word */
+
+/* block 309 */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Word */
+
+/* block 310 */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Word */
+
+/* block 311 */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu, /* Word */
+
+/* block 312 */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0xffffffffu, 0xffffffffu, 0xffffffffu, 0x0000ffffu, /* Word */
+
+/* block 313 */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* L */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Nd */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Alnum */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Space */
+  0x00000000u, 0x00000000u, 0x00000000u, 0x00000000u, /* Word */
+};
+
+/* This table contains the same bitsets for the ASCII characters, as 16-byte
+maps in which byte n holds the bits for characters 8n to 8n+7, in the same
+order. It is used to skip quickly over runs of ASCII characters. */
+
+const uint8_t PRIV(ucd_propbits_ascii)[] = {
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xfe,0xff,0xff,0x07,0xfe,0xff,0xff,0x07, /* L */
+  0x00,0x00,0x00,0x00,0x00,0x00,0xff,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, /* Nd */
+  0x00,0x00,0x00,0x00,0x00,0x00,0xff,0x03,0xfe,0xff,0xff,0x07,0xfe,0xff,0xff,0x07, /* Alnum */
+  0x00,0x3e,0x00,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00, /* Space */
+  0x00,0x00,0x00,0x00,0x00,0x00,0xff,0x03,0xfe,0xff,0xff,0x87,0xfe,0xff,0xff,0x07, /* Word */
+};
+
+#if UCD_PROPBITS_COUNT != 5
+#error Please correct UCD_PROPBITS_COUNT in pcre2_internal.h
+#endif
+
 #if UCD_BLOCK_SIZE != 128
 #error Please correct UCD_BLOCK_SIZE in pcre2_internal.h
 #endif
@@ -110,12 +110,12 @@ if (*data == XCL_PROP || *data == XCL_NOTPROP)
       break;
 
       case PT_GC:
-      if ((data[1] == PRIV(ucp_gentype)[prop->chartype]) == isprop)
+      if (UCD_CATEGORY_IS(c, data[1]) == isprop)
         return not_negated;
       break;
 
       case PT_PC:
-      if ((data[1] == prop->chartype) == isprop) return not_negated;
+      if (UCD_CHARTYPE_IS(c, data[1]) == isprop) return not_negated;
       break;
 
       case PT_SC:
@@ -129,10 +129,7 @@ if (*data == XCL_PROP || *data == XCL_NOTPROP)
       break;
 
       case PT_ALNUM:
-      chartype = prop->chartype;
-      if ((PRIV(ucp_gentype)[chartype] == ucp_L ||
-           PRIV(ucp_gentype)[chartype] == ucp_N) == isprop)
-        return not_negated;
+      if (UCD_PROPBIT(c, UCD_PROPBITS_ALNUM) == isprop) return not_negated;
       break;
 
       /* Perl space used to exclude VT, but from Perl 5.18 it is included,
@@ -141,26 +138,11 @@ if (*data == XCL_PROP || *data == XCL_NOTPROP)
 
       case PT_SPACE:    /* Perl space */
       case PT_PXSPACE:  /* POSIX space */
-      switch(c)
-        {
-        HSPACE_CASES:
-        VSPACE_CASES:
-        if (isprop) return not_negated;
-        break;
-
-        default:
-        if ((PRIV(ucp_gentype)[prop->chartype] == ucp_Z) == isprop)
-          return not_negated;
-        break;
-        }
+      if (UCD_PROPBIT(c, UCD_PROPBITS_SPACE) == isprop) return not_negated;
       break;
 
       case PT_WORD:
-      chartype = prop->chartype;
-      if ((PRIV(ucp_gentype)[chartype] == ucp_L ||
-           PRIV(ucp_gentype)[chartype] == ucp_N ||
-           chartype == ucp_Mn || chartype == ucp_Pc) == isprop)
-        return not_negated;
+      if (UCD_PROPBIT(c, UCD_PROPBITS_WORD) == isprop) return not_negated;
       break;
 
       case PT_UCNC:
@@ -317,6 +299,16 @@ data++;
 
 /* Align characters. */
 next_char = char_lists_end - (GET(data, 0) << 1);
+
+/* A two-level bitmap, if present, covers the 16 bit lists. */
+
+if ((type & XCL_BMPMAP) != 0 && c >= 256 && c < XCL_CHAR_LIST_LOW_32_START)
+  {
+  const uint8_t *index = next_char - XCL_BMPMAP_INDEX_SIZE;
+  const uint8_t *leaf = index - (index[c >> 8] + 1) * XCL_BMPMAP_LEAF_SIZE;
+  return ((leaf[(c >> 3) & 0x1f] & (1u << (c & 7))) != 0) == not_negated;
+  }
+
 type &= XCL_TYPE_MASK;
 
 /* Alignment check. */
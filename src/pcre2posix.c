@@ -322,9 +322,22 @@ if (preg->re_pcre2_code == NULL)
 (void)pcre2_pattern_info((const pcre2_code *)preg->re_pcre2_code,
   PCRE2_INFO_CAPTURECOUNT, &re_nsub);
 preg->re_nsub = (size_t)re_nsub;
-preg->re_match_data = pcre2_match_data_create(re_nsub + 1, NULL);
 preg->re_erroffset = (size_t)(-1);  /* No meaning after successful compile */
 
+/* A failure of JIT compilation, including the case when JIT support is not
+available, is not an error. The interpreter is then used for matching. */
+
+if ((cflags & REG_JIT) != 0)
+  (void)pcre2_jit_compile((pcre2_code *)preg->re_pcre2_code,
+    PCRE2_JIT_COMPLETE);
+
+/* With REG_THREADSAFE, pcre2_regexec() obtains a match data block for each
+call, so there is nothing shared to set up. */
+
+if ((cflags & REG_THREADSAFE) != 0) return 0;
+
+preg->re_match_data = pcre2_match_data_create(re_nsub + 1, NULL);
+
 if (preg->re_match_data == NULL)
   {
   /* There is no facility for passing a custom allocator to the POSIX API, so
@@ -348,8 +361,12 @@ return 0;
 
 /* A suitable match_data block, large enough to hold all possible captures, was
 obtained when the pattern was compiled, to save having to allocate and free it
-for each match. If REG_NOSUB was specified at compile time, the nmatch and
-pmatch arguments are ignored, and the only result is yes/no/error. */
+for each match. Because that block is written by each match, a regex_t cannot
+then be used by more than one thread at once. If REG_THREADSAFE was specified
+at compile time, a block that is just big enough for the captures that are
+wanted is obtained for each call instead. If REG_NOSUB was specified at compile
+time, the nmatch and pmatch arguments are ignored, and the only result is
+yes/no/error. */
 
 PCRE2POSIX_EXP_DEFN int PCRE2_CALL_CONVENTION
 pcre2_regexec(const regex_t *preg, const char *string, size_t nmatch,
@@ -388,15 +405,25 @@ else
   eo = (int)strlen(string);
   }
 
+if ((preg->re_cflags & REG_THREADSAFE) != 0)
+  {
+  md = pcre2_match_data_create((nmatch == 0)? 1 :
+    (nmatch > preg->re_nsub)? (uint32_t)preg->re_nsub + 1 : (uint32_t)nmatch,
+    NULL);
+  if (md == NULL) return REG_ESPACE;
+  }
+
 rc = pcre2_match((const pcre2_code *)preg->re_pcre2_code,
   (PCRE2_SPTR)string + so, (eo - so), 0, options, md, NULL);
 
-/* Successful match */
+/* Successful match. A zero return means that the vector was too small for all
+the captures, which can happen only with a per-call block. */
 
 if (rc >= 0)
   {
   size_t i;
   PCRE2_SIZE *ovector = pcre2_get_ovector_pointer(md);
+  if (rc == 0) rc = (int)pcre2_get_ovector_count(md);
   if ((size_t)rc > nmatch) rc = (int)nmatch;
   for (i = 0; i < (size_t)rc; i++)
     {
@@ -406,33 +433,36 @@ if (rc >= 0)
       (int)(ovector[i*2+1] + so);
     }
   for (; i < nmatch; i++) pmatch[i].rm_so = pmatch[i].rm_eo = -1;
-  return 0;
+  rc = 0;
   }
 
 /* Unsuccessful match */
 
-if (rc <= PCRE2_ERROR_UTF8_ERR1 && rc >= PCRE2_ERROR_UTF8_ERR21)
-  return REG_INVARG;
+else if (rc <= PCRE2_ERROR_UTF8_ERR1 && rc >= PCRE2_ERROR_UTF8_ERR21)
+  rc = REG_INVARG;
 
 /* Most of these are events that won't occur during testing, so exclude them
 from coverage. */
 
-switch(rc)
+else switch(rc)
   {
-  case PCRE2_ERROR_HEAPLIMIT: return REG_ESPACE;
-  case PCRE2_ERROR_NOMATCH: return REG_NOMATCH;
+  case PCRE2_ERROR_HEAPLIMIT: rc = REG_ESPACE; break;
+  case PCRE2_ERROR_NOMATCH: rc = REG_NOMATCH; break;
 
   /* LCOV_EXCL_START */
-  case PCRE2_ERROR_BADMODE: return REG_INVARG;
-  case PCRE2_ERROR_BADMAGIC: return REG_INVARG;
-  case PCRE2_ERROR_BADOPTION: return REG_INVARG;
-  case PCRE2_ERROR_BADUTFOFFSET: return REG_INVARG;
-  case PCRE2_ERROR_MATCHLIMIT: return REG_ESPACE;
-  case PCRE2_ERROR_NOMEMORY: return REG_ESPACE;
-  case PCRE2_ERROR_NULL: return REG_INVARG;
-  default: return REG_ASSERT;
+  case PCRE2_ERROR_BADMODE: rc = REG_INVARG; break;
+  case PCRE2_ERROR_BADMAGIC: rc = REG_INVARG; break;
+  case PCRE2_ERROR_BADOPTION: rc = REG_INVARG; break;
+  case PCRE2_ERROR_BADUTFOFFSET: rc = REG_INVARG; break;
+  case PCRE2_ERROR_MATCHLIMIT: rc = REG_ESPACE; break;
+  case PCRE2_ERROR_NOMEMORY: rc = REG_ESPACE; break;
+  case PCRE2_ERROR_NULL: rc = REG_INVARG; break;
+  default: rc = REG_ASSERT; break;
   /* LCOV_EXCL_STOP */
   }
+
+if (md != preg->re_match_data) pcre2_match_data_free(md);
+return rc;
 }
 
 /* End of pcre2posix.c */
@@ -68,6 +68,8 @@ extern "C" {
 #define REG_UCP       0x0400  /* NOT defined by POSIX; maps to PCRE2_UCP */
 #define REG_PEND      0x0800  /* GNU feature: pass end pattern by re_endp */
 #define REG_NOSPEC    0x1000  /* Maps to PCRE2_LITERAL */
+#define REG_JIT       0x2000  /* NOT defined by POSIX; use JIT if available */
+#define REG_THREADSAFE 0x4000 /* NOT defined by POSIX; no shared match data */
 
 /* This is not used by PCRE2, but by defining it we make it easier
 to slot PCRE2 into existing programs that make POSIX calls. */
@@ -83,6 +83,18 @@ from www.cbttape.org. */
 #include <unistd.h>
 #endif
 
+/* Hardware counters for -tsp are read using the Linux perf_event_open()
+system call, which has no library wrapper. */
+
+#if defined HAVE_LINUX_PERF_EVENT_H && defined HAVE_UNISTD_H
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#ifdef SYS_perf_event_open
+#define SUPPORT_PERF_COUNTERS
+#endif
+#endif
+
 /* Debugging code enabler */
 
 /* #define DEBUG_SHOW_MALLOC_ADDRESSES */
@@ -224,9 +236,12 @@ claim to be C99 don't support it (hence DISABLE_PERCENT_ZT). */
 #define JUNK_OFFSET 0xdeadbeef    /* For initializing ovector */
 #define LOCALESIZE 32             /* Size of locale name */
 #define LOOPREPEAT 500000         /* Default loop count for timing */
+#define STATSAMPLES 100           /* Default sample count for -ts */
+#define STATSAMPLE_NS 50000.0     /* Minimum length of a -ts sample */
 #define MALLOCLISTSIZE 20         /* For remembering mallocs */
 #define PARENS_NEST_DEFAULT 220   /* Default parentheses nest limit */
 #define PATSTACKSIZE 20           /* Pattern stack for save/restore testing */
+#define REGIONLISTSIZE 20         /* Regions loaded by #loadregion */
 #define REPLACE_MODSIZE 100       /* Field for reading 8-bit replacement */
 #define SUBSTITUTE_SUBJECT_MODSIZE 100 /* Field for reading 8-bit subject for substitute */
 #define REPLACE_BUFFSIZE 256      /* Code units for replacement buffer */
@@ -450,15 +465,16 @@ typedef struct cmdstruct {
   int  value;
 } cmdstruct;
 
-enum { CMD_ENDIF, CMD_FORBID_UTF, CMD_IF, CMD_LOAD, CMD_LOADTABLES,
-  CMD_NEWLINE_DEFAULT, CMD_PATTERN, CMD_PERLTEST, CMD_POP, CMD_POPCOPY,
-  CMD_SAVE, CMD_SUBJECT, CMD_UNKNOWN };
+enum { CMD_ENDIF, CMD_FORBID_UTF, CMD_IF, CMD_LOAD, CMD_LOADREGION,
+  CMD_LOADTABLES, CMD_NEWLINE_DEFAULT, CMD_PATTERN, CMD_PERLTEST, CMD_POP,
+  CMD_POPCOPY, CMD_SAVE, CMD_SAVEREGION, CMD_SUBJECT, CMD_UNKNOWN };
 
 static cmdstruct cmdlist[] = {
   { "endif",           CMD_ENDIF },
   { "forbid_utf",      CMD_FORBID_UTF },
   { "if",              CMD_IF },
   { "load",            CMD_LOAD },
+  { "loadregion",      CMD_LOADREGION },
   { "loadtables",      CMD_LOADTABLES },
   { "newline_default", CMD_NEWLINE_DEFAULT },
   { "pattern",         CMD_PATTERN },
@@ -466,6 +482,7 @@ static cmdstruct cmdlist[] = {
   { "pop",             CMD_POP },
   { "popcopy",         CMD_POPCOPY },
   { "save",            CMD_SAVE },
+  { "saveregion",      CMD_SAVEREGION },
   { "subject",         CMD_SUBJECT }};
 
 #define cmdlistcount (sizeof(cmdlist)/sizeof(cmdstruct))
@@ -584,6 +601,14 @@ so many of them that they are split into two fields. */
 #define CTL2_FRAMESIZE                   0x00008000u
 #define CTL2_SUBSTITUTE_CASE_CALLOUT     0x00010000u
 #define CTL2_NULL_SUBSTITUTE_MATCH_DATA  0x00020000u
+#define CTL2_FRAME_POOL                  0x00040000u
+#define CTL2_COMPILE_ARENA               0x00080000u
+#define CTL2_SUBSTITUTE_COMPILED         0x00100000u
+#define CTL2_SUBSTITUTE_OUTPUT           0x00200000u
+#define CTL2_DFA_WORKSPACE               0x00400000u
+#define CTL2_GLOB_NATIVE                 0x00800000u
+#define CTL2_POSIX_THREADSAFE            0x01000000u
+#define CTL2_PROFILE                     0x02000000u
 
 #define CTL2_HEAPFRAMES_SIZE             0x20000000u  /* Informational */
 #define CTL2_NL_SET                      0x40000000u  /* Informational */
@@ -614,8 +639,12 @@ different things in the two cases. */
                     CTL2_SUBSTITUTE_UNSET_EMPTY|\
                     CTL2_ALLVECTOR|\
                     CTL2_SUBSTITUTE_CASE_CALLOUT|\
+                    CTL2_SUBSTITUTE_COMPILED|\
+                    CTL2_SUBSTITUTE_OUTPUT|\
                     CTL2_NULL_SUBSTITUTE_MATCH_DATA|\
-                    CTL2_HEAPFRAMES_SIZE)
+                    CTL2_FRAME_POOL|\
+                    CTL2_HEAPFRAMES_SIZE|\
+                    CTL2_PROFILE)
 
 /* Structures for holding modifier information for patterns and subject strings
 (data). Fields containing modifiers that can be set either for a pattern or a
@@ -660,6 +689,8 @@ typedef struct datctl {        /* Structure for data line modifiers. */
    int32_t   copy_numbers[MAXCPYGET];
    int32_t   get_numbers[MAXCPYGET];
   uint32_t   oveccount;
+  uint32_t   match_all;
+  uint32_t   median_max;
   PCRE2_SIZE offset;
   uint8_t    copy_names[LENCPYGET];
   uint8_t    get_names[LENCPYGET];
@@ -766,6 +797,7 @@ static modstruct modlist[] = {
   { "callout_none",                MOD_DAT,  MOD_CTL, CTL_CALLOUT_NONE,           DO(control) },
   { "caseless",                    MOD_PATP, MOD_OPT, PCRE2_CASELESS,             PO(options) },
   { "caseless_restrict",           MOD_CTC,  MOD_OPT, PCRE2_EXTRA_CASELESS_RESTRICT, CO(extra_options) },
+  { "compile_arena",               MOD_PAT,  MOD_CTL, CTL2_COMPILE_ARENA,         PO(control2) },
   { "convert",                     MOD_PAT,  MOD_CON, 0,                          PO(convert_type) },
   { "convert_glob_escape",         MOD_PAT,  MOD_CHR, 0,                          PO(convert_glob_escape) },
   { "convert_glob_separator",      MOD_PAT,  MOD_CHR, 0,                          PO(convert_glob_separator) },
@@ -775,8 +807,10 @@ static modstruct modlist[] = {
   { "debug",                       MOD_PAT,  MOD_CTL, CTL_DEBUG,                  PO(control) },
   { "depth_limit",                 MOD_CTM,  MOD_INT, 0,                          MO(depth_limit) },
   { "dfa",                         MOD_DAT,  MOD_CTL, CTL_DFA,                    DO(control) },
+  { "dfa_bitparallel",             MOD_CTC,  MOD_OPT, PCRE2_EXTRA_DFA_BITPARALLEL, CO(extra_options) },
   { "dfa_restart",                 MOD_DAT,  MOD_OPT, PCRE2_DFA_RESTART,          DO(options) },
   { "dfa_shortest",                MOD_DAT,  MOD_OPT, PCRE2_DFA_SHORTEST,         DO(options) },
+  { "dfa_workspace",               MOD_DAT,  MOD_CTL, CTL2_DFA_WORKSPACE,         DO(control2) },
   { "disable_recurseloop_check",   MOD_DAT,  MOD_OPT, PCRE2_DISABLE_RECURSELOOP_CHECK, DO(options) },
   { "dollar_endonly",              MOD_PAT,  MOD_OPT, PCRE2_DOLLAR_ENDONLY,       PO(options) },
   { "dotall",                      MOD_PATP, MOD_OPT, PCRE2_DOTALL,               PO(options) },
@@ -792,10 +826,12 @@ static modstruct modlist[] = {
   { "find_limits",                 MOD_DAT,  MOD_CTL, CTL_FINDLIMITS,             DO(control) },
   { "find_limits_noheap",          MOD_DAT,  MOD_CTL, CTL_FINDLIMITS_NOHEAP,      DO(control) },
   { "firstline",                   MOD_PAT,  MOD_OPT, PCRE2_FIRSTLINE,            PO(options) },
+  { "frame_pool",                  MOD_PND,  MOD_CTL, CTL2_FRAME_POOL,            PO(control2) },
   { "framesize",                   MOD_PAT,  MOD_CTL, CTL2_FRAMESIZE,             PO(control2) },
   { "fullbincode",                 MOD_PAT,  MOD_CTL, CTL_FULLBINCODE,            PO(control) },
   { "get",                         MOD_DAT,  MOD_NN,  DO(get_numbers),            DO(get_names) },
   { "getall",                      MOD_DAT,  MOD_CTL, CTL_GETALL,                 DO(control) },
+  { "glob_native",                 MOD_PAT,  MOD_CTL, CTL2_GLOB_NATIVE,           PO(control2) },
   { "global",                      MOD_PNDP, MOD_CTL, CTL_GLOBAL,                 PO(control) },
   { "heap_limit",                  MOD_CTM,  MOD_INT, 0,                          MO(heap_limit) },
   { "heapframes_size",             MOD_PND,  MOD_CTL, CTL2_HEAPFRAMES_SIZE,       PO(control2) },
@@ -808,6 +844,7 @@ static modstruct modlist[] = {
   { "literal",                     MOD_PAT,  MOD_OPT, PCRE2_LITERAL,              PO(options) },
   { "locale",                      MOD_PATP, MOD_STR, LOCALESIZE,                 PO(locale) },
   { "mark",                        MOD_PNDP, MOD_CTL, CTL_MARK,                   PO(control) },
+  { "match_all",                   MOD_DAT,  MOD_INT, 0,                          DO(match_all) },
   { "match_invalid_utf",           MOD_PAT,  MOD_OPT, PCRE2_MATCH_INVALID_UTF,    PO(options) },
   { "match_limit",                 MOD_CTM,  MOD_INT, 0,                          MO(match_limit) },
   { "match_line",                  MOD_CTC,  MOD_OPT, PCRE2_EXTRA_MATCH_LINE,     CO(extra_options) },
@@ -816,6 +853,7 @@ static modstruct modlist[] = {
   { "max_pattern_compiled_length", MOD_CTC,  MOD_SIZ, 0,                          CO(max_pattern_compiled_length) },
   { "max_pattern_length",          MOD_CTC,  MOD_SIZ, 0,                          CO(max_pattern_length) },
   { "max_varlookbehind",           MOD_CTC,  MOD_INT, 0,                          CO(max_varlookbehind) },
+  { "median_max",                  MOD_DAT,  MOD_INT, 0,                          DO(median_max) },
   { "memory",                      MOD_PD,   MOD_CTL, CTL_MEMORY,                 PO(control) },
   { "multiline",                   MOD_PATP, MOD_OPT, PCRE2_MULTILINE,            PO(options) },
   { "never_backslash_c",           MOD_PAT,  MOD_OPT, PCRE2_NEVER_BACKSLASH_C,    PO(options) },
@@ -826,6 +864,7 @@ static modstruct modlist[] = {
   { "no_auto_capture",             MOD_PAT,  MOD_OPT, PCRE2_NO_AUTO_CAPTURE,      PO(options) },
   { "no_auto_possess",             MOD_PATP, MOD_OPT, PCRE2_NO_AUTO_POSSESS,      PO(options) },
   { "no_bs0",                      MOD_CTC,  MOD_OPT, PCRE2_EXTRA_NO_BS0,         CO(extra_options) },
+  { "no_captures",                 MOD_DAT,  MOD_OPT, PCRE2_NO_CAPTURES,          DO(options) },
   { "no_dotstar_anchor",           MOD_PAT,  MOD_OPT, PCRE2_NO_DOTSTAR_ANCHOR,    PO(options) },
   { "no_jit",                      MOD_DATP, MOD_OPT, PCRE2_NO_JIT,               DO(options) },
   { "no_start_optimize",           MOD_PATP, MOD_OPT, PCRE2_NO_START_OPTIMIZE,    PO(options) },
@@ -841,6 +880,7 @@ static modstruct modlist[] = {
   { "null_substitute_match_data",  MOD_PND,  MOD_CTL, CTL2_NULL_SUBSTITUTE_MATCH_DATA, PO(control2) },
   { "offset",                      MOD_DAT,  MOD_SIZ, 0,                          DO(offset) },
   { "offset_limit",                MOD_CTM,  MOD_SIZ, 0,                          MO(offset_limit)},
+  { "onepass",                     MOD_CTC,  MOD_OPT, PCRE2_EXTRA_ONEPASS,        CO(extra_options) },
   { "optimization_full",           MOD_CTC,  MOD_OPTMZ, PCRE2_OPTIMIZATION_FULL,  0 },
   { "optimization_none",           MOD_CTC,  MOD_OPTMZ, PCRE2_OPTIMIZATION_NONE,  0 },
   { "ovector",                     MOD_DAT,  MOD_INT, 0,                          DO(oveccount) },
@@ -851,6 +891,8 @@ static modstruct modlist[] = {
   { "posix",                       MOD_PAT,  MOD_CTL, CTL_POSIX,                  PO(control) },
   { "posix_nosub",                 MOD_PAT,  MOD_CTL, CTL_POSIX|CTL_POSIX_NOSUB,  PO(control) },
   { "posix_startend",              MOD_DAT,  MOD_IN2, 0,                          DO(startend) },
+  { "posix_threadsafe",            MOD_PAT,  MOD_CTL, CTL2_POSIX_THREADSAFE,      PO(control2) },
+  { "profile",                     MOD_PND,  MOD_CTL, CTL2_PROFILE,               PO(control2) },
   { "ps",                          MOD_DAT,  MOD_OPT, PCRE2_PARTIAL_SOFT,         DO(options) },
   { "push",                        MOD_PAT,  MOD_CTL, CTL_PUSH,                   PO(control) },
   { "pushcopy",                    MOD_PAT,  MOD_CTL, CTL_PUSHCOPY,               PO(control) },
@@ -867,9 +909,11 @@ static modstruct modlist[] = {
   { "subject_literal",             MOD_PATP, MOD_CTL, CTL2_SUBJECT_LITERAL,       PO(control2) },
   { "substitute_callout",          MOD_PND,  MOD_CTL, CTL2_SUBSTITUTE_CALLOUT,    PO(control2) },
   { "substitute_case_callout",     MOD_PND,  MOD_CTL, CTL2_SUBSTITUTE_CASE_CALLOUT, PO(control2) },
+  { "substitute_compiled",         MOD_PND,  MOD_CTL, CTL2_SUBSTITUTE_COMPILED,   PO(control2) },
   { "substitute_extended",         MOD_PND,  MOD_CTL, CTL2_SUBSTITUTE_EXTENDED,   PO(control2) },
   { "substitute_literal",          MOD_PND,  MOD_CTL, CTL2_SUBSTITUTE_LITERAL,    PO(control2) },
   { "substitute_matched",          MOD_PND,  MOD_CTL, CTL2_SUBSTITUTE_MATCHED,    PO(control2) },
+  { "substitute_output",           MOD_PND,  MOD_CTL, CTL2_SUBSTITUTE_OUTPUT,     PO(control2) },
   { "substitute_overflow_length",  MOD_PND,  MOD_CTL, CTL2_SUBSTITUTE_OVERFLOW_LENGTH, PO(control2) },
   { "substitute_replacement_only", MOD_PND,  MOD_CTL, CTL2_SUBSTITUTE_REPLACEMENT_ONLY, PO(control2) },
   { "substitute_skip",             MOD_PND,  MOD_INT, 0,                          PO(substitute_skip) },
@@ -902,7 +946,7 @@ static modstruct modlist[] = {
   CTL_AFTERTEXT|CTL_ALLAFTERTEXT|CTL_EXPAND|CTL_HEXPAT|CTL_POSIX| \
   CTL_POSIX_NOSUB|CTL_USE_LENGTH)
 
-#define POSIX_SUPPORTED_COMPILE_CONTROLS2 (0)
+#define POSIX_SUPPORTED_COMPILE_CONTROLS2 (CTL2_POSIX_THREADSAFE)
 
 #define POSIX_SUPPORTED_MATCH_OPTIONS ( \
   PCRE2_NOTBOL|PCRE2_NOTEMPTY|PCRE2_NOTEOL)
@@ -918,7 +962,7 @@ static modstruct modlist[] = {
   CTL_PUSHTABLESCOPY|CTL_USE_LENGTH)
 
 #define PUSH_SUPPORTED_COMPILE_CONTROLS2 (CTL2_BSR_SET| \
-  CTL2_HEAPFRAMES_SIZE|CTL2_FRAMESIZE|CTL2_NL_SET)
+  CTL2_COMPILE_ARENA|CTL2_HEAPFRAMES_SIZE|CTL2_FRAMESIZE|CTL2_NL_SET)
 
 /* Controls that apply only at compile time with 'push'. */
 
@@ -1041,6 +1085,7 @@ static coptstruct coptlist[] = {
   { "pcre2-16",    CONF_FIX, SUPPORT_16 },
   { "pcre2-32",    CONF_FIX, SUPPORT_32 },
   { "pcre2-8",     CONF_FIX, SUPPORT_8 },
+  { "profile",     CONF_INT, PCRE2_CONFIG_PROFILE },
   { "unicode",     CONF_INT, PCRE2_CONFIG_UNICODE }
 };
 
@@ -1079,6 +1124,10 @@ static BOOL malloc_testing = FALSE;
 static int jitrc;                             /* Return from JIT compile */
 static int timeit = 0;
 static int timeitm = 0;
+static int timestats = 0;
+static int regioncount = 0;
+static uint8_t *regionlist[REGIONLISTSIZE];
+static BOOL timestats_counters = FALSE;
 static int mallocs_until_failure = INT_MAX;
 static int mallocs_called = 0;
 
@@ -1109,6 +1158,8 @@ static regex_t preg = { NULL, NULL, 0, 0, 0, 0 };
 #endif
 
 static int *dfa_workspace = NULL;
+static PCRE2_SIZE *profile_counts = NULL;
+static PCRE2_SIZE profile_counts_size = 0;
 static const uint8_t *locale_tables = NULL;
 static const uint8_t *use_tables = NULL;
 static uint8_t locale_name[LOCALESIZE];
@@ -2406,7 +2457,7 @@ Returns:      nothing
 static void
 show_controls(int clr, uint32_t controls, uint32_t controls2, const char *before)
 {
-cfprintf(clr, outfile, "%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s",
+cfprintf(clr, outfile, "%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s",
   before,
   ((controls & CTL_AFTERTEXT) != 0)? " aftertext" : "",
   ((controls & CTL_ALLAFTERTEXT) != 0)? " allaftertext" : "",
@@ -2420,14 +2471,18 @@ cfprintf(clr, outfile, "%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s
   ((controls2 & CTL2_CALLOUT_EXTRA) != 0)? " callout_extra" : "",
   ((controls & CTL_CALLOUT_INFO) != 0)? " callout_info" : "",
   ((controls & CTL_CALLOUT_NONE) != 0)? " callout_none" : "",
+  ((controls2 & CTL2_COMPILE_ARENA) != 0)? " compile_arena" : "",
   ((controls2 & CTL2_CALLOUT_NO_WHERE) != 0)? " callout_no_where" : "",
   ((controls & CTL_DFA) != 0)? " dfa" : "",
+  ((controls2 & CTL2_DFA_WORKSPACE) != 0)? " dfa_workspace" : "",
   ((controls & CTL_EXPAND) != 0)? " expand" : "",
   ((controls & CTL_FINDLIMITS) != 0)? " find_limits" : "",
   ((controls & CTL_FINDLIMITS_NOHEAP) != 0)? " find_limits_noheap" : "",
+  ((controls2 & CTL2_FRAME_POOL) != 0)? " frame_pool" : "",
   ((controls2 & CTL2_FRAMESIZE) != 0)? " framesize" : "",
   ((controls & CTL_FULLBINCODE) != 0)? " fullbincode" : "",
   ((controls & CTL_GETALL) != 0)? " getall" : "",
+  ((controls2 & CTL2_GLOB_NATIVE) != 0)? " glob_native" : "",
   ((controls & CTL_GLOBAL) != 0)? " global" : "",
   ((controls2 & CTL2_HEAPFRAMES_SIZE) != 0)? " heapframes_size" : "",
   ((controls & CTL_HEXPAT) != 0)? " hex" : "",
@@ -2443,15 +2498,19 @@ cfprintf(clr, outfile, "%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s
   ((controls2 & CTL2_NULL_SUBSTITUTE_MATCH_DATA) != 0)? " null_substitute_match_data" : "",
   ((controls & CTL_POSIX) != 0)? " posix" : "",
   ((controls & CTL_POSIX_NOSUB) != 0)? " posix_nosub" : "",
+  ((controls2 & CTL2_POSIX_THREADSAFE) != 0)? " posix_threadsafe" : "",
+  ((controls2 & CTL2_PROFILE) != 0)? " profile" : "",
   ((controls & CTL_PUSH) != 0)? " push" : "",
   ((controls & CTL_PUSHCOPY) != 0)? " pushcopy" : "",
   ((controls & CTL_PUSHTABLESCOPY) != 0)? " pushtablescopy" : "",
   ((controls & CTL_STARTCHAR) != 0)? " startchar" : "",
   ((controls2 & CTL2_SUBSTITUTE_CALLOUT) != 0)? " substitute_callout" : "",
   ((controls2 & CTL2_SUBSTITUTE_CASE_CALLOUT) != 0)? " substitute_case_callout" : "",
+  ((controls2 & CTL2_SUBSTITUTE_COMPILED) != 0)? " substitute_compiled" : "",
   ((controls2 & CTL2_SUBSTITUTE_EXTENDED) != 0)? " substitute_extended" : "",
   ((controls2 & CTL2_SUBSTITUTE_LITERAL) != 0)? " substitute_literal" : "",
   ((controls2 & CTL2_SUBSTITUTE_MATCHED) != 0)? " substitute_matched" : "",
+  ((controls2 & CTL2_SUBSTITUTE_OUTPUT) != 0)? " substitute_output" : "",
   ((controls2 & CTL2_SUBSTITUTE_OVERFLOW_LENGTH) != 0)? " substitute_overflow_length" : "",
   ((controls2 & CTL2_SUBSTITUTE_REPLACEMENT_ONLY) != 0)? " substitute_replacement_only" : "",
   ((controls2 & CTL2_SUBSTITUTE_UNKNOWN_UNSET) != 0)? " substitute_unknown_unset" : "",
@@ -2539,7 +2598,7 @@ show_compile_extra_options(int clr, uint32_t options, const char *before,
   const char *after)
 {
 if (options == 0) cfprintf(clr, outfile, "%s <none>%s", before, after);
-else cfprintf(clr, outfile, "%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s",
+else cfprintf(clr, outfile, "%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s",
   before,
   ((options & PCRE2_EXTRA_ALLOW_LOOKAROUND_BSK) != 0) ? " allow_lookaround_bsk" : "",
   ((options & PCRE2_EXTRA_ALLOW_SURROGATE_ESCAPES) != 0)? " allow_surrogate_escapes" : "",
@@ -2551,11 +2610,13 @@ else cfprintf(clr, outfile, "%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s",
   ((options & PCRE2_EXTRA_ASCII_POSIX) != 0)? " ascii_posix" : "",
   ((options & PCRE2_EXTRA_BAD_ESCAPE_IS_LITERAL) != 0)? " bad_escape_is_literal" : "",
   ((options & PCRE2_EXTRA_CASELESS_RESTRICT) != 0)? " caseless_restrict" : "",
+  ((options & PCRE2_EXTRA_DFA_BITPARALLEL) != 0)? " dfa_bitparallel" : "",
   ((options & PCRE2_EXTRA_ESCAPED_CR_IS_LF) != 0)? " escaped_cr_is_lf" : "",
   ((options & PCRE2_EXTRA_MATCH_WORD) != 0)? " match_word" : "",
   ((options & PCRE2_EXTRA_MATCH_LINE) != 0)? " match_line" : "",
   ((options & PCRE2_EXTRA_NEVER_CALLOUT) != 0)? " never_callout" : "",
   ((options & PCRE2_EXTRA_NO_BS0) != 0)? " no_bs0" : "",
+  ((options & PCRE2_EXTRA_ONEPASS) != 0)? " onepass" : "",
   ((options & PCRE2_EXTRA_PYTHON_OCTAL) != 0)? " python_octal" : "",
   ((options & PCRE2_EXTRA_TURKISH_CASING) != 0)? " turkish_casing" : "",
   after);
@@ -2601,13 +2662,14 @@ else cfprintf(clr, outfile, "%s%s%s%s%s%s%s",
 static void
 show_match_options(int clr, uint32_t options)
 {
-cfprintf(clr, outfile, "%s%s%s%s%s%s%s%s%s%s%s%s%s%s",
+cfprintf(clr, outfile, "%s%s%s%s%s%s%s%s%s%s%s%s%s%s%s",
   ((options & PCRE2_ANCHORED) != 0)? " anchored" : "",
   ((options & PCRE2_COPY_MATCHED_SUBJECT) != 0)? " copy_matched_subject" : "",
   ((options & PCRE2_DFA_RESTART) != 0)? " dfa_restart" : "",
   ((options & PCRE2_DFA_SHORTEST) != 0)? " dfa_shortest" : "",
   ((options & PCRE2_DISABLE_RECURSELOOP_CHECK) != 0)? " disable_recurseloop_check" : "",
   ((options & PCRE2_ENDANCHORED) != 0)? " endanchored" : "",
+  ((options & PCRE2_NO_CAPTURES) != 0)? " no_captures" : "",
   ((options & PCRE2_NO_JIT) != 0)? " no_jit" : "",
   ((options & PCRE2_NO_UTF_CHECK) != 0)? " no_utf_check" : "",
   ((options & PCRE2_NOTBOL) != 0)? " notbol" : "",
@@ -2832,6 +2894,218 @@ for (i = 0; i < 2*oveccount; i += 2)
 
 
 
+/*************************************************
+*            High-resolution clock               *
+*************************************************/
+
+/* Statistical timing uses a monotonic clock if there is one, and otherwise
+falls back to clock(). The number of samples is calibrated from the clock's
+resolution, so a coarse clock just makes each sample longer.
+
+Argument:   TRUE to return the resolution instead of the time
+Returns:    time or resolution in nanoseconds
+*/
+
+static double
+hr_clock(BOOL resolution)
+{
+#ifdef CLOCK_MONOTONIC
+struct timespec ts;
+if ((resolution? clock_getres(CLOCK_MONOTONIC, &ts) :
+                 clock_gettime(CLOCK_MONOTONIC, &ts)) == 0)
+  return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+#endif
+return resolution? 1e9 / CLOCKS_PER_SEC :
+  (double)clock() * (1e9 / CLOCKS_PER_SEC);
+}
+
+
+
+/*************************************************
+*       Hardware counters for -tsp timing        *
+*************************************************/
+
+/* The counters are opened as a group the first time they are needed. If that
+is not possible (no kernel support, or not permitted), a warning is given once
+and timing continues without them. Counters other than the first that cannot
+be opened are just left out. */
+
+#define PERF_COUNTERS 4
+
+static const char *perf_names[PERF_COUNTERS] = {
+  "cycles", "instructions", "branch_misses", "cache_misses" };
+
+#ifdef SUPPORT_PERF_COUNTERS
+static int perf_fds[PERF_COUNTERS];
+static int perf_open_count = -1;       /* -1 => not yet tried */
+
+static const uint64_t perf_configs[PERF_COUNTERS] = {
+  PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS,
+  PERF_COUNT_HW_BRANCH_MISSES, PERF_COUNT_HW_CACHE_MISSES };
+#endif
+
+
+/* Start counting.
+
+Arguments:  none
+Returns:    TRUE if counters are running
+*/
+
+static BOOL
+perf_start(void)
+{
+#ifdef SUPPORT_PERF_COUNTERS
+if (perf_open_count < 0)
+  {
+  int i;
+  perf_open_count = 0;
+  for (i = 0; i < PERF_COUNTERS; i++)
+    {
+    struct perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.size = sizeof(attr);
+    attr.config = perf_configs[i];
+    attr.disabled = (i == 0);
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    attr.read_format = PERF_FORMAT_GROUP;
+    perf_fds[i] = (int)syscall(SYS_perf_event_open, &attr, 0, -1,
+      (i == 0)? -1 : perf_fds[0], 0);
+    if (perf_fds[i] >= 0) perf_open_count++;
+      else if (i == 0) break;
+    }
+  }
+
+if (perf_open_count > 0)
+  {
+  (void)ioctl(perf_fds[0], PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+  (void)ioctl(perf_fds[0], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+  return TRUE;
+  }
+#endif
+
+if (timestats_counters)
+  {
+  cfprintf(clr_test_error, stderr,
+    "pcre2test: Warning: hardware counters are not available\n");
+  timestats_counters = FALSE;
+  }
+return FALSE;
+}
+
+
+/* Stop counting and read the counts. A counter that is not open is set to
+UINT64_MAX.
+
+Argument:   vector of PERF_COUNTERS values
+Returns:    nothing
+*/
+
+static void
+perf_stop(uint64_t *values)
+{
+int i;
+for (i = 0; i < PERF_COUNTERS; i++) values[i] = UINT64_MAX;
+
+#ifdef SUPPORT_PERF_COUNTERS
+  {
+  uint64_t buffer[1 + PERF_COUNTERS];
+  (void)ioctl(perf_fds[0], PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+  if (read(perf_fds[0], buffer, sizeof(buffer)) > 0)
+    {
+    uint64_t j = 1;
+    for (i = 0; i < PERF_COUNTERS && j <= buffer[0]; i++)
+      if (perf_fds[i] >= 0) values[i] = buffer[j++];
+    }
+  }
+#endif
+}
+
+
+
+/*************************************************
+*          Show timing statistics                *
+*************************************************/
+
+/* pcre2test is not linked with the maths library, so the standard deviation
+uses this simple Newton-Raphson square root. */
+
+static double
+square_root(double x)
+{
+int i;
+double r = (x > 1)? x : 1;
+if (x <= 0) return 0;
+for (i = 0; i < 64; i++)
+  {
+  double next = (r + x / r) / 2;
+  if (next >= r) break;
+  r = next;
+  }
+return r;
+}
+
+static int
+compare_doubles(const void *a, const void *b)
+{
+double x = *(const double *)a;
+double y = *(const double *)b;
+return (x < y)? -1 : (x > y)? 1 : 0;
+}
+
+/* The samples are times per match in nanoseconds. They are sorted here. The
+99th percentile uses the nearest-rank method. The output is a single line of
+name=value pairs that can be parsed by scripts.
+
+Arguments:
+  samples      vector of samples
+  count        number of samples
+  batch        number of matches in each sample
+  counters     hardware counts for all the samples, or NULL
+  show         TRUE to output the statistics
+
+Returns:       the median
+*/
+
+static double
+show_timing_statistics(double *samples, int count, uint32_t batch,
+  uint64_t *counters, BOOL show)
+{
+int i;
+double median, mean, variance;
+
+qsort(samples, count, sizeof(double), compare_doubles);
+median = ((count & 1) != 0)? samples[count/2] :
+  (samples[count/2 - 1] + samples[count/2]) / 2;
+
+if (!show) return median;
+
+for (i = 0, mean = 0; i < count; i++) mean += samples[i];
+mean /= count;
+for (i = 0, variance = 0; i < count; i++)
+  variance += (samples[i] - mean) * (samples[i] - mean);
+if (count > 1) variance /= count - 1;
+
+cfprintf(clr_profiling, outfile, "Match statistics: median_ns=%.1f "
+  "p99_ns=%.1f stddev_ns=%.1f min_ns=%.1f samples=%d batch=%u", median,
+  samples[(count * 99 + 99)/100 - 1], square_root(variance), samples[0], count,
+  batch);
+
+if (counters != NULL)
+  {
+  for (i = 0; i < PERF_COUNTERS; i++)
+    if (counters[i] != UINT64_MAX)
+      cfprintf(clr_profiling, outfile, " %s=%.1f", perf_names[i],
+        (double)counters[i] / ((double)count * batch));
+  }
+
+fprintf(outfile, "\n");
+return median;
+}
+
+
+
 /*************************************************
 *            Mode-dependent code                 *
 *************************************************/
@@ -3132,6 +3406,7 @@ printf("     newline        newline type [CR, LF, CRLF, ANYCRLF, ANY, NUL]\n");
 printf("     pcre2-8        8 bit library support enabled [0, 1]\n");
 printf("     pcre2-16       16 bit library support enabled [0, 1]\n");
 printf("     pcre2-32       32 bit library support enabled [0, 1]\n");
+printf("     profile        match profiling supported [0, 1]\n");
 printf("     unicode        Unicode and UTF support enabled [0, 1]\n");
 printf("  --colo[u]r[=<always,auto,never>]\n");
 printf("                show output in colour\n");
@@ -3150,12 +3425,15 @@ printf("  -LS           list supported scripts, then exit\n");
 printf("  -malloc       exercise malloc() failures\n");
 printf("  -q            quiet: do not output PCRE2 version number at start\n");
 printf("  -pattern <s>  set default pattern modifier fields\n");
+printf("  -profile      set default subject modifier 'profile'\n");
 printf("  -subject <s>  set default subject modifier fields\n");
 printf("  -S <n>        set stack size to <n> mebibytes\n");
 printf("  -t [<n>]      time compilation and execution, repeating <n> times\n");
 printf("  -tm [<n>]     time execution (matching) only, repeating <n> times\n");
 printf("  -T            same as -t, but show total times at the end\n");
 printf("  -TM           same as -tm, but show total time at the end\n");
+printf("  -ts [<n>]     show statistics of <n> timed samples of execution\n");
+printf("  -tsp [<n>]    same as -ts, but also show hardware counters\n");
 printf("  -unittest     run unit tests, then exit\n");
 printf("  -v|--version  show PCRE2 version and exit\n");
 }
@@ -3290,6 +3568,9 @@ if (optval & 4) printf("  32-bit support\n");
 printf("  Valgrind support\n");
 #endif
 
+(void)pcre2_config(PCRE2_CONFIG_PROFILE, &optval);
+if (optval != 0) printf("  Match profiling support\n");
+
 (void)pcre2_config(PCRE2_CONFIG_UNICODE, &optval);
 if (optval != 0)
   {
@@ -4073,6 +4354,7 @@ while (argc > 1 && argv[op][0] == '-' && argv[op][1] != 0)
   else if (strcmp(arg, "-d") == 0)   def_patctl.control |= CTL_DEBUG;
   else if (strcmp(arg, "-dfa") == 0) def_datctl.control |= CTL_DFA;
   else if (strcmp(arg, "-i") == 0)   def_patctl.control |= CTL_INFO;
+  else if (strcmp(arg, "-profile") == 0) def_datctl.control2 |= CTL2_PROFILE;
   else if (strcmp(arg, "-jit") == 0 || strcmp(arg, "-jitverify") == 0 ||
            strcmp(arg, "-jitfast") == 0)
     {
@@ -4112,6 +4394,30 @@ while (argc > 1 && argv[op][0] == '-' && argv[op][1] != 0)
     if (both) timeit = timeitm;
     }
 
+  /* Set statistical timing parameters */
+
+  else if (strcmp(arg, "-ts") == 0 || strcmp(arg, "-tsp") == 0)
+    {
+    timestats_counters = arg[3] == 'p';
+    if (argc > 2 && (uli = strtoul(argv[op+1], &endptr, 10), *endptr == 0))
+      {
+      if (uli == 0)
+        {
+        cfprintf(clr_test_error, stderr, "pcre2test: Argument for %s must not be zero\n", arg);
+        exit(1);
+        }
+      if (uli > 1000000)
+        {
+        cfprintf(clr_test_error, stderr, "pcre2test: Argument for %s is too big\n", arg);
+        exit(1);
+        }
+      timestats = (int)uli;
+      op++;
+      argc--;
+      }
+    else timestats = STATSAMPLES;
+    }
+
   /* Set malloc testing */
 
   else if (strcmp(arg, "-malloc") == 0)
@@ -4455,9 +4761,15 @@ free(pbuffer16);
 free(pbuffer32);
 #endif
 free(dfa_workspace);
+free(profile_counts);
 free(tables3);
 free_globals();
 
+/* Codes from #loadregion are in these blocks, so they must be freed after
+the pattern stack has been emptied. */
+
+while (regioncount > 0) free(regionlist[--regioncount]);
+
 #if defined(__VMS)
   yield = SS$_NORMAL;  /* Return values via DCL symbols */
 #endif
@@ -66,12 +66,18 @@ library. */
 #define match_data            PCRE2_SUFFIX(match_data_)
 #define jit_stack             PCRE2_SUFFIX(jit_stack_)
 #define jit_stack_size        PCRE2_SUFFIX(jit_stack_size_)
+#define heapframe_pool        PCRE2_SUFFIX(heapframe_pool_)
+#define dfa_ws_object         PCRE2_SUFFIX(dfa_ws_object_)
+#define compile_arena         PCRE2_SUFFIX(compile_arena_)
+#define glob_code             PCRE2_SUFFIX(glob_code_)
 #define patstack              PCRE2_SUFFIX(patstack_)
 #define patstacknext          PCRE2_SUFFIX(patstacknext_)
 #define rep_in_buffer         PCRE2_SUFFIX(rep_in_buffer_)
 #define rep_in_buffer_size    PCRE2_SUFFIX(rep_in_buffer_size_)
 #define rep_out_buffer        PCRE2_SUFFIX(rep_out_buffer_)
 #define rep_out_buffer_size   PCRE2_SUFFIX(rep_out_buffer_size_)
+#define rep_sink_buffer       PCRE2_SUFFIX(rep_sink_buffer_)
+#define rep_sink_length       PCRE2_SUFFIX(rep_sink_length_)
 
 #define jit_callback                      PCRE2_SUFFIX(jit_callback_)
 #define pcre2_strcmp_c8                   PCRE2_SUFFIX(pcre2_strcmp_c8_)
@@ -97,8 +103,11 @@ library. */
 #define have_active_pattern               PCRE2_SUFFIX(have_active_pattern_)
 #define free_active_pattern               PCRE2_SUFFIX(free_active_pattern_)
 #define check_match_limit                 PCRE2_SUFFIX(check_match_limit_)
+#define repeat_match                      PCRE2_SUFFIX(repeat_match_)
+#define match_statistics                  PCRE2_SUFFIX(match_statistics_)
 #define substitute_callout_function       PCRE2_SUFFIX(substitute_callout_function_)
 #define substitute_case_callout_function  PCRE2_SUFFIX(substitute_case_callout_function_)
+#define substitute_output_function        PCRE2_SUFFIX(substitute_output_function_)
 #define callout_function                  PCRE2_SUFFIX(callout_function_)
 #define copy_and_get                      PCRE2_SUFFIX(copy_and_get_)
 #define copy_substitute_string            PCRE2_SUFFIX(copy_substitute_string_)
@@ -120,6 +129,14 @@ static pcre2_match_data       *match_data = NULL;
 static pcre2_jit_stack *jit_stack = NULL;
 static size_t           jit_stack_size = 0;
 
+static pcre2_frame_pool *heapframe_pool = NULL;
+
+static pcre2_dfa_workspace *dfa_ws_object = NULL;
+
+static pcre2_compile_arena *compile_arena = NULL;
+
+static pcre2_glob *glob_code = NULL;
+
 static pcre2_code *patstack[PATSTACKSIZE];
 static int         patstacknext = 0;
 
@@ -127,6 +144,8 @@ static PCRE2_UCHAR *rep_in_buffer = NULL;
 static size_t       rep_in_buffer_size = REPLACE_MODSIZE;    /* Code units */
 static PCRE2_UCHAR *rep_out_buffer = NULL;
 static size_t       rep_out_buffer_size = REPLACE_BUFFSIZE;  /* Code units */
+static PCRE2_UCHAR *rep_sink_buffer = NULL;   /* Same size as rep_out_buffer */
+static size_t       rep_sink_length = 0;
 
 
 
@@ -1159,6 +1178,10 @@ if (pat_patctl.jit != 0)
   (void)pattern_info(PCRE2_INFO_JITSIZE, &size, FALSE);
   cfprintf(clr_profiling, outfile, "Memory allocation - JIT code  : %" SIZ_FORM "\n", size);
   }
+
+if (compile_arena != NULL)
+  cfprintf(clr_profiling, outfile, "Memory allocation - arena     : %" SIZ_FORM "\n",
+    pcre2_get_compile_arena_size(compile_arena));
 }
 
 
@@ -1188,6 +1211,12 @@ PCRE2_SIZE heapframes_size;
 heapframes_size = pcre2_get_match_data_heapframes_size(match_data);
 cfprintf(clr_profiling, outfile, "Heapframes size in match_data: %" SIZ_FORM "\n",
   heapframes_size);
+if (heapframe_pool != NULL)
+  {
+  heapframes_size = pcre2_get_frame_pool_heapframes_size(heapframe_pool);
+  cfprintf(clr_profiling, outfile, "Heapframes size in frame pool: %" SIZ_FORM "\n",
+    heapframes_size);
+  }
 }
 
 
@@ -1330,7 +1359,7 @@ if ((pat_patctl.control & (CTL_BINCODE|CTL_FULLBINCODE)) != 0)
   {
   fprintf(outfile, "------------------------------------------------------------------\n");
   pcre2_printint(compiled_code, outfile,
-    (pat_patctl.control & CTL_FULLBINCODE) != 0);
+    (pat_patctl.control & CTL_FULLBINCODE) != 0, NULL);
   }
 
 if ((pat_patctl.control & CTL_INFO) != 0)
@@ -1519,6 +1548,11 @@ if ((pat_patctl.control & CTL_INFO) != 0)
   if (extra_options != 0)
     show_compile_extra_options(clr_none, extra_options, "Extra options:", "\n");
 
+  if ((extra_options & PCRE2_EXTRA_DFA_BITPARALLEL) != 0)
+    fprintf(outfile, "Bit-parallel DFA matching is %s\n",
+      ((compiled_code->flags & PCRE2_BITPARALLEL) != 0)? "set up" :
+      "not possible");
+
   if (compiled_code->optimization_flags != PCRE2_OPTIMIZATION_ALL)
     show_optimize_flags(clr_none, compiled_code->optimization_flags, "Optimizations: ", "\n");
 
@@ -1934,6 +1968,119 @@ switch(cmd)
   free(serial);
   break;
 
+  /* Save the stack of compiled patterns to a file as a region whose codes can
+be used in place, then empty the stack. */
+
+  case CMD_SAVEREGION:
+  if (patstacknext <= 0)
+    {
+    cfprintf(clr_test_error, outfile, "** No stacked patterns to save\n");
+    return PR_OK;
+    }
+
+  rc = pcre2_serialize_encode_region((const pcre2_code **)patstack,
+    patstacknext, NULL, &serial_size);
+  if (rc < 0)
+    {
+    if (!serial_error(rc, "Region size")) return PR_ABEND;
+    break;
+    }
+
+  serial = malloc(serial_size);
+  if (serial == NULL)
+    {
+    cfprintf(clr_test_error, outfile, "** Failed to get memory (size %" SIZ_FORM ") for #saveregion\n",
+      serial_size);
+    return PR_ABEND;
+    }
+
+  rc = pcre2_serialize_encode_region((const pcre2_code **)patstack,
+    patstacknext, serial, &serial_size);
+  if (rc < 0)
+    {
+    free(serial);
+    if (!serial_error(rc, "Region encoding")) return PR_ABEND;
+    break;
+    }
+
+  rc = open_file(argptr+1, BINARY_OUTPUT_MODE, &f, "#saveregion");
+  if (rc != PR_OK)
+    {
+    free(serial);
+    return rc;
+    }
+
+  /* The length is written first, as for #save. */
+
+  for (i = 0; i < 4; i++) fputc((serial_size >> (i*8)) & 255, f);
+  rc = (fwrite(serial, 1, serial_size, f) == serial_size);
+  fclose(f);
+  free(serial);
+  if (!rc)
+    {
+    cfprintf(clr_test_error, outfile, "** Wrong return from fwrite()\n");
+    return PR_ABEND;
+    }
+
+  while(patstacknext > 0)
+    {
+    compiled_code = patstack[--patstacknext];
+    pcre2_code_free(compiled_code);
+    }
+  compiled_code = NULL;
+  break;
+
+  /* Load a region of compiled patterns from a file, and stack the patterns,
+  which are used in place. The region is kept until the end of the run. */
+
+  case CMD_LOADREGION:
+  if (patstacknext >= PATSTACKSIZE || regioncount >= REGIONLISTSIZE)
+    {
+    cfprintf(clr_test_error, outfile, "** No space to load a region\n");
+    return PR_ABEND;
+    }
+
+  rc = open_file(argptr+1, BINARY_INPUT_MODE, &f, "#loadregion");
+  if (rc != PR_OK) return rc;
+
+  serial_size = 0;
+  for (i = 0; i < 4; i++) serial_size |= fgetc(f) << (i*8);
+
+  serial = malloc(serial_size);
+  if (serial == NULL)
+    {
+    cfprintf(clr_test_error, outfile, "** Failed to get memory (size %" SIZ_FORM ") for #loadregion\n",
+      serial_size);
+    fclose(f);
+    return PR_ABEND;
+    }
+
+  i = fread(serial, 1, serial_size, f);
+  fclose(f);
+
+  if (i != serial_size)
+    {
+    cfprintf(clr_test_error, outfile, "** Wrong return from fread()\n");
+    free(serial);
+    yield = PR_ABEND;
+    break;
+    }
+
+  rc = pcre2_serialize_attach_region(
+    (const pcre2_code **)(patstack + patstacknext),
+    PATSTACKSIZE - patstacknext, serial, serial_size);
+  if (rc < 0)
+    {
+    free(serial);
+    if (!serial_error(rc, "Region attach")) yield = PR_ABEND;
+    }
+  else
+    {
+    patstacknext += rc;
+    regionlist[regioncount++] = serial;
+    }
+  break;
+
   /* Load a set of binary tables into tables3. */
 
   case CMD_LOADTABLES:
@@ -2399,7 +2546,6 @@ if ((pat_patctl.control & CTL_POSIX) != 0)
   if (pat_patctl.tables_id != 0) prmsg(&msg, "tables");
   if (pat_patctl.stackguard_test != 0) prmsg(&msg, "stackguard");
   if (timeit > 0) prmsg(&msg, "timing");
-  if (pat_patctl.jit != 0) prmsg(&msg, "JIT");
 
   if ((pat_patctl.options & ~POSIX_SUPPORTED_COMPILE_OPTIONS) != 0)
     {
@@ -2458,6 +2604,9 @@ if ((pat_patctl.control & CTL_POSIX) != 0)
   if ((pat_patctl.options & PCRE2_MULTILINE) != 0) cflags |= REG_NEWLINE;
   if ((pat_patctl.options & PCRE2_DOTALL) != 0) cflags |= REG_DOTALL;
   if ((pat_patctl.options & PCRE2_UNGREEDY) != 0) cflags |= REG_UNGREEDY;
+  if (pat_patctl.jit != 0) cflags |= REG_JIT;
+  if ((pat_patctl.control2 & CTL2_POSIX_THREADSAFE) != 0)
+    cflags |= REG_THREADSAFE;
 
   if ((pat_patctl.control & (CTL_HEXPAT|CTL_USE_LENGTH)) != 0)
     {
@@ -2513,7 +2662,7 @@ if ((pat_patctl.control & CTL_POSIX) != 0)
   if (preg.re_pcre2_code == NULL ||
       ((pcre2_real_code_8 *)preg.re_pcre2_code)->magic_number != MAGIC_NUMBER ||
       ((pcre2_real_code_8 *)preg.re_pcre2_code)->top_bracket != preg.re_nsub ||
-      preg.re_match_data == NULL ||
+      (preg.re_match_data == NULL) != ((cflags & REG_THREADSAFE) != 0) ||
       preg.re_cflags != cflags)
     {
     cfprintf(clr_test_error, outfile,
@@ -2668,6 +2817,29 @@ if (pat_patctl.convert_type != CONVERT_UNSET)
   rc = pcre2_pattern_convert(use_pbuffer, patlen, convert_options,
     &converted_pattern, &converted_length, con_context);
 
+  /* If requested, also compile the glob for pcre2_glob_match(), which must
+  give the same error, if any (except for running out of space in a buffer
+  provided for conversion). Subject lines are then checked against it. */
+
+  if ((pat_patctl.control2 & CTL2_GLOB_NATIVE) != 0)
+    {
+    int errorcode;
+    PCRE2_SIZE erroroffset;
+
+    pcre2_glob_free(glob_code);
+    glob_code = pcre2_glob_compile(use_pbuffer, patlen, convert_options,
+      &errorcode, &erroroffset, con_context);
+
+    if (rc == 0 && glob_code == NULL)
+      cfprintf(clr_test_error, outfile, "** Native glob compile failed: error %d at "
+        "offset %" SIZ_FORM "\n", errorcode, erroroffset);
+    else if (rc != 0 && rc != PCRE2_ERROR_NOMEMORY &&
+             (glob_code != NULL || errorcode != rc ||
+              erroroffset != converted_length))
+      cfprintf(clr_test_error, outfile, "** Native glob compile gave error %d at "
+        "offset %" SIZ_FORM "\n", errorcode, erroroffset);
+    }
+
 #ifdef SUPPORT_VALGRIND
   VALGRIND_MAKE_MEM_UNDEFINED(pbuffer, pbuffer_size);
 #endif
@@ -2743,6 +2915,33 @@ if ((pat_patctl.control2 & CTL2_NL_SET) == 0 && local_newline_default != 0)
   pcre2_set_newline(pat_context, local_newline_default);
   }
 
+/* Create and attach a compile arena if requested, or free it. The arena is
+kept for subsequent patterns that also request it, so that the reuse of its
+memory is exercised. */
+
+if ((pat_patctl.control2 & CTL2_COMPILE_ARENA) != 0)
+  {
+  if (compile_arena == NULL)
+    {
+    compile_arena = pcre2_compile_arena_create(0, general_context);
+    if (compile_arena == NULL)
+      {
+      cfprintf(clr_test_error, outfile, "** Failed to create compile arena\n");
+      return PR_ABEND;
+      }
+    }
+  pcre2_set_compile_arena(pat_context, compile_arena);
+  }
+else
+  {
+  pcre2_set_compile_arena(pat_context, NULL);
+  if (compile_arena != NULL)
+    {
+    pcre2_compile_arena_free(compile_arena);
+    compile_arena = NULL;
+    }
+  }
+
 /* The null_context modifier is used to test calling pcre2_compile() with a
 NULL context. */
 
@@ -3087,6 +3286,8 @@ free_active_pattern(void)
 {
 pcre2_code_free(compiled_code);
 compiled_code = NULL;
+pcre2_glob_free(glob_code);
+glob_code = NULL;
 }
 
 
@@ -3135,6 +3336,14 @@ for (;;)
       match_data->memctl.memory_data);
     match_data->heapframes = NULL;
     match_data->heapframes_size = 0;
+
+    if (heapframe_pool != NULL)
+      {
+      heapframe_pool->memctl.free(heapframe_pool->heapframes,
+        heapframe_pool->memctl.memory_data);
+      heapframe_pool->heapframes = NULL;
+      heapframe_pool->heapframes_size = 0;
+      }
     }
 
   /* No need to mess with the frames vector for match or depth limits. */
@@ -3221,6 +3430,144 @@ return capcount;
 
 
 
+/*************************************************
+*          Repeat a match for timing             *
+*************************************************/
+
+/* This is used for both the simple and the statistical timing. The outfile
+must be NULL, to suppress callout output, and for DFA matching the workspace
+must already exist.
+
+Arguments:
+  pp        the subject string
+  ulen      length of subject or PCRE2_ZERO_TERMINATED
+  options   the match options
+  mcontext  the match context
+  count     the number of matches
+
+Returns:    nothing
+*/
+
+static void
+repeat_match(PCRE2_SPTR pp, PCRE2_SIZE ulen, uint32_t options,
+  pcre2_match_context *mcontext, uint32_t count)
+{
+uint32_t i;
+
+if ((dat_datctl.control & CTL_DFA) != 0)
+  {
+  for (i = 0; i < count; i++)
+    (void)pcre2_dfa_match(compiled_code, pp, ulen, dat_datctl.offset,
+      options, match_data, mcontext, dfa_workspace, DFA_WS_DIMENSION);
+  }
+
+else if ((pat_patctl.control & CTL_JITFAST) != 0 &&
+         (dat_datctl.options & PCRE2_NO_JIT) == 0)
+  {
+  for (i = 0; i < count; i++)
+    (void)pcre2_jit_match(compiled_code, pp, ulen, dat_datctl.offset,
+      options, match_data, mcontext);
+  }
+
+else
+  {
+  for (i = 0; i < count; i++)
+    (void)pcre2_match(compiled_code, pp, ulen, dat_datctl.offset,
+      options, match_data, mcontext);
+  }
+}
+
+
+
+/*************************************************
+*          Statistical match timing              *
+*************************************************/
+
+/* This is used for -ts, -tsp, and the median_max modifier. A single match may
+be much shorter than the resolution of the clock, so each sample is a batch of
+matches, whose size is found by doubling until a batch takes long enough to be
+measured accurately. A few batches are run first to warm up the caches and
+branch predictors. The outfile must be NULL and the DFA workspace must exist,
+as for repeat_match().
+
+Arguments:
+  pp        the subject string
+  ulen      length of subject or PCRE2_ZERO_TERMINATED
+  options   the match options
+  mcontext  the match context
+  count     the number of samples
+  show      TRUE to output the statistics to saved_outfile
+  saved_outfile  the real outfile
+
+Returns:    the median time for one match in nanoseconds, or a negative
+              value if there is not enough memory
+*/
+
+static double
+match_statistics(PCRE2_SPTR pp, PCRE2_SIZE ulen, uint32_t options,
+  pcre2_match_context *mcontext, int count, BOOL show, FILE *saved_outfile)
+{
+int i;
+uint32_t batch = 1;
+double minimum, start, median;
+double *samples;
+uint64_t counters[PERF_COUNTERS];
+BOOL use_counters = FALSE;
+
+samples = (double *)malloc(count * sizeof(double));
+if (samples == NULL) return -1;
+
+minimum = 1000 * hr_clock(TRUE);
+if (minimum < STATSAMPLE_NS) minimum = STATSAMPLE_NS;
+
+for (;;)
+  {
+  start = hr_clock(FALSE);
+  repeat_match(pp, ulen, options, mcontext, batch);
+  if (hr_clock(FALSE) - start >= minimum || batch >= 0x40000000u) break;
+  batch *= 2;
+  }
+
+for (i = 0; i < count/10 + 1; i++)
+  repeat_match(pp, ulen, options, mcontext, batch);
+
+if (show && timestats_counters)
+  {
+  use_counters = TRUE;
+  memset(counters, 0, sizeof(counters));
+  }
+
+for (i = 0; i < count; i++)
+  {
+  uint64_t values[PERF_COUNTERS];
+  BOOL counting = use_counters && perf_start();
+
+  start = hr_clock(FALSE);
+  repeat_match(pp, ulen, options, mcontext, batch);
+  samples[i] = (hr_clock(FALSE) - start) / batch;
+
+  if (counting)
+    {
+    int j;
+    perf_stop(values);
+    for (j = 0; j < PERF_COUNTERS; j++)
+      if (values[j] == UINT64_MAX) counters[j] = UINT64_MAX;
+        else if (counters[j] != UINT64_MAX) counters[j] += values[j];
+    }
+  else use_counters = FALSE;
+  }
+
+outfile = saved_outfile;
+median = show_timing_statistics(samples, count, batch,
+  use_counters? counters : NULL, show);
+outfile = NULL;
+
+free(samples);
+return median;
+}
+
+
+
 /*************************************************
 *        Substitute callout function             *
 *************************************************/
@@ -3364,6 +3711,48 @@ return written;
 
 
 
+/*************************************************
+*        Substitute output function              *
+*************************************************/
+
+/* Called from pcre2_substitute() when the substitute_output modifier is set.
+Each piece of output is shown, marked according to whether it is in the output
+buffer or was passed directly, and appended to the collected output, which is
+shown as the result of the substitution.
+
+Arguments:
+  output      the piece of output
+  length      its length
+  data_ptr    callout data (unused)
+
+Returns:      0, or PCRE2_ERROR_NOMEMORY if the collected output is too long
+*/
+
+static int
+substitute_output_function(PCRE2_SPTR output, PCRE2_SIZE length,
+  void *data_ptr)
+{
+BOOL utf = (compiled_code->overall_options & PCRE2_UTF) != 0;
+(void)data_ptr;   /* Not used */
+
+if (outfile != NULL)
+  {
+  fprintf(outfile, "   Output %s \"",
+    (output >= rep_out_buffer && output < rep_out_buffer + rep_out_buffer_size)?
+      "buffer" : "direct");
+  pchars(clr_none, output, length, utf, outfile);
+  fprintf(outfile, "\"\n");
+  }
+
+if (length > rep_out_buffer_size - rep_sink_length)
+  return PCRE2_ERROR_NOMEMORY;
+memcpy(rep_sink_buffer + rep_sink_length, output, CU2BYTES(length));
+rep_sink_length += length;
+return 0;
+}
+
+
+
 /*************************************************
 *              Callout function                  *
 *************************************************/
@@ -3899,6 +4288,7 @@ static int
 process_data(void)
 {
 PCRE2_SIZE ulen, arg_ulen;
+PCRE2_SIZE profile_size;
 uint32_t gmatched;
 uint32_t c, k;
 uint32_t g_notempty = 0;
@@ -4416,8 +4806,11 @@ if ((dat_datctl.control & CTL_DFA) != 0)
   {
   if ((dat_datctl.control & CTL_ALLCAPTURES) != 0)
     cfprintf(clr_test_error, outfile, "** Ignored for DFA matching: allcaptures\n");
-  if ((dat_datctl.control2 & CTL2_HEAPFRAMES_SIZE) != 0)
+  if ((dat_datctl.control2 & (CTL2_HEAPFRAMES_SIZE|CTL2_DFA_WORKSPACE)) ==
+      CTL2_HEAPFRAMES_SIZE)
     cfprintf(clr_test_error, outfile, "** Ignored for DFA matching: heapframes_size\n");
+  if ((dat_datctl.control2 & CTL2_PROFILE) != 0)
+    cfprintf(clr_test_error, outfile, "** Ignored for DFA matching: profile\n");
   }
 
 /* We now have the subject in dbuffer, with len containing the byte length, and
@@ -4469,6 +4862,7 @@ if ((pat_patctl.control & CTL_POSIX) != 0)
   if (dat_datctl.get_numbers[0] >= 0 || dat_datctl.get_names[0] != 0)
     prmsg(&msg, "get");
   if (dat_datctl.jitstack != 0) prmsg(&msg, "jitstack");
+  if (dat_datctl.median_max != 0) prmsg(&msg, "median_max");
   if (dat_datctl.offset != 0) prmsg(&msg, "offset");
 
   if ((dat_datctl.options & ~POSIX_SUPPORTED_MATCH_OPTIONS) != 0)
@@ -4625,6 +5019,50 @@ else if (jit_stack != NULL)
   jit_stack_size = 0;
   }
 
+/* Create and attach a frame pool if requested, or detach and free it. */
+
+if ((dat_datctl.control2 & CTL2_FRAME_POOL) != 0)
+  {
+  if (heapframe_pool == NULL)
+    {
+    heapframe_pool = pcre2_frame_pool_create(general_context);
+    if (heapframe_pool == NULL)
+      {
+      cfprintf(clr_test_error, outfile, "** Failed to create frame pool\n");
+      return PR_ABEND;
+      }
+    }
+  pcre2_set_frame_pool(dat_context, heapframe_pool);
+  }
+else if (heapframe_pool != NULL)
+  {
+  pcre2_set_frame_pool(dat_context, NULL);
+  pcre2_frame_pool_free(heapframe_pool);
+  heapframe_pool = NULL;
+  }
+
+/* Likewise for a DFA workspace object. */
+
+if ((dat_datctl.control2 & CTL2_DFA_WORKSPACE) != 0)
+  {
+  if (dfa_ws_object == NULL)
+    {
+    dfa_ws_object = pcre2_dfa_workspace_create(0, general_context);
+    if (dfa_ws_object == NULL)
+      {
+      cfprintf(clr_test_error, outfile, "** Failed to create DFA workspace\n");
+      return PR_ABEND;
+      }
+    }
+  pcre2_set_dfa_workspace(dat_context, dfa_ws_object);
+  }
+else if (dfa_ws_object != NULL)
+  {
+  pcre2_set_dfa_workspace(dat_context, NULL);
+  pcre2_dfa_workspace_free(dfa_ws_object);
+  dfa_ws_object = NULL;
+  }
+
 /* When no JIT stack is assigned, we must ensure that there is a JIT callback
 if we want to verify that JIT was actually used. */
 
@@ -4687,6 +5125,13 @@ oveccount = pcre2_get_ovector_count(match_data);
      match_data->memctl.free(heapframes, memory_data); \
      match_data->heapframes = NULL; \
      match_data->heapframes_size = 0; \
+     if (heapframe_pool != NULL) \
+       { \
+       heapframe_pool->memctl.free(heapframe_pool->heapframes, \
+         heapframe_pool->memctl.memory_data); \
+       heapframe_pool->heapframes = NULL; \
+       heapframe_pool->heapframes_size = 0; \
+       } \
      } \
   while (0)
 
@@ -4717,13 +5162,19 @@ if (dat_datctl.replacement[0] != MOD_STR_UNSET)
   uint32_t emoption;  /* External match option */
   PCRE2_SIZE j, rlen, full_rlen, nsize, nsize_input, slen;
   pcre2_match_data *smatch_data;
+  pcre2_replacement *compiled_replacement = NULL;
+  PCRE2_UCHAR *check_buffer = NULL;
+  PCRE2_SIZE check_nsize = 0;
+  int check_rc = 0;
+  BOOL compile_failed = FALSE;
+  BOOL sink = FALSE;
 
   /* Fill the ovector with junk to detect elements that do not get set
   when they should be (relevant only when "allvector" is specified). */
 
   for (j = 0; j < 2*oveccount; j++) ovector[j] = JUNK_OFFSET;
 
-  if (timeitm)
+  if (timeitm || timestats || dat_datctl.median_max > 0)
     cfprintf(clr_test_error, outfile, "** Timing is not supported with replace: ignored\n");
 
   if ((dat_datctl.control & CTL_ALTGLOBAL) != 0)
@@ -4894,12 +5345,76 @@ if (dat_datctl.replacement[0] != MOD_STR_UNSET)
     pcre2_set_substitute_case_callout(dat_context, NULL, NULL);  /* No callout */
     }
 
+  if ((dat_datctl.control2 & CTL2_SUBSTITUTE_OUTPUT) != 0)
+    {
+    pcre2_set_substitute_output(dat_context, substitute_output_function, NULL);
+    }
+  else
+    {
+    pcre2_set_substitute_output(dat_context, NULL, NULL);  /* No output function */
+    }
+
+  sink = (dat_datctl.control2 & CTL2_SUBSTITUTE_OUTPUT) != 0 &&
+    use_dat_context != NULL;
+
+  /* If substitute_compiled is set, compile the replacement first, and call
+  pcre2_substitute_compiled() instead. A compile error is shown in the same way
+  as a substitution error. The replacement is also interpreted by
+  pcre2_substitute() beforehand, without showing any output, so that a
+  different result can be reported. This is not done after an external match,
+  whose result pcre2_substitute() may change, nor when testing malloc failures.
+  A compile error is expected when pcre2_substitute() finds no match, because
+  it then does not use the replacement. */
+
+  if ((dat_datctl.control2 & CTL2_SUBSTITUTE_COMPILED) != 0)
+    {
+    PCRE2_SIZE erroroffset;
+
+    if (emoption == 0 && !malloc_testing)
+      {
+      FILE *saved_outfile = outfile;
+
+      check_buffer = (PCRE2_UCHAR *)malloc(CU2BYTES(rep_out_buffer_size));
+      if (check_buffer == NULL)
+        {
+        cfprintf(clr_test_error, outfile, "** Failed to get memory for substitute_compiled\n");
+        return PR_ABEND;
+        }
+      reset_callout_state();
+      rep_sink_length = 0;
+      check_nsize = nsize;
+      outfile = NULL;
+      check_rc = pcre2_substitute(compiled_code, sbptr, slen, dat_datctl.offset,
+        dat_datctl.options|xoptions, smatch_data, use_dat_context, rbptr, rlen,
+        check_buffer, &check_nsize);
+      outfile = saved_outfile;
+      if (sink && check_rc >= 0)
+        memcpy(check_buffer, rep_sink_buffer, CU2BYTES(check_nsize));
+      }
+    compiled_replacement = pcre2_replacement_compile(compiled_code, rbptr, rlen,
+      (xoptions & (PCRE2_SUBSTITUTE_EXTENDED|PCRE2_SUBSTITUTE_LITERAL|
+        PCRE2_SUBSTITUTE_UNKNOWN_UNSET)) |
+      (dat_datctl.options & PCRE2_NO_UTF_CHECK), &rc, &erroroffset, NULL);
+    if (compiled_replacement == NULL)
+      {
+      nsize = erroroffset;
+      compile_failed = TRUE;
+      goto SUBSTITUTE_RESULT;
+      }
+    }
+
   if (malloc_testing) CLEAR_HEAP_FRAMES();
   reset_callout_state();
   nsize_input = nsize;
-  rc = pcre2_substitute(compiled_code, sbptr, slen, dat_datctl.offset,
-    dat_datctl.options|xoptions, smatch_data, use_dat_context,
-    rbptr, rlen, rep_out_buffer, &nsize);
+  rep_sink_length = 0;
+  if (compiled_replacement != NULL)
+    rc = pcre2_substitute_compiled(compiled_replacement, sbptr, slen,
+      dat_datctl.offset, dat_datctl.options|xoptions, smatch_data,
+      use_dat_context, rep_out_buffer, &nsize);
+  else
+    rc = pcre2_substitute(compiled_code, sbptr, slen, dat_datctl.offset,
+      dat_datctl.options|xoptions, smatch_data, use_dat_context,
+      rbptr, rlen, rep_out_buffer, &nsize);
 
   /* For malloc testing, we repeat the substitution. */
 
@@ -4913,9 +5428,15 @@ if (dat_datctl.replacement[0] != MOD_STR_UNSET)
       mallocs_until_failure = i;
       outfile = NULL;  /* Suppress callout output during the malloc repetitions */
       nsize = nsize_input;
-      rc = pcre2_substitute(compiled_code, sbptr, slen, dat_datctl.offset,
-        dat_datctl.options|xoptions, smatch_data, use_dat_context,
-        rbptr, rlen, rep_out_buffer, &nsize);
+      rep_sink_length = 0;
+      if (compiled_replacement != NULL)
+        rc = pcre2_substitute_compiled(compiled_replacement, sbptr, slen,
+          dat_datctl.offset, dat_datctl.options|xoptions, smatch_data,
+          use_dat_context, rep_out_buffer, &nsize);
+      else
+        rc = pcre2_substitute(compiled_code, sbptr, slen, dat_datctl.offset,
+          dat_datctl.options|xoptions, smatch_data, use_dat_context,
+          rbptr, rlen, rep_out_buffer, &nsize);
       mallocs_until_failure = INT_MAX;
       outfile = saved_outfile;
 
@@ -4923,11 +5444,31 @@ if (dat_datctl.replacement[0] != MOD_STR_UNSET)
         {
         cfprintf(clr_test_error, outfile, "** malloc() Substitution test did not fail as expected (%d)\n",
                 rc);
+        pcre2_replacement_free(compiled_replacement);
         return PR_ABEND;
         }
       }
     }
 
+  pcre2_replacement_free(compiled_replacement);
+
+  SUBSTITUTE_RESULT:
+  if (check_buffer != NULL)
+    {
+    PCRE2_UCHAR *result = sink? rep_sink_buffer : rep_out_buffer;
+    if (compile_failed? check_rc != 0 && (check_rc != rc || check_nsize != nsize) :
+        check_rc != rc || check_nsize != nsize ||
+        (rc >= 0 && memcmp(check_buffer, result, CU2BYTES(nsize)) != 0))
+      {
+      cfprintf(clr_test_error, outfile, "** pcre2_substitute() gave a different "
+        "result: %d", check_rc);
+      if (check_nsize != PCRE2_UNSET)
+        cfprintf(clr_test_error, outfile, " (%" SIZ_FORM ")", check_nsize);
+      fprintf(outfile, "\n");
+      }
+    free(check_buffer);
+    }
+
   if (rc < 0)
     {
     cfprintf(clr_api_error, outfile, "Failed: error %d", rc);
@@ -4958,7 +5499,9 @@ if (dat_datctl.replacement[0] != MOD_STR_UNSET)
   else
     {
     cfprintf(clr_api_error, outfile, "%2d: ", rc);
-    pchars(clr_api_error, rep_out_buffer, nsize, utf, outfile);
+    pchars(clr_api_error, ((dat_datctl.control2 & CTL2_SUBSTITUTE_OUTPUT) != 0 &&
+      use_dat_context != NULL)? rep_sink_buffer : rep_out_buffer, nsize, utf,
+      outfile);
     }
 
   fprintf(outfile, "\n");
@@ -4976,6 +5519,117 @@ if (dat_datctl.replacement[0] != MOD_STR_UNSET)
   return PR_OK;
   }   /* End of substitution handling */
 
+/* If match_all is set, collect matches in batches of the given size by calling
+pcre2_match_all(), resuming after each full batch as an application would. One
+offset pair is recorded for each group in the pattern that fits in the
+ovector. */
+
+if (dat_datctl.match_all > 0)
+  {
+  int rc;
+  uint32_t batch, k;
+  uint32_t goptions = 0;
+  uint32_t pairs = maxcapcount + 1;
+  PCRE2_SIZE start_offset = dat_datctl.offset;
+  PCRE2_SIZE *offsets;
+
+  if ((dat_datctl.control & CTL_DFA) != 0)
+    {
+    cfprintf(clr_test_error, outfile, "** Ignored for DFA matching: match_all\n");
+    return PR_OK;
+    }
+
+  if (timeitm || timestats || dat_datctl.median_max > 0)
+    cfprintf(clr_test_error, outfile, "** Timing is not supported with match_all: ignored\n");
+
+  if (pairs > oveccount) pairs = oveccount;
+  offsets = (PCRE2_SIZE *)malloc(2 * sizeof(PCRE2_SIZE) * pairs *
+    dat_datctl.match_all);
+  if (offsets == NULL)
+    {
+    cfprintf(clr_test_error, outfile, "** Failed to get memory for match_all\n");
+    return PR_ABEND;
+    }
+
+  for (batch = 1;; batch++)
+    {
+    PCRE2_SIZE *o = offsets;
+
+    rc = pcre2_match_all(compiled_code, pp, arg_ulen, start_offset,
+      dat_datctl.options | goptions, match_data, use_dat_context, offsets,
+      dat_datctl.match_all, pairs);
+
+    if (rc < 0)
+      {
+      cfprintf(clr_api_error, outfile, "Failed: error %d: ", rc);
+      if (!print_error_message(rc, "", "\n"))
+        {
+        free(offsets);
+        return PR_ABEND;
+        }
+      break;
+      }
+
+    fprintf(outfile, "Batch %d: %d match%s\n", (int)batch, rc,
+      (rc == 1)? "" : "es");
+
+    for (k = 0; k < (uint32_t)rc * pairs; k++, o += 2)
+      {
+      fprintf(outfile, "%2d: ", (int)(k % pairs));
+      if (o[0] == PCRE2_UNSET)
+        fprintf(outfile, "<unset>");
+      else if (o[0] <= o[1] && o[1] <= ulen)
+        pchars(clr_none, pp + o[0], o[1] - o[0], utf, outfile);
+      else
+        cfprintf(clr_test_error, outfile, "** ERROR: bad value(s) for offset(s): "
+          "0x%lx 0x%lx", (unsigned long int)o[0], (unsigned long int)o[1]);
+      fprintf(outfile, "\n");
+      }
+
+    if ((uint32_t)rc < dat_datctl.match_all ||
+        !pcre2_next_match(match_data, &start_offset, &goptions))
+      break;
+    }
+
+  free(offsets);
+  return PR_OK;
+  }
+
+/* If profiling is requested, set up a vector for the counts, which accumulate
+over all the matches for this subject line. They are collected only by
+pcre2_match(), which does not use JIT code when profiling, and only if the
+library supports profiling, which is checked by a call that does not enable
+it. */
+
+profile_size = 0;
+if ((dat_datctl.control2 & CTL2_PROFILE) != 0 &&
+    (dat_datctl.control & CTL_DFA) == 0)
+  {
+  if (use_dat_context == NULL)
+    cfprintf(clr_test_error, outfile, "** Profiling is not supported with null_context: ignored\n");
+  else if ((dat_datctl.control & (CTL_FINDLIMITS|CTL_FINDLIMITS_NOHEAP)) != 0)
+    cfprintf(clr_test_error, outfile, "** Profiling is not supported with find_limits: ignored\n");
+  else if (pcre2_set_profile(use_dat_context, NULL, 0) != 0)
+    cfprintf(clr_test_error, outfile, "** Profiling is not supported by this PCRE2 library: ignored\n");
+  else
+    {
+    (void)pattern_info(PCRE2_INFO_PROFILESIZE, &profile_size, FALSE);
+    if (profile_size > profile_counts_size)
+      {
+      free(profile_counts);
+      profile_counts = (PCRE2_SIZE *)malloc(profile_size * sizeof(PCRE2_SIZE));
+      if (profile_counts == NULL)
+        {
+        cfprintf(clr_test_error, outfile, "** Failed to get memory for profile counts\n");
+        profile_counts_size = 0;
+        return PR_ABEND;
+        }
+      profile_counts_size = profile_size;
+      }
+    memset(profile_counts, 0, profile_size * sizeof(PCRE2_SIZE));
+    }
+  }
+
 /* When a replacement string is not provided, run a loop for global matching
 with one of the basic matching functions. */
 
@@ -4996,60 +5650,60 @@ for (gmatched = 0;; gmatched++)
 
   /* Do timing if required. */
 
-  if (timeitm > 0)
+  if (timeitm > 0 || timestats > 0 || dat_datctl.median_max > 0)
     {
-    int i;
-    clock_t start_time, time_taken;
     FILE *saved_outfile = outfile;
 
-    outfile = NULL;  /* Suppress callout output during the timing repetitions */
-
     if ((dat_datctl.control & CTL_DFA) != 0)
       {
       if ((dat_datctl.options & PCRE2_DFA_RESTART) != 0)
         {
-        outfile = saved_outfile;
         cfprintf(clr_test_error, outfile, "** Timing DFA restarts is not supported\n");
         return PR_ABEND;
         }
       if (dfa_workspace == NULL)
         dfa_workspace = (int *)malloc(DFA_WS_DIMENSION*sizeof(int));
-      start_time = clock();
-      for (i = 0; i < timeitm; i++)
-        {
-        (void)pcre2_dfa_match(compiled_code, pp, arg_ulen,
-          dat_datctl.offset, dat_datctl.options | g_notempty, match_data,
-          use_dat_context, dfa_workspace, DFA_WS_DIMENSION);
-        }
       }
 
-    else if ((pat_patctl.control & CTL_JITFAST) != 0 &&
-             (dat_datctl.options & PCRE2_NO_JIT) == 0)
+    outfile = NULL;  /* Suppress callout output during the timing repetitions */
+
+    if (timeitm > 0)
       {
+      clock_t start_time, time_taken;
       start_time = clock();
-      for (i = 0; i < timeitm; i++)
-        {
-        (void)pcre2_jit_match(compiled_code, pp, arg_ulen,
-          dat_datctl.offset, dat_datctl.options | g_notempty, match_data,
-          use_dat_context);
-        }
+      repeat_match(pp, arg_ulen, dat_datctl.options | g_notempty,
+        use_dat_context, (uint32_t)timeitm);
+      total_match_time += (time_taken = clock() - start_time);
+
+      outfile = saved_outfile;
+      cfprintf(clr_profiling, outfile, "Match time %7.4f microseconds\n",
+        ((1000000 / CLOCKS_PER_SEC) * (double)time_taken) / timeitm);
+      outfile = NULL;
       }
 
-    else
+    /* Statistical timing is done for all subjects when -ts or -tsp is set,
+    and for this one if it has median_max. Nothing is output for median_max
+    unless the limit is exceeded, so that the test output is stable. */
+
+    if (timestats > 0 || dat_datctl.median_max > 0)
       {
-      start_time = clock();
-      for (i = 0; i < timeitm; i++)
+      double median = match_statistics(pp, arg_ulen,
+        dat_datctl.options | g_notempty, use_dat_context,
+        (timestats > 0)? timestats : STATSAMPLES, timestats > 0,
+        saved_outfile);
+
+      outfile = saved_outfile;
+      if (median < 0)
         {
-        (void)pcre2_match(compiled_code, pp, arg_ulen,
-          dat_datctl.offset, dat_datctl.options | g_notempty, match_data,
-          use_dat_context);
+        cfprintf(clr_test_error, outfile, "** Failed to get memory for timing samples\n");
+        return PR_ABEND;
         }
+      if (dat_datctl.median_max > 0 && median > dat_datctl.median_max)
+        cfprintf(clr_test_error, outfile, "** Median match time %.1f ns exceeds "
+          "median_max=%u\n", median, dat_datctl.median_max);
       }
-    total_match_time += (time_taken = clock() - start_time);
 
     outfile = saved_outfile;
-    cfprintf(clr_profiling, outfile, "Match time %7.4f microseconds\n",
-      ((1000000 / CLOCKS_PER_SEC) * (double)time_taken) / timeitm);
     }
 
   /* Find the heap, match and depth limits if requested. The depth and heap
@@ -5097,15 +5751,32 @@ for (gmatched = 0;; gmatched++)
         dfa_workspace = (int *)malloc(DFA_WS_DIMENSION*sizeof(int));
       if (dfa_matched++ == 0)
         dfa_workspace[0] = -1;  /* To catch bad restart */
-      capcount = pcre2_dfa_match(compiled_code, pp, arg_ulen,
-        dat_datctl.offset, dat_datctl.options | g_notempty, match_data,
-        use_dat_context, dfa_workspace, DFA_WS_DIMENSION);
+      if (dfa_ws_object != NULL && use_dat_context != NULL)
+        capcount = pcre2_dfa_match(compiled_code, pp, arg_ulen,
+          dat_datctl.offset, dat_datctl.options | g_notempty, match_data,
+          use_dat_context, NULL, 0);
+      else
+        capcount = pcre2_dfa_match(compiled_code, pp, arg_ulen,
+          dat_datctl.offset, dat_datctl.options | g_notempty, match_data,
+          use_dat_context, dfa_workspace, DFA_WS_DIMENSION);
       if (capcount == 0)
         {
         cfprintf(clr_api_error, outfile, "Matched, but offsets vector is too small to show all matches\n");
         capcount = dat_datctl.oveccount;
         }
       }
+    else if (profile_size > 0)
+      {
+      (void)pcre2_set_profile(use_dat_context, profile_counts, profile_size);
+      capcount = pcre2_match(compiled_code, pp, arg_ulen, dat_datctl.offset,
+        dat_datctl.options | g_notempty, match_data, use_dat_context);
+      (void)pcre2_set_profile(use_dat_context, NULL, 0);
+      if (capcount == 0)
+        {
+        cfprintf(clr_api_error, outfile, "Matched, but too many substrings\n");
+        capcount = dat_datctl.oveccount;
+        }
+      }
     else
       {
       if ((pat_patctl.control & CTL_JITFAST) != 0 &&
@@ -5174,6 +5845,16 @@ for (gmatched = 0;; gmatched++)
       }
     }
 
+  /* Check the native glob matcher, which matches only whole subjects. */
+
+  if (glob_code != NULL && gmatched == 0 && dat_datctl.offset == 0 &&
+      (capcount >= 0 || capcount == PCRE2_ERROR_NOMATCH))
+    {
+    int grc = pcre2_glob_match(glob_code, pp, arg_ulen, 0);
+    if ((grc == 1) != (capcount >= 0))
+      cfprintf(clr_test_error, outfile, "** Native glob match returned %d\n", grc);
+    }
+
   /* Verify that it's safe to call pcre2_next_match with rc < 0. */
 
   if (capcount < 0 && (dat_datctl.control & CTL_ANYGLOB) != 0)
@@ -5341,11 +6022,13 @@ for (gmatched = 0;; gmatched++)
       /* Check for silly offsets, in particular, values that have not been
       set when they should have been. However, if we are past the end of the
       captures for this pattern ("allvector" causes this), or if we are DFA
-      matching, it isn't an error if the entry is unchanged. */
+      matching or not asking for captures, it isn't an error if the entry is
+      unchanged. */
 
       if (start > ulen || end > ulen)
         {
         if (((dat_datctl.control & CTL_DFA) != 0 ||
+              (dat_datctl.options & PCRE2_NO_CAPTURES) != 0 ||
               i >= (int)(2*maxcapcount + 2)) &&
             start == JUNK_OFFSET && end == JUNK_OFFSET)
           fprintf(outfile, "<unchanged>\n");
@@ -5604,11 +6287,27 @@ for (gmatched = 0;; gmatched++)
     }
   }  /* End of global loop */
 
-/* All matching is done; show the resulting heapframe size if requested. */
+/* Show the compiled code annotated with the profile counts if requested. */
 
-if ((dat_datctl.control2 & CTL2_HEAPFRAMES_SIZE) != 0 &&
-    (dat_datctl.control & CTL_DFA) == 0)
-  show_heapframes_size();
+if (profile_size > 0)
+  {
+  cfprintf(clr_profiling, outfile, "------------------------------------------------------------------\n");
+  cfprintf(clr_profiling, outfile, "   Count Backtrack\n");
+  pcre2_printint(compiled_code, outfile,
+    (pat_patctl.control & CTL_FULLBINCODE) != 0, profile_counts);
+  }
+
+/* All matching is done; show the resulting heapframe size, or the size of a
+DFA workspace object, if requested. */
+
+if ((dat_datctl.control2 & CTL2_HEAPFRAMES_SIZE) != 0)
+  {
+  if ((dat_datctl.control & CTL_DFA) == 0)
+    show_heapframes_size();
+  else if (dfa_ws_object != NULL)
+    cfprintf(clr_profiling, outfile, "DFA workspace size: %" SIZ_FORM "\n",
+      pcre2_get_dfa_workspace_size(dfa_ws_object));
+  }
 
 show_memory = FALSE;
 return PR_OK;
@@ -5636,6 +6335,7 @@ con_context = pcre2_convert_context_copy(default_con_context);
 match_data = pcre2_match_data_create(max_oveccount, general_context);
 rep_in_buffer = malloc(sizeof(PCRE2_UCHAR) * rep_in_buffer_size);
 rep_out_buffer = malloc(sizeof(PCRE2_UCHAR) * rep_out_buffer_size);
+rep_sink_buffer = malloc(sizeof(PCRE2_UCHAR) * rep_out_buffer_size);
 
 /* Set a default parentheses nest limit that is large enough to run the
 standard tests (this also exercises the function). */
@@ -5663,6 +6363,10 @@ if (jit_stack != NULL)
   {
   pcre2_jit_stack_free(jit_stack);
   }
+pcre2_frame_pool_free(heapframe_pool);
+pcre2_dfa_workspace_free(dfa_ws_object);
+pcre2_compile_arena_free(compile_arena);
+pcre2_glob_free(glob_code);
 
 pcre2_general_context_free(general_context);
 pcre2_general_context_free(general_context_copy);
@@ -5674,6 +6378,7 @@ pcre2_convert_context_free(default_con_context);
 pcre2_convert_context_free(con_context);
 free(rep_in_buffer);
 free(rep_out_buffer);
+free(rep_sink_buffer);
 }
 
 
@@ -6492,6 +7197,233 @@ ASSERT(rc == PCRE2_ERROR_DIFFSUBSPATTERN, "pcre2_substitute(pattern)");
   pcre2_serialize_free(serialized_bytes);
 }
 
+/* ------------ pcre2_code_copy of a code in a region ---------------------- */
+
+{
+  pcre2_code *region_code = pcre2_compile(pattern, PCRE2_ZERO_TERMINATED,
+    0, &errorcode, &erroroffset, NULL);
+  const pcre2_code *attached[1] = { NULL };
+  pcre2_code *region_copy = NULL;
+  PCRE2_SIZE region_size = 0;
+  uint8_t *region = NULL;
+
+  ASSERT(region_code != NULL, "region setup");
+  rc = pcre2_serialize_encode_region((const pcre2_code **)&region_code, 1,
+    NULL, &region_size);
+  ASSERT(rc == 1, "pcre2_serialize_encode_region(size)");
+  region = malloc(region_size);
+  ASSERT(region != NULL, "region setup");
+  rc = pcre2_serialize_encode_region((const pcre2_code **)&region_code, 1,
+    region, &region_size);
+  pcre2_code_free(region_code);
+  ASSERT(rc == 1, "pcre2_serialize_encode_region()");
+  rc = pcre2_serialize_attach_region(attached, 1, region, region_size);
+  ASSERT(rc == 1 && attached[0] != NULL, "pcre2_serialize_attach_region()");
+
+  /* A block size near the maximum must be rejected, not wrapped round to zero
+  by alignment. The trailer is copied to the start of the code, where it would
+  then be looked for, so that only the size check can fail. */
+
+  {
+    pcre2_real_code *region_re = (pcre2_real_code *)(attached[0]);
+    PCRE2_SIZE saved_blocksize = region_re->blocksize;
+    uint8_t saved_start[sizeof(PCRE2_SIZE)];
+    memcpy(saved_start, region_re, sizeof(PCRE2_SIZE));
+    memcpy(region_re, (uint8_t *)region_re + REGION_ALIGN(saved_blocksize),
+      sizeof(PCRE2_SIZE));
+    region_re->blocksize = ~(PCRE2_SIZE)0 - 3;
+    rc = pcre2_serialize_attach_region(attached, 1, region, region_size);
+    region_re->blocksize = saved_blocksize;
+    memcpy(region_re, saved_start, sizeof(PCRE2_SIZE));
+    ASSERT(rc == PCRE2_ERROR_BADSERIALIZEDDATA,
+      "pcre2_serialize_attach_region(huge blocksize)");
+  }
+
+  /* The copy must not use the region's tables, so it still works after the
+  region has been freed. */
+
+  region_copy = pcre2_code_copy(attached[0]);
+  ASSERT(region_copy != NULL &&
+    (region_copy->flags & (PCRE2_MAPPED|PCRE2_DEREF_TABLES)) ==
+      PCRE2_DEREF_TABLES &&
+    (region_copy->tables < region || region_copy->tables >= region + region_size),
+    "pcre2_code_copy(region code)");
+  free(region);
+  rc = pcre2_match(region_copy, subject_abcz, PCRE2_ZERO_TERMINATED, 0, 0,
+    test_match_data, NULL);
+  ASSERT(rc == 1, "pcre2_code_copy(region code) after the region is freed");
+  pcre2_code_free(region_copy);
+}
+
+/* ----------------------- pcre2_compile_many ----------------------------- */
+
+{
+  PCRE2_UCHAR bad_pattern[] = { CHAR_A, CHAR_LEFT_PARENTHESIS, 0 };
+  PCRE2_SPTR many_patterns[3];
+  PCRE2_SIZE many_lengths[3] = { PCRE2_ZERO_TERMINATED, PCRE2_ZERO_TERMINATED, 2 };
+  uint32_t many_options[3] = { 0, 0, PCRE2_CASELESS };
+  pcre2_code *many_codes[3] = { NULL, NULL, NULL };
+  int many_errorcodes[3];
+  PCRE2_SIZE many_erroroffsets[3];
+  PCRE2_SPTR set_patterns[40];
+  pcre2_code *set_codes[40];
+  pcre2_code *serial_codes[40];
+  int set_errorcodes[40], serial_errorcodes[40];
+  PCRE2_SIZE set_erroroffsets[40], serial_erroroffsets[40];
+  uint32_t j;
+
+  many_patterns[0] = capture_pattern;
+  many_patterns[1] = bad_pattern;
+  many_patterns[2] = pattern;
+
+  rc = pcre2_compile_many(NULL, 3, many_patterns, NULL, NULL, NULL, NULL, 0,
+    1, NULL);
+  ASSERT(rc == PCRE2_ERROR_NULL, "pcre2_compile_many(null codes)");
+  rc = pcre2_compile_many(many_codes, 3, NULL, NULL, NULL, NULL, NULL, 0,
+    1, NULL);
+  ASSERT(rc == PCRE2_ERROR_NULL, "pcre2_compile_many(null patterns)");
+  rc = pcre2_compile_many(many_codes, 0, many_patterns, NULL, NULL, NULL,
+    NULL, 0, 4, NULL);
+  ASSERT(rc == 0, "pcre2_compile_many(no patterns)");
+
+  rc = pcre2_compile_many(many_codes, 3, many_patterns, many_lengths,
+    many_options, many_errorcodes, many_erroroffsets, 0, 1, NULL);
+  ASSERT(rc == 2 && many_codes[0] != NULL && many_codes[1] == NULL &&
+    many_codes[2] != NULL, "pcre2_compile_many()");
+  ASSERT(many_errorcodes[0] == 100 && many_errorcodes[1] == 114 &&
+    many_erroroffsets[1] == 2, "pcre2_compile_many(errors)");
+
+  pcre2_pattern_info(many_codes[2], PCRE2_INFO_ARGOPTIONS, &uval);
+  ASSERT(uval == PCRE2_CASELESS, "pcre2_compile_many(options)");
+  rc = pcre2_match(many_codes[2], subject_abcz, PCRE2_ZERO_TERMINATED, 0, 0,
+    test_match_data, NULL);
+  ASSERT(rc == 1 && pcre2_get_ovector_pointer(test_match_data)[1] == 2,
+    "pcre2_compile_many(lengths)");
+
+  for (j = 0; j < 3; j++) pcre2_code_free(many_codes[j]);
+
+  /* An arena in the caller's context is not used, and JIT is applied when it
+  is available. */
+
+  rc = pcre2_set_compile_arena(test_pat_context_copy,
+    pcre2_compile_arena_create(0, test_gen_context));
+  ASSERT(rc == 0 && test_pat_context_copy->arena != NULL,
+    "pcre2_compile_arena_create()");
+  rc = pcre2_compile_many(many_codes, 3, many_patterns, NULL, NULL, NULL,
+    NULL, PCRE2_JIT_COMPLETE, 1, test_pat_context_copy);
+  ASSERT(rc == 2 && many_codes[1] == NULL, "pcre2_compile_many(arena)");
+  ASSERT(!test_pat_context_copy->arena->in_use &&
+    pcre2_get_compile_arena_size(test_pat_context_copy->arena) == 0,
+    "pcre2_compile_many(arena not used)");
+
+  for (j = 0; j < 3; j++) pcre2_code_free(many_codes[j]);
+  pcre2_compile_arena_free(test_pat_context_copy->arena);
+  pcre2_set_compile_arena(test_pat_context_copy, NULL);
+  pcre2_compile_arena_free(NULL);
+
+  /* Compiling a larger set with several threads must give the same results as
+  compiling it with one. The default context is used, because the memory
+  functions of the test contexts are not thread-safe. */
+
+  for (j = 0; j < 40; j++)
+    set_patterns[j] = (j % 7 == 3)? bad_pattern :
+      (j % 2 == 0)? capture_pattern : pattern;
+
+  rc = pcre2_compile_many(serial_codes, 40, set_patterns, NULL, NULL,
+    serial_errorcodes, serial_erroroffsets, 0, 1, NULL);
+  ASSERT(rc == 34, "pcre2_compile_many(serial)");
+  rc = pcre2_compile_many(set_codes, 40, set_patterns, NULL, NULL,
+    set_errorcodes, set_erroroffsets, PCRE2_JIT_COMPLETE, 4, NULL);
+  ASSERT(rc == 34, "pcre2_compile_many(threads)");
+  for (j = 0; j < 40; j++)
+    {
+    size_t serial_size = 0, set_size = 0;
+    if (serial_codes[j] != NULL)
+      pcre2_pattern_info(serial_codes[j], PCRE2_INFO_SIZE, &serial_size);
+    if (set_codes[j] != NULL)
+      pcre2_pattern_info(set_codes[j], PCRE2_INFO_SIZE, &set_size);
+    ASSERT((set_codes[j] == NULL) == (serial_codes[j] == NULL) &&
+      set_size == serial_size &&
+      set_errorcodes[j] == serial_errorcodes[j] &&
+      set_erroroffsets[j] == serial_erroroffsets[j],
+      "pcre2_compile_many(threads same as serial)");
+    pcre2_code_free(serial_codes[j]);
+    pcre2_code_free(set_codes[j]);
+    }
+
+  /* More threads than patterns */
+
+  rc = pcre2_compile_many(many_codes, 3, many_patterns, NULL, NULL, NULL,
+    NULL, 0, 100, NULL);
+  ASSERT(rc == 2 && many_codes[1] == NULL, "pcre2_compile_many(100 threads)");
+  for (j = 0; j < 3; j++) pcre2_code_free(many_codes[j]);
+}
+
+/* ------------------------- Native glob functions ------------------------- */
+
+{
+  PCRE2_UCHAR star_z[] = { CHAR_ASTERISK, CHAR_Z, 0 };
+  PCRE2_UCHAR a_star[] = { CHAR_A, CHAR_ASTERISK, 0 };
+  PCRE2_UCHAR bad_glob[] = { CHAR_LEFT_SQUARE_BRACKET, CHAR_A, 0 };
+  pcre2_glob *globs[3] = { NULL, NULL, NULL };
+  pcre2_glob_set *glob_set;
+  uint32_t j;
+
+  ASSERT(pcre2_glob_compile(pattern, PCRE2_ZERO_TERMINATED,
+    PCRE2_CONVERT_POSIX_BASIC, &errorcode, &erroroffset, NULL) == NULL &&
+    errorcode == PCRE2_ERROR_BADOPTION, "pcre2_glob_compile(bad option)");
+  ASSERT(pcre2_glob_compile(bad_glob, PCRE2_ZERO_TERMINATED, 0, &errorcode,
+    &erroroffset, NULL) == NULL &&
+    errorcode == PCRE2_ERROR_MISSING_SQUARE_BRACKET && erroroffset == 2,
+    "pcre2_glob_compile(error)");
+
+  globs[0] = pcre2_glob_compile(pattern, PCRE2_ZERO_TERMINATED, 0, &errorcode,
+    &erroroffset, test_con_context);
+  globs[1] = pcre2_glob_compile(star_z, PCRE2_ZERO_TERMINATED, 0, &errorcode,
+    &erroroffset, test_con_context);
+  globs[2] = pcre2_glob_compile(a_star, PCRE2_ZERO_TERMINATED,
+    PCRE2_CONVERT_GLOB, &errorcode, &erroroffset, test_con_context);
+  ASSERT(globs[0] != NULL && globs[1] != NULL && globs[2] != NULL,
+    "pcre2_glob_compile()");
+
+  ASSERT(pcre2_glob_match(globs[0], pattern, PCRE2_ZERO_TERMINATED, 0) == 1,
+    "pcre2_glob_match()");
+  ASSERT(pcre2_glob_match(globs[0], subject_abcz, 3, 0) == 1,
+    "pcre2_glob_match(length)");
+  ASSERT(pcre2_glob_match(globs[0], subject_abcz, PCRE2_ZERO_TERMINATED, 0) ==
+    PCRE2_ERROR_NOMATCH, "pcre2_glob_match(no match)");
+  ASSERT(pcre2_glob_match(globs[0], pattern, 3, PCRE2_ANCHORED) ==
+    PCRE2_ERROR_BADOPTION, "pcre2_glob_match(bad option)");
+  ASSERT(pcre2_glob_match(NULL, pattern, 3, 0) == PCRE2_ERROR_NULL,
+    "pcre2_glob_match(NULL)");
+
+  /* The lowest numbered matching glob is reported. */
+
+  ASSERT(pcre2_glob_set_create(NULL, 3, NULL) == NULL,
+    "pcre2_glob_set_create(NULL)");
+  glob_set = pcre2_glob_set_create(globs, 3, test_gen_context);
+  ASSERT(glob_set != NULL, "pcre2_glob_set_create()");
+
+  /* The set holds its own copies. */
+
+  for (j = 0; j < 3; j++) pcre2_glob_free(globs[j]);
+  pcre2_glob_free(NULL);
+
+  rc = pcre2_glob_set_match(glob_set, pattern, PCRE2_ZERO_TERMINATED, 0);
+  ASSERT(rc == 0, "pcre2_glob_set_match(first)");
+  rc = pcre2_glob_set_match(glob_set, subject_abcz, PCRE2_ZERO_TERMINATED, 0);
+  ASSERT(rc == 1, "pcre2_glob_set_match(lowest)");
+  rc = pcre2_glob_set_match(glob_set, subject_abcz, 2, 0);
+  ASSERT(rc == 2, "pcre2_glob_set_match(any)");
+  rc = pcre2_glob_set_match(glob_set, star_z + 1, PCRE2_ZERO_TERMINATED, 0);
+  ASSERT(rc == 1, "pcre2_glob_set_match(last unit)");
+  rc = pcre2_glob_set_match(glob_set, bad_glob, PCRE2_ZERO_TERMINATED, 0);
+  ASSERT(rc == PCRE2_ERROR_NOMATCH, "pcre2_glob_set_match(no match)");
+
+  pcre2_glob_set_free(glob_set);
+  pcre2_glob_set_free(NULL);
+}
+
 /* ------------------------------------------------------------------------- */
 
 #undef ASSERT
@@ -6551,12 +7483,18 @@ if (failure != NULL)
 #undef match_data
 #undef jit_stack
 #undef jit_stack_size
+#undef heapframe_pool
+#undef dfa_ws_object
+#undef compile_arena
+#undef glob_code
 #undef patstack
 #undef patstacknext
 #undef rep_in_buffer
 #undef rep_in_buffer_size
 #undef rep_out_buffer
 #undef rep_out_buffer_size
+#undef rep_sink_buffer
+#undef rep_sink_length
 
 #undef jit_callback
 #undef pcre2_strcmp_c8
@@ -6582,8 +7520,11 @@ if (failure != NULL)
 #undef have_active_pattern
 #undef free_active_pattern
 #undef check_match_limit
+#undef repeat_match
+#undef match_statistics
 #undef substitute_callout_function
 #undef substitute_case_callout_function
+#undef substitute_output_function
 #undef callout_function
 #undef copy_and_get
 #undef copy_substitute_string